@@ -14,10 +14,62 @@
 
 #pragma once
 
-#ifdef _WIN32
-#include <intrin.h>
-#elif defined (__linux__)
-#include <x86intrin.h>
+#include <cstddef>
+#include <cstdint>
+
+/**
+* SIMD backend selection
+*
+* HT_MATH_SSE builds every MM* function on top of SSE intrinsics.
+* HT_MATH_NO_INTRINSICS builds them on plain float arithmetic instead, which
+* serves as the reference implementation optimized kernels are checked against.
+* Define either one before including any Hatchit math header to force a backend,
+* otherwise SSE is used whenever the target supports it.
+*/
+#if !defined(HT_MATH_SSE) && !defined(HT_MATH_NO_INTRINSICS)
+    #if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+        #define HT_MATH_SSE
+    #else
+        #define HT_MATH_NO_INTRINSICS
+    #endif
+#endif
+
+/**
+* Precision policy
+*
+* HT_MATH_PRECISION selects how the composite functions (normalization,
+* division operators, projection builders, ...) evaluate division and sqrt.
+* HT_MATH_PRECISION_EXACT uses divps/sqrtps and is the default.
+* HT_MATH_PRECISION_FAST uses rcpps/rsqrtps refined by one Newton-Raphson step.
+* Individual calls can override the policy with an MMPrecisionExact or
+* MMPrecisionFast tag argument.
+*/
+#define HT_MATH_PRECISION_EXACT 0
+#define HT_MATH_PRECISION_FAST  1
+
+#ifndef HT_MATH_PRECISION
+    #define HT_MATH_PRECISION HT_MATH_PRECISION_EXACT
+#endif
+
+/**
+* Wide register width
+*
+* The wide types (MMFloatW, Vector3Wide, ...) hold one value per lane for
+* wideLaneCount independent elements. HT_MATH_AVX is defined automatically when
+* the SSE backend is compiled with AVX enabled and widens them to 8 lanes, other
+* builds use 4 lanes and share the MMFloat4 code path. Define HT_MATH_NO_AVX to
+* keep 4 lanes on an AVX target.
+*/
+#if defined(HT_MATH_SSE) && defined(__AVX__) && !defined(HT_MATH_NO_AVX) && !defined(HT_MATH_AVX)
+    #define HT_MATH_AVX
+#endif
+
+#ifdef HT_MATH_SSE
+    #ifdef _WIN32
+    #include <intrin.h>
+    #elif defined (__linux__)
+    #include <x86intrin.h>
+    #endif
 #endif
 
 #ifdef _WIN32
@@ -34,6 +86,39 @@ namespace Hatchit {
 
     namespace Math {
         constexpr size_t vectorAlignment = 16;
+
+#ifdef HT_MATH_SSE
+        typedef __m128 MMFloat4;
+        typedef __m128 MMMask4;
+#else
+        /**
+        * Register stand-in used by the scalar backend. Float lanes and mask
+        * lanes share storage the same way they share an XMM register.
+        */
+        struct _MM_ALIGN16 MMFloat4Scalar
+        {
+            union
+            {
+                float    f[4];
+                uint32_t u[4];
+            };
+        };
+
+        typedef MMFloat4Scalar MMFloat4;
+        typedef MMFloat4Scalar MMMask4;
+#endif
+
+#ifdef HT_MATH_AVX
+        typedef __m256 MMFloatW;
+        typedef __m256 MMMaskW;
+        constexpr size_t wideLaneCount = 8;
+        constexpr size_t wideAlignment = 32;
+#else
+        typedef MMFloat4 MMFloatW;
+        typedef MMMask4 MMMaskW;
+        constexpr size_t wideLaneCount = 4;
+        constexpr size_t wideAlignment = 16;
+#endif
     }
 }
 
@@ -16,6 +16,7 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <new>
 
 namespace Hatchit {
 
@@ -48,6 +49,51 @@ namespace Hatchit {
 			free(ptr);
 #endif
 		}
+
+        /**
+        * \struct aligned_allocator
+        * \brief Standard allocator over aligned_malloc, lets std::vector hold SIMD types
+        */
+        template <typename T, size_t Alignment = 16>
+        struct aligned_allocator
+        {
+            typedef T value_type;
+
+            template <typename U>
+            struct rebind
+            {
+                typedef aligned_allocator<U, Alignment> other;
+            };
+
+            aligned_allocator() {}
+            template <typename U>
+            aligned_allocator(const aligned_allocator<U, Alignment>&) {}
+
+            T* allocate(size_t count)
+            {
+                void* p = aligned_malloc(count * sizeof(T), Alignment);
+                if (!p)
+                    throw std::bad_alloc();
+                return static_cast<T*>(p);
+            }
+
+            void deallocate(T* p, size_t)
+            {
+                aligned_free(p);
+            }
+        };
+
+        template <typename T, typename U, size_t Alignment>
+        inline bool operator==(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&)
+        {
+            return true;
+        }
+
+        template <typename T, typename U, size_t Alignment>
+        inline bool operator!=(const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&)
+        {
+            return false;
+        }
     }
 }
 
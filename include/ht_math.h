@@ -25,6 +25,12 @@
 #include <cmath>
 #include <sstream>
 #include <cstring>
+#include <atomic>
+#include <utility>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #ifdef _WIN32
     //Visual C++ compiler warning C4251 disable
@@ -63,9 +69,64 @@ namespace Hatchit {
         constexpr float TwoPi = Pi * 2.0f;
 
         class Vector2;
+        class Vector2x2;
         class Vector3;
         class Vector4;
         class Matrix4;
+        class Quaternion;
+        class AffineTransform;
+        class Matrix3;
+        class DualQuaternion;
+        class Vector3Wide;
+        class Vector4Wide;
+        class QuaternionWide;
+        class Matrix4Wide;
+        class MMWorkerPool;
+        class Camera;
+        class TransformHierarchy;
+
+        /** Parameter typedefs for the MM* free functions
+        *
+        * The F* typedefs are used for the first six vector sized arguments. They pass by value
+        * so the operand stays in an XMM register under the System V x86-64 ABI and __vectorcall
+        * instead of being spilled to memory when a call is not inlined. Any further vector
+        * arguments use the C* const reference typedefs. FMatrix4 is the first matrix argument,
+        * it is only passed by value on x64 __vectorcall where the four rows fit in registers.
+        * 32-bit MSVC cannot pass aligned types by value so everything stays a reference there.
+        */
+#if defined(_MSC_VER) && defined(_M_IX86)
+        typedef const Vector2&      FVector2;
+        typedef const Vector2x2&    FVector2x2;
+        typedef const Vector3&      FVector3;
+        typedef const Vector4&      FVector4;
+        typedef const Quaternion&   FQuaternion;
+#else
+        typedef const Vector2       FVector2;
+        typedef const Vector2x2     FVector2x2;
+        typedef const Vector3       FVector3;
+        typedef const Vector4       FVector4;
+        typedef const Quaternion    FQuaternion;
+#endif
+#if defined(_MSC_VER) && defined(_M_X64)
+        typedef const Matrix4           FMatrix4;
+        typedef const AffineTransform   FAffineTransform;
+        typedef const Matrix3           FMatrix3;
+        typedef const DualQuaternion    FDualQuaternion;
+#else
+        typedef const Matrix4&          FMatrix4;
+        typedef const AffineTransform&  FAffineTransform;
+        typedef const Matrix3&          FMatrix3;
+        typedef const DualQuaternion&   FDualQuaternion;
+#endif
+        typedef const Vector2&      CVector2;
+        typedef const Vector2x2&    CVector2x2;
+        typedef const Vector3&      CVector3;
+        typedef const Vector4&      CVector4;
+        typedef const Quaternion&   CQuaternion;
+        typedef const Matrix4&      CMatrix4;
+        typedef const AffineTransform& CAffineTransform;
+        typedef const Matrix3&      CMatrix3;
+        typedef const DualQuaternion& CDualQuaternion;
 
         struct Float2
         {
@@ -103,6 +164,15 @@ namespace Hatchit {
             explicit Float3(const float *pArray) : x(pArray[0]), y(pArray[1]), z(pArray[2]) {}
         };
 
+        //Float3 padded to 16 bytes so it can be read with a single aligned load
+        struct _MM_ALIGN16 Float3A : public Float3
+        {
+            Float3A() = default;
+            Float3A(float _x, float _y, float _z) : Float3(_x, _y, _z) {}
+            explicit Float3A(const float *pArray) : Float3(pArray) {}
+            explicit Float3A(const Float3& other) : Float3(other) {}
+        };
+
         struct Float4
         {
             union
@@ -183,7 +253,7 @@ namespace Hatchit {
         public:
             union
             {
-                __m128 m_rows[4];
+                MMFloat4 m_rows[4];
                 struct
                 {
                     float xx, xy, xz, xw,
@@ -210,9 +280,9 @@ namespace Hatchit {
             Vector2(const float rawArray[]);
             Vector2(float xy);
             Vector2(float x, float y);
-            Vector2(const Vector2& other);
-            explicit Vector2(const __m128& vector);
-            explicit Vector2(__m128&& vector);
+            Vector2(const Vector2& other) = default;
+            explicit Vector2(const MMFloat4& vector);
+            explicit Vector2(MMFloat4&& vector);
 
             /****************************************************
             *	 Custom allocation/deallocation
@@ -226,7 +296,7 @@ namespace Hatchit {
             *	Operators
             *****************************************************/
 
-            explicit    operator __m128(void)           const;
+            explicit    operator MMFloat4(void)           const;
             Vector2         operator+   (float s)           const;
             Vector2         operator-   (float s)           const;
             Vector2         operator*   (float s)           const;
@@ -257,12 +327,14 @@ namespace Hatchit {
             Vector2 Normalized() const;
             Vector2 Normalize();
 
+            Vector2 yx() const;
+
             Float2 ToFloat2() const;
 
         public:
             union
             {
-                __m128 m_vector;
+                MMFloat4 m_vector;
                 struct
                 {
                     float x, y;
@@ -273,6 +345,89 @@ namespace Hatchit {
 
         std::ostream& operator<< (std::ostream& output, const Vector2& v);
 
+        /////////////////////////////////////////////////////////
+        // Vector2x2 definition
+        /////////////////////////////////////////////////////////
+
+        /**
+        * Two Vector2s packed into a single register as (x0, y0, x1, y1)
+        * Every operation works on both vectors at once, so no lanes are
+        * wasted and arrays of Float2 pairs can be loaded with no padding.
+        */
+        class _MM_ALIGN16 Vector2x2
+        {
+        public:
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+            Vector2x2();
+            Vector2x2(float xy);
+            Vector2x2(float x0, float y0, float x1, float y1);
+            Vector2x2(const Vector2& first, const Vector2& second);
+            Vector2x2(const Vector2x2& other);
+            explicit Vector2x2(const Float2* pair);
+            explicit Vector2x2(MMFloat4 vector);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+            void* operator new(size_t _size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            explicit        operator MMFloat4(void)         const;
+            Vector2x2       operator+   (float s)           const;
+            Vector2x2       operator-   (float s)           const;
+            Vector2x2       operator*   (float s)           const;
+            Vector2x2       operator/   (float s)           const;
+            Vector2x2&      operator+=  (float s);
+            Vector2x2&      operator-=  (float s);
+            Vector2x2&      operator*=  (float s);
+            Vector2x2&      operator/=  (float s);
+            Vector2x2       operator+   (const Vector2x2& u) const;
+            Vector2x2       operator-   (const Vector2x2& u) const;
+            Vector2x2       operator*   (const Vector2x2& u) const;
+            Vector2x2       operator/   (const Vector2x2& u) const;
+            Vector2x2&      operator+=  (const Vector2x2& u);
+            Vector2x2&      operator-=  (const Vector2x2& u);
+            Vector2x2&      operator*=  (const Vector2x2& u);
+            Vector2x2&      operator/=  (const Vector2x2& u);
+
+            bool            operator==  (const Vector2x2& u) const;
+            bool            operator!=  (const Vector2x2& u) const;
+            const float&    operator[]  (size_t i)          const;
+            float&          operator[]  (size_t i);
+
+            static Vector2 Dot(const Vector2x2& v, const Vector2x2& u);
+            static Vector2 Distance(const Vector2x2& v, const Vector2x2& u);
+            Vector2 MagnitudeSquared() const;
+            Vector2 Magnitude() const;
+            Vector2x2 Normalized() const;
+            Vector2x2 Normalize();
+
+            Vector2 First() const;
+            Vector2 Second() const;
+            void Store(Float2* pair) const;
+
+        public:
+            union
+            {
+                MMFloat4 m_vector;
+                struct
+                {
+                    float x0, y0, x1, y1;
+                };
+                float m_data[4];
+            };
+        };
+
+        std::ostream& operator<< (std::ostream& output, const Vector2x2& v);
+
         /////////////////////////////////////////////////////////
         // Vector3 definition
         /////////////////////////////////////////////////////////
@@ -290,7 +445,9 @@ namespace Hatchit {
             Vector3(float xyz);
             Vector3(const Vector2& xy, float z);
             Vector3(float x, float y, float z);
-            Vector3(const Vector3& other);
+            explicit Vector3(const Float3& packed);
+            explicit Vector3(const Float3A& packed);
+            Vector3(const Vector3& other) = default;
 
             /****************************************************
             *	 Custom allocation/deallocation
@@ -302,7 +459,7 @@ namespace Hatchit {
             *	Operators
             *****************************************************/
 
-            explicit operator const __m128(void)   const;
+            explicit operator const MMFloat4(void)   const;
             Vector3 operator+   (float s) const;
             Vector3 operator-   (float s) const;
             Vector3 operator*   (float s) const;
@@ -335,7 +492,14 @@ namespace Hatchit {
             Vector3 Normalized() const;
             Vector3 Normalize();
 
+            Vector3 xzy() const;
+            Vector3 yxz() const;
+            Vector3 yzx() const;
+            Vector3 zxy() const;
+            Vector3 zyx() const;
+
             Float3 ToFloat3() const;
+            void   Store(Float3* dst) const;
           
         public:
             union
@@ -345,7 +509,7 @@ namespace Hatchit {
                     float x, y, z;
                 };
                 float  m_data[3];
-                __m128 m_vector;
+                MMFloat4 m_vector;
             };
         };
 
@@ -369,8 +533,8 @@ namespace Hatchit {
             Vector4(float x, float y, float z, float w);
             Vector4(const Vector2& xy, float z, float w);
             Vector4(const Vector3& xyz, float w);
-            Vector4(const Vector4& other);
-            explicit Vector4(__m128 v);
+            Vector4(const Vector4& other) = default;
+            explicit Vector4(MMFloat4 v);
 
             /****************************************************
             *	 Custom allocation/deallocation
@@ -382,7 +546,7 @@ namespace Hatchit {
             /****************************************************
             *	Operators
             *****************************************************/
-            explicit operator __m128(void) const; 
+            explicit operator MMFloat4(void) const; 
             Vector4 operator+   (float s) const;
             Vector4 operator-   (float s) const;
             Vector4 operator*   (float s) const; 
@@ -420,12 +584,21 @@ namespace Hatchit {
             float Magnitude() const;
             float MagnitudeSqr() const;
 
+            Vector4 yzxw() const;
+            Vector4 zxyw() const;
+            Vector4 zwxy() const;
+            Vector4 wzyx() const;
+            Vector4 xxxx() const;
+            Vector4 yyyy() const;
+            Vector4 zzzz() const;
+            Vector4 wwww() const;
+
             Float4 ToFloat4() const;
 
         public:
             union
             {
-                __m128 m_vector;
+                MMFloat4 m_vector;
                 struct
                 {
                     float x, y, z, w;
@@ -452,7 +625,7 @@ namespace Hatchit {
             Quaternion(const Vector3& axis, float angle);
             Quaternion(float x, float y, float z, float w);
             Quaternion(float roll, float pitch, float yaw);
-            explicit Quaternion(__m128 quatData);
+            explicit Quaternion(MMFloat4 quatData);
 
             /****************************************************
             *	 Custom allocation/deallocation
@@ -478,14 +651,14 @@ namespace Hatchit {
             Quaternion& operator-=  (const Quaternion& p_rhs);
             Quaternion& operator*=  (const Quaternion& p_rhs);
 
-            explicit operator __m128() const;
+            explicit operator MMFloat4() const;
 
             Float4 ToFloat4() const;
 
         public:
             union
             {
-                __m128 m_quaternion;
+                MMFloat4 m_quaternion;
                 struct
                 {
                     float x, y, z, w;
@@ -495,106 +668,1428 @@ namespace Hatchit {
         };
 
 
+        /////////////////////////////////////////////////////////
+        // MM AffineTransform Definition
+        /////////////////////////////////////////////////////////
+
+        /**
+        * \class AffineTransform
+        * \brief The top three rows of an affine Matrix4, 48 bytes instead of 64
+        *
+        * Uses the Matrix4 layout and column vector convention with the bottom row
+        * implied to be (0, 0, 0, 1), so the translation is the w column.
+        */
+        class _MM_ALIGN16 AffineTransform
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            AffineTransform();
+            AffineTransform(const float rawArray[]);
+            AffineTransform(float xx, float xy, float xz, float xw,
+                float yx, float yy, float yz, float yw,
+                float zx, float zy, float zz, float zw);
+            explicit AffineTransform(const Matrix4& m);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            AffineTransform operator*   (const AffineTransform& other) const;
+            AffineTransform& operator*= (const AffineTransform& other);
+
+            Matrix4 ToMatrix4() const;
+
+        public:
+            union
+            {
+                MMFloat4 m_rows[3];
+                struct
+                {
+                    float xx, xy, xz, xw,
+                          yx, yy, yz, yw,
+                          zx, zy, zz, zw;
+                };
+                float m_data[12];
+            };
+        };
+
+
+        /////////////////////////////////////////////////////////
+        // MM Matrix3 Definition
+        /////////////////////////////////////////////////////////
+
+        /**
+        * \class Matrix3
+        * \brief A 3x3 matrix stored as three padded SIMD rows
+        *
+        * Row major with the same column vector convention as Matrix4. The w lane
+        * of every row is kept at zero. Used for normal matrices, inertia tensors
+        * and rotations where a Matrix4 would carry a dead row and column.
+        */
+        class _MM_ALIGN16 Matrix3
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            Matrix3();
+            Matrix3(const float rawArray[]);
+            Matrix3(float xx, float xy, float xz,
+                float yx, float yy, float yz,
+                float zx, float zy, float zz);
+            Matrix3(const Vector3& a, const Vector3& b, const Vector3& c);
+            explicit Matrix3(const Matrix4& m);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            Matrix3 operator*   (const Matrix3& mat) const;
+            Vector3 operator*   (const Vector3& vec) const;
+            float*  operator[]  (int row);
+            const float* operator[] (int row) const;
+
+            Matrix4 ToMatrix4() const;
+
+        public:
+            union
+            {
+                MMFloat4 m_rows[3];
+                struct
+                {
+                    float xx, xy, xz, xPad,
+                          yx, yy, yz, yPad,
+                          zx, zy, zz, zPad;
+                };
+                float m_data[12];
+            };
+        };
+
+
+        /////////////////////////////////////////////////////////
+        // MM DualQuaternion Definition
+        /////////////////////////////////////////////////////////
+
+        /**
+        * \class DualQuaternion
+        * \brief Rigid transform as real + e * dual, 8 floats
+        *
+        * The real part is the rotation and the dual part is half the translation times
+        * the rotation. Products compose like matrices, (a * b) applies b first. Blending
+        * unit dual quaternions and renormalizing keeps the volume of skinned joints,
+        * where blended matrices collapse.
+        */
+        class _MM_ALIGN16 DualQuaternion
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            DualQuaternion();
+            DualQuaternion(const Quaternion& real, const Quaternion& dual);
+            DualQuaternion(const Quaternion& rotation, const Vector3& translation);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            DualQuaternion  operator*   (const DualQuaternion& other) const;
+            DualQuaternion& operator*=  (const DualQuaternion& other);
+
+            Matrix4 ToMatrix4() const;
+
+        public:
+            Quaternion m_real;
+            Quaternion m_dual;
+        };
+
+        /////////////////////////////////////////////////////////
+        // MM Wide Definitions
+        /////////////////////////////////////////////////////////
+
+        /**
+        * \class Vector3Wide
+        * \brief wideLaneCount Vector3s stored one component per register
+        *
+        * Lane i of x, y and z together form the i-th vector, so every operation
+        * processes wideLaneCount vectors at once without any horizontal work.
+        */
+        class Vector3Wide
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            Vector3Wide();
+            Vector3Wide(MMFloatW x, MMFloatW y, MMFloatW z);
+            explicit Vector3Wide(const Vector3& v);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            Vector3Wide  operator-  () const;
+            Vector3Wide  operator+  (const Vector3Wide& u) const;
+            Vector3Wide  operator-  (const Vector3Wide& u) const;
+            Vector3Wide  operator*  (const Vector3Wide& u) const;
+            Vector3Wide  operator/  (const Vector3Wide& u) const;
+            Vector3Wide  operator*  (MMFloatW s) const;
+            Vector3Wide  operator/  (MMFloatW s) const;
+            Vector3Wide  operator*  (float s) const;
+
+            Vector3Wide& operator+= (const Vector3Wide& u);
+            Vector3Wide& operator-= (const Vector3Wide& u);
+            Vector3Wide& operator*= (const Vector3Wide& u);
+            Vector3Wide& operator*= (MMFloatW s);
+
+            Vector3 Get(size_t lane) const;
+            void    Set(size_t lane, const Vector3& v);
+
+        public:
+            MMFloatW x, y, z;
+        };
+
+        /**
+        * \class Vector4Wide
+        * \brief wideLaneCount Vector4s stored one component per register
+        */
+        class Vector4Wide
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            Vector4Wide();
+            Vector4Wide(MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w);
+            Vector4Wide(const Vector3Wide& xyz, MMFloatW w);
+            explicit Vector4Wide(const Vector4& v);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            Vector4Wide  operator-  () const;
+            Vector4Wide  operator+  (const Vector4Wide& u) const;
+            Vector4Wide  operator-  (const Vector4Wide& u) const;
+            Vector4Wide  operator*  (const Vector4Wide& u) const;
+            Vector4Wide  operator/  (const Vector4Wide& u) const;
+            Vector4Wide  operator*  (MMFloatW s) const;
+            Vector4Wide  operator/  (MMFloatW s) const;
+            Vector4Wide  operator*  (float s) const;
+
+            Vector4Wide& operator+= (const Vector4Wide& u);
+            Vector4Wide& operator-= (const Vector4Wide& u);
+            Vector4Wide& operator*= (const Vector4Wide& u);
+            Vector4Wide& operator*= (MMFloatW s);
+
+            explicit operator Vector3Wide() const;
+
+            Vector4 Get(size_t lane) const;
+            void    Set(size_t lane, const Vector4& v);
+
+        public:
+            MMFloatW x, y, z, w;
+        };
+
+        /**
+        * \class QuaternionWide
+        * \brief wideLaneCount Quaternions stored one component per register
+        */
+        class QuaternionWide
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            QuaternionWide();
+            QuaternionWide(MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w);
+            explicit QuaternionWide(const Quaternion& q);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            QuaternionWide  operator+   (const QuaternionWide& p_rhs) const;
+            QuaternionWide  operator-   (const QuaternionWide& p_rhs) const;
+            QuaternionWide  operator*   (const QuaternionWide& p_rhs) const;
+
+            QuaternionWide& operator+=  (const QuaternionWide& p_rhs);
+            QuaternionWide& operator-=  (const QuaternionWide& p_rhs);
+            QuaternionWide& operator*=  (const QuaternionWide& p_rhs);
+
+            Quaternion Get(size_t lane) const;
+            void       Set(size_t lane, const Quaternion& q);
+
+        public:
+            MMFloatW x, y, z, w;
+        };
+
+        /**
+        * \class Matrix4Wide
+        * \brief wideLaneCount Matrix4s stored one element per register
+        *
+        * Uses the same row layout and column vector convention as Matrix4.
+        */
+        class Matrix4Wide
+        {
+        public:
+
+            /****************************************************
+            *	Constructors
+            *****************************************************/
+
+            Matrix4Wide();
+            Matrix4Wide(const Vector4Wide& a, const Vector4Wide& b, const Vector4Wide& c, const Vector4Wide& d);
+            explicit Matrix4Wide(const Matrix4& m);
+
+            /****************************************************
+            *	 Custom allocation/deallocation
+            *****************************************************/
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            /****************************************************
+            *	Operators
+            *****************************************************/
+
+            Matrix4Wide operator*   (const Matrix4Wide& mat) const;
+            Vector4Wide operator*   (const Vector4Wide& vec) const;
+
+            Matrix4 Get(size_t lane) const;
+            void    Set(size_t lane, const Matrix4& m);
+
+        public:
+            Vector4Wide m_rows[4];
+        };
+
+
         /////////////////////////////////////////////////////////
         // MM Instrinsic Functions
         /////////////////////////////////////////////////////////
 
-        __m128 _MM_CALLCONV MMVectorZero();
-        __m128 _MM_CALLCONV MMVectorSet(float x, float y, float z, float w);
-        __m128 _MM_CALLCONV MMVectorSetInt(uint32_t x, uint32_t y, uint32_t z, uint32_t w);
-        
-        float  _MM_CALLCONV MMVectorGetX(__m128 v);
-        float  _MM_CALLCONV MMVectorGetY(__m128 v);
-        float  _MM_CALLCONV MMVectorGetZ(__m128 v);
-        float  _MM_CALLCONV MMVectorGetW(__m128 v);
+        //Lane selectors for MMVectorSwizzle and Swizzle
+        enum MMSwizzleComponent : uint32_t
+        {
+            MM_SWIZZLE_X = 0,
+            MM_SWIZZLE_Y = 1,
+            MM_SWIZZLE_Z = 2,
+            MM_SWIZZLE_W = 3
+        };
+
+        //Lane selectors for MMVectorPermute and Permute (0 = first operand, 1 = second operand)
+        enum MMPermuteComponent : uint32_t
+        {
+            MM_PERMUTE_0X = 0,
+            MM_PERMUTE_0Y = 1,
+            MM_PERMUTE_0Z = 2,
+            MM_PERMUTE_0W = 3,
+            MM_PERMUTE_1X = 4,
+            MM_PERMUTE_1Y = 5,
+            MM_PERMUTE_1Z = 6,
+            MM_PERMUTE_1W = 7
+        };
+
+        //Tag selecting correctly rounded division and sqrt
+        struct MMPrecisionExact {};
+        //Tag selecting estimate + one Newton-Raphson step division and sqrt
+        struct MMPrecisionFast {};
+
+#if HT_MATH_PRECISION == HT_MATH_PRECISION_FAST
+        typedef MMPrecisionFast MMPrecisionDefault;
+#else
+        typedef MMPrecisionExact MMPrecisionDefault;
+#endif
+
+        MMFloat4 _MM_CALLCONV MMVectorZero();
+        MMFloat4 _MM_CALLCONV MMVectorSet(float x, float y, float z, float w);
+        MMFloat4 _MM_CALLCONV MMVectorSetInt(uint32_t x, uint32_t y, uint32_t z, uint32_t w);
+        MMFloat4 _MM_CALLCONV MMVectorSplat(float s);
+
+        MMFloat4 _MM_CALLCONV MMVectorLoad(const float* p);
+        MMFloat4 _MM_CALLCONV MMVectorLoadUnaligned(const float* p);
+        MMFloat4 _MM_CALLCONV MMVectorLoadScalar(const float* p);
+        void     _MM_CALLCONV MMVectorStore(float* p, MMFloat4 v);
+        void     _MM_CALLCONV MMVectorStoreUnaligned(float* p, MMFloat4 v);
+        void     _MM_CALLCONV MMVectorStoreScalar(float* p, MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorLoadFloat3(const Float3* p);
+        MMFloat4 _MM_CALLCONV MMVectorLoadFloat3A(const Float3A* p);
+        void     _MM_CALLCONV MMVectorStoreFloat3(Float3* p, MMFloat4 v);
+
+        float    _MM_CALLCONV MMVectorGetX(MMFloat4 v);
+        float    _MM_CALLCONV MMVectorGetY(MMFloat4 v);
+        float    _MM_CALLCONV MMVectorGetZ(MMFloat4 v);
+        float    _MM_CALLCONV MMVectorGetW(MMFloat4 v);
+
+        void     _MM_CALLCONV MMVectorGetXRaw(float* x, MMFloat4 v);
+        void     _MM_CALLCONV MMVectorGetYRaw(float* y, MMFloat4 v);
+        void     _MM_CALLCONV MMVectorGetZRaw(float* z, MMFloat4 v);
+        void     _MM_CALLCONV MMVectorGetWRaw(float* w, MMFloat4 v);
+
+        MMFloat4 _MM_CALLCONV MMVectorSetX(MMFloat4 v, float x);
+        MMFloat4 _MM_CALLCONV MMVectorSetY(MMFloat4 v, float y);
+        MMFloat4 _MM_CALLCONV MMVectorSetZ(MMFloat4 v, float z);
+        MMFloat4 _MM_CALLCONV MMVectorSetW(MMFloat4 v, float w);
+
+        MMFloat4 _MM_CALLCONV MMVectorAdd(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorSub(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMul(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMin(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMax(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorAbs(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorClamp(MMFloat4 v, MMFloat4 min, MMFloat4 max);
+        MMFloat4 _MM_CALLCONV MMVectorFloor(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorCeil(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorRound(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorReciprocalEst(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrtEst(MMFloat4 v);
+
+        MMFloat4 _MM_CALLCONV MMVectorReciprocal(MMFloat4 v, MMPrecisionExact = MMPrecisionExact());
+        MMFloat4 _MM_CALLCONV MMVectorReciprocal(MMFloat4 v, MMPrecisionFast);
+        MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrt(MMFloat4 v, MMPrecisionExact = MMPrecisionExact());
+        MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrt(MMFloat4 v, MMPrecisionFast);
+        MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u, MMPrecisionExact);
+        MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u, MMPrecisionFast);
+        MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v, MMPrecisionExact);
+        MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v, MMPrecisionFast);
+
+        MMFloat4 _MM_CALLCONV MMVectorAnd(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorAndNot(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorOr(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorXor(MMFloat4 v, MMFloat4 u);
+
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        MMFloat4 _MM_CALLCONV MMVectorShuffle(MMFloat4 v, MMFloat4 u);
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        MMFloat4 _MM_CALLCONV MMVectorBlend(MMFloat4 v, MMFloat4 u);
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        MMFloat4 _MM_CALLCONV MMVectorSwizzle(MMFloat4 v);
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        MMFloat4 _MM_CALLCONV MMVectorPermute(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorSplatX(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorSplatY(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorSplatZ(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorSplatW(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorMoveX(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMoveLH(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMoveHL(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMergeXY(MMFloat4 v, MMFloat4 u);
+        MMFloat4 _MM_CALLCONV MMVectorMergeZW(MMFloat4 v, MMFloat4 u);
+        void     _MM_CALLCONV MMVectorTranspose4(MMFloat4& r0, MMFloat4& r1, MMFloat4& r2, MMFloat4& r3);
+
+        MMMask4  _MM_CALLCONV MMVectorCompareEqual(MMFloat4 v, MMFloat4 u);
+        MMMask4  _MM_CALLCONV MMVectorCompareNotEqual(MMFloat4 v, MMFloat4 u);
+        MMMask4  _MM_CALLCONV MMVectorCompareLess(MMFloat4 v, MMFloat4 u);
+        MMMask4  _MM_CALLCONV MMVectorCompareLessEqual(MMFloat4 v, MMFloat4 u);
+        MMMask4  _MM_CALLCONV MMVectorCompareGreater(MMFloat4 v, MMFloat4 u);
+        MMMask4  _MM_CALLCONV MMVectorCompareGreaterEqual(MMFloat4 v, MMFloat4 u);
+        MMMask4  _MM_CALLCONV MMVectorNearEqual(MMFloat4 v, MMFloat4 u, MMFloat4 epsilon);
+        MMMask4  _MM_CALLCONV MMVectorIsNaN(MMFloat4 v);
+        MMMask4  _MM_CALLCONV MMVectorIsInf(MMFloat4 v);
+        MMFloat4 _MM_CALLCONV MMVectorSelect(MMMask4 mask, MMFloat4 v, MMFloat4 u);
+        int      _MM_CALLCONV MMMaskToBits(MMMask4 m);
+        bool     _MM_CALLCONV MMMaskAllTrue(MMMask4 m, int laneBits = 15);
+        bool     _MM_CALLCONV MMMaskAnyTrue(MMMask4 m, int laneBits = 15);
+
+        bool     _MM_CALLCONV MMVectorEqual(MMFloat4 v, MMFloat4 u);
+
+        uint32_t _MM_CALLCONV MMGetControlStatus();
+        void     _MM_CALLCONV MMSetControlStatus(uint32_t csr);
+
+
+        //////////////////////////////////////////////////////////
+        // MM Denormal Control
+        //////////////////////////////////////////////////////////
+
+        //MXCSR bits used by the denormal helpers
+        enum MMControlBits : uint32_t
+        {
+            MM_CONTROL_DENORMAL_FLAG        = 0x0002,
+            MM_CONTROL_UNDERFLOW_FLAG       = 0x0010,
+            MM_CONTROL_DENORMALS_ARE_ZERO   = 0x0040,
+            MM_CONTROL_FLUSH_TO_ZERO        = 0x8000
+        };
+
+        /**
+        * \class MMDenormalGuard
+        * \brief Enables flush-to-zero and denormals-are-zero for the lifetime of the guard
+        *
+        * MXCSR is per thread, so the guard only affects the thread that creates it.
+        * The previous FTZ/DAZ bits are restored on destruction. On the scalar backend
+        * the guard does nothing.
+        */
+        class MMDenormalGuard
+        {
+        public:
+            MMDenormalGuard();
+            explicit MMDenormalGuard(uint32_t modeBits);
+            ~MMDenormalGuard();
+
+            MMDenormalGuard(const MMDenormalGuard&) = delete;
+            MMDenormalGuard& operator=(const MMDenormalGuard&) = delete;
+
+        private:
+            uint32_t m_previous;
+        };
+
+        uint32_t _MM_CALLCONV MMDenormalFlushInstall();
+        void     _MM_CALLCONV MMDenormalFlushRestore(uint32_t previous);
+        bool     _MM_CALLCONV MMDenormalFlushEnabled();
+
+        /**
+        * \class MMDenormalFlushTask
+        * \brief Wraps a worker function so every invocation runs under an MMDenormalGuard
+        *
+        * Intended for thread pool entry points: std::thread(MMMakeDenormalFlushTask(worker))
+        */
+        template <typename Function>
+        class MMDenormalFlushTask
+        {
+        public:
+            explicit MMDenormalFlushTask(Function function) : m_function(std::move(function)) {}
+
+            template <typename... Args>
+            auto operator()(Args&&... args) -> decltype(std::declval<Function&>()(std::forward<Args>(args)...))
+            {
+                MMDenormalGuard guard;
+                return m_function(std::forward<Args>(args)...);
+            }
+
+        private:
+            Function m_function;
+        };
+
+        template <typename Function>
+        MMDenormalFlushTask<Function> MMMakeDenormalFlushTask(Function function);
+
+        /**
+        * \class MMDenormalCounter
+        * \brief Counts how often a stage consumed or produced denormals
+        *
+        * Counters register themselves in a global list on construction and are meant
+        * to live in static storage. Recording is thread safe.
+        */
+        class MMDenormalCounter
+        {
+        public:
+            explicit MMDenormalCounter(const char* stage);
+
+            MMDenormalCounter(const MMDenormalCounter&) = delete;
+            MMDenormalCounter& operator=(const MMDenormalCounter&) = delete;
+
+            void Record(uint32_t flags);
+            void Reset();
+
+            const char* Stage() const;
+            uint64_t    Samples() const;
+            uint64_t    DenormalInputs() const;
+            uint64_t    Underflows() const;
+
+            const MMDenormalCounter* Next() const;
+            static const MMDenormalCounter* First();
+
+        private:
+            const char*             m_stage;
+            std::atomic<uint64_t>   m_samples;
+            std::atomic<uint64_t>   m_denormalInputs;
+            std::atomic<uint64_t>   m_underflows;
+            MMDenormalCounter*      m_next;
+
+            static std::atomic<MMDenormalCounter*>& Head();
+        };
 
-        void   _MM_CALLCONV MMVectorGetXRaw(float* x, __m128 v);
-        void   _MM_CALLCONV MMVectorGetYRaw(float* y, __m128 v);
-        void   _MM_CALLCONV MMVectorGetZRaw(float* z, __m128 v);
-        void   _MM_CALLCONV MMVectorGetWRaw(float* w, __m128 v);
+        /**
+        * \class MMDenormalSampleScope
+        * \brief Attributes the MXCSR denormal and underflow flags raised inside a scope to a counter
+        *
+        * The flags are cleared on entry and sampled on exit, then the flags that were
+        * already set before the scope are put back.
+        */
+        class MMDenormalSampleScope
+        {
+        public:
+            explicit MMDenormalSampleScope(MMDenormalCounter& counter);
+            ~MMDenormalSampleScope();
 
-        __m128 _MM_CALLCONV MMVectorSetX(__m128 v, float x);
-        __m128 _MM_CALLCONV MMVectorSetY(__m128 v, float y);
-        __m128 _MM_CALLCONV MMVectorSetZ(__m128 v, float z);
-        __m128 _MM_CALLCONV MMVectorSetW(__m128 v, float w);
+            MMDenormalSampleScope(const MMDenormalSampleScope&) = delete;
+            MMDenormalSampleScope& operator=(const MMDenormalSampleScope&) = delete;
+
+        private:
+            MMDenormalCounter&  m_counter;
+            uint32_t            m_savedFlags;
+        };
 
-        bool   _MM_CALLCONV MMVectorEqual(__m128 v, __m128 u);
+        void MMDenormalReport(std::ostream& output);
+
+/**
+* HT_MATH_DENORMAL_SAMPLE(stage) samples the denormal flags raised by the rest of
+* the enclosing scope into a static counter named stage. The batch kernels use it
+* when HT_MATH_DENORMAL_COUNTERS is defined, otherwise it compiles to nothing.
+*/
+#ifdef HT_MATH_DENORMAL_COUNTERS
+    #define HT_MATH_DENORMAL_SAMPLE(stage) \
+        static ::Hatchit::Math::MMDenormalCounter htDenormalCounter(stage); \
+        ::Hatchit::Math::MMDenormalSampleScope htDenormalScope(htDenormalCounter)
+#else
+    #define HT_MATH_DENORMAL_SAMPLE(stage) ((void)0)
+#endif
 
 
         //////////////////////////////////////////////////////////
         // MM Matrix Operations
         //////////////////////////////////////////////////////////
-        Matrix4 _MM_CALLCONV MMMatrixTranslation(const Vector3& v);
+
+        //Clip space depth convention for the projection builders, distances are along -z in view space
+        enum MMDepthRange : uint32_t
+        {
+            MM_DEPTH_NEGATIVE_ONE_TO_ONE    = 0,    //near -> -1, far -> 1
+            MM_DEPTH_ZERO_TO_ONE            = 1,    //near -> 0, far -> 1
+            MM_DEPTH_REVERSED               = 2     //near -> 1, far -> 0
+        };
+
+        Matrix4 _MM_CALLCONV MMMatrixTranslation(FVector3 v);
         Matrix4 _MM_CALLCONV MMMatrixRotationX(float r);
         Matrix4 _MM_CALLCONV MMMatrixRotationY(float r);
         Matrix4 _MM_CALLCONV MMMatrixRotationZ(float r);
-        Matrix4 _MM_CALLCONV MMMatrixRotationXYZ(const Vector3& r);
-        Matrix4 _MM_CALLCONV MMMatrixRotationQuaternion(const Quaternion& q);
-        Matrix4 _MM_CALLCONV MMMatrixScale(const Vector3& scale);
+        Matrix4 _MM_CALLCONV MMMatrixRotationXYZ(FVector3 r);
+        Matrix4 _MM_CALLCONV MMMatrixRotationQuaternion(FQuaternion q);
+        Matrix4 _MM_CALLCONV MMMatrixScale(FVector3 scale);
         Matrix4 _MM_CALLCONV MMMatrixOrthoProj(float left, float right, float bottom, float top, float znear, float zfar);
         Matrix4 _MM_CALLCONV MMMatrixPerspProj(float fov, float width, float height, float znear, float zfar);
-        Matrix4 _MM_CALLCONV MMMatrixLookAt(const Vector3& lookAt, const Vector3& center, const Vector3& up);
-        Matrix4 _MM_CALLCONV MMMatrixTranspose(const Matrix4& m);
-        Matrix4 _MM_CALLCONV MMMatrixInverse(const Matrix4& m);
-        Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(const Vector3& v);
-        Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(const Matrix4& m);
-        Matrix4 _MM_CALLCONV MMMatrixInverseRotation(const Vector3& v);
-        Matrix4 _MM_CALLCONV MMMatrixInverseRotation(const Matrix4& m);
-        Matrix4 _MM_CALLCONV MMMatrixInverseRotation(const Quaternion& q);
-        Matrix4 _MM_CALLCONV MMMatrixInverseScale(const Vector3& v);
-        Matrix4 _MM_CALLCONV MMMatrixInverseScale(const Matrix4& m);
+        template <typename Precision>
+        Matrix4 _MM_CALLCONV MMMatrixOrthoProj(float left, float right, float bottom, float top, float znear, float zfar, Precision);
+        template <typename Precision>
+        Matrix4 _MM_CALLCONV MMMatrixPerspProj(float fov, float width, float height, float znear, float zfar, Precision);
+        Matrix4 _MM_CALLCONV MMMatrixOrthoProj(float left, float right, float bottom, float top, float znear, float zfar, MMDepthRange depth, Matrix4* inverse = nullptr);
+        Matrix4 _MM_CALLCONV MMMatrixPerspProj(float fov, float width, float height, float znear, float zfar, MMDepthRange depth, Matrix4* inverse = nullptr);
+        Matrix4 _MM_CALLCONV MMMatrixPerspProjInfinite(float fov, float width, float height, float znear, MMDepthRange depth, Matrix4* inverse = nullptr);
+        Vector3 _MM_CALLCONV MMMatrixUnproject(FMatrix4 inverse, FVector3 ndc);
+        void    _MM_CALLCONV MMMatrixUnprojectRay(FMatrix4 inverse, float x, float y, MMDepthRange depth, Vector3& origin, Vector3& direction);
+        void    _MM_CALLCONV MMMatrixUnprojectStream(Vector3* out, FMatrix4 inverse, const Vector3* ndc, size_t count);
+        Matrix4 _MM_CALLCONV MMMatrixLookAt(FVector3 lookAt, FVector3 center, FVector3 up);
+        Matrix4 _MM_CALLCONV MMMatrixTranspose(FMatrix4 m);
+        Matrix4 _MM_CALLCONV MMMatrixInverse(FMatrix4 m);
+        Matrix4 _MM_CALLCONV MMMatrixInverse(FMatrix4 m, float* determinant);
+        Matrix4 _MM_CALLCONV MMMatrixInverseAffine(FMatrix4 m, float* determinant = nullptr);
+        Matrix4 _MM_CALLCONV MMMatrixInverseOrthonormal(FMatrix4 m);
+        Matrix4 _MM_CALLCONV MMMatrixInverseAuto(FMatrix4 m, float* determinant = nullptr);
+        MMFloat4 _MM_CALLCONV MMMatrixDeterminantV(FMatrix4 m);
+        float   _MM_CALLCONV MMMatrixDeterminant(FMatrix4 m);
+        MMFloat4 _MM_CALLCONV MMMatrixDeterminant3x3V(FMatrix4 m);
+        float   _MM_CALLCONV MMMatrixDeterminant3x3(FMatrix4 m);
+        bool    _MM_CALLCONV MMMatrixIsAffine(FMatrix4 m);
+        void    _MM_CALLCONV MMMatrixDeterminantStream(float* out, const Matrix4* in, size_t count);
+        void    _MM_CALLCONV MMMatrixSingularMaskStream(uint32_t* out, const Matrix4* in, size_t count, float epsilon);
+        void    _MM_CALLCONV MMMatrixMirrorMaskStream(uint32_t* out, const Matrix4* in, size_t count);
+        void    _MM_CALLCONV MMMatrixAffineMaskStream(uint32_t* out, const Matrix4* in, size_t count);
+        Matrix4 _MM_CALLCONV MMMatrixOrthonormalize(FMatrix4 m);
+        void    _MM_CALLCONV MMMatrixOrthonormalizeStream(Matrix4* out, const Matrix4* in, size_t count);
+        Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(FVector3 v);
+        Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(FMatrix4 m);
+        Matrix4 _MM_CALLCONV MMMatrixInverseRotation(FVector3 v);
+        Matrix4 _MM_CALLCONV MMMatrixInverseRotation(FMatrix4 m);
+        Matrix4 _MM_CALLCONV MMMatrixInverseRotation(FQuaternion q);
+        Matrix4 _MM_CALLCONV MMMatrixInverseScale(FVector3 v);
+        Matrix4 _MM_CALLCONV MMMatrixInverseScale(FMatrix4 m);
+        bool    _MM_CALLCONV MMMatrixDecompose(FMatrix4 m, Vector3& translation, Quaternion& rotation, Vector3& scale);
+        void    _MM_CALLCONV MMMatrixDecomposeStream(Vector3* translation, Quaternion* rotation, Vector3* scale, const Matrix4* in, size_t count);
+
+        //////////////////////////////////////////////////////////
+        // MM AffineTransform Operations
+        //////////////////////////////////////////////////////////
+        Vector3         _MM_CALLCONV MMAffineTransformPoint(FAffineTransform a, FVector3 p);
+        Vector3         _MM_CALLCONV MMAffineTransformVector(FAffineTransform a, FVector3 v);
+        AffineTransform _MM_CALLCONV MMAffineInverse(FAffineTransform a, float* determinant = nullptr);
+        AffineTransform _MM_CALLCONV MMAffineTranslation(FVector3 t);
+        AffineTransform _MM_CALLCONV MMAffineRotationQuaternion(FQuaternion q);
+        AffineTransform _MM_CALLCONV MMAffineScale(FVector3 s);
+        AffineTransform _MM_CALLCONV MMAffineOrthonormalize(FAffineTransform a);
+        void _MM_CALLCONV MMAffineMultiplyStream(AffineTransform* out, const AffineTransform* a, const AffineTransform* b, size_t count);
+        void _MM_CALLCONV MMAffineInverseStream(AffineTransform* out, const AffineTransform* in, size_t count);
+        void _MM_CALLCONV MMAffineTransformPointStream(Vector3* out, FAffineTransform a, const Vector3* in, size_t count);
+        void _MM_CALLCONV MMAffineTransformVectorStream(Vector3* out, FAffineTransform a, const Vector3* in, size_t count);
+        void _MM_CALLCONV MMAffineToMatrix4Stream(Matrix4* out, const AffineTransform* in, size_t count);
+        void _MM_CALLCONV MMAffineFromMatrix4Stream(AffineTransform* out, const Matrix4* in, size_t count);
+        void _MM_CALLCONV MMAffineOrthonormalizeStream(AffineTransform* out, const AffineTransform* in, size_t count);
+
+        //////////////////////////////////////////////////////////
+        // MM Matrix3 Operations
+        //////////////////////////////////////////////////////////
+        Matrix3    _MM_CALLCONV MMMatrix3Transpose(FMatrix3 m);
+        Matrix3    _MM_CALLCONV MMMatrix3Inverse(FMatrix3 m, float* determinant = nullptr);
+        float      _MM_CALLCONV MMMatrix3Determinant(FMatrix3 m);
+        Matrix3    _MM_CALLCONV MMMatrix3NormalMatrix(FMatrix4 m);
+        Matrix3    _MM_CALLCONV MMMatrix3RotationQuaternion(FQuaternion q);
+        Matrix3    _MM_CALLCONV MMMatrix3Scale(FVector3 scale);
+        Matrix3    _MM_CALLCONV MMMatrix3Orthonormalize(FMatrix3 m);
+        void _MM_CALLCONV MMMatrix3MultiplyStream(Matrix3* out, const Matrix3* a, const Matrix3* b, size_t count);
+        void _MM_CALLCONV MMMatrix3InverseStream(Matrix3* out, const Matrix3* in, size_t count);
+        void _MM_CALLCONV MMMatrix3TransformStream(Vector3* out, FMatrix3 m, const Vector3* in, size_t count);
+        void _MM_CALLCONV MMMatrix3NormalMatrixStream(Matrix3* out, const Matrix4* in, size_t count);
+        void _MM_CALLCONV MMMatrix3OrthonormalizeStream(Matrix3* out, const Matrix3* in, size_t count);
 
         //////////////////////////////////////////////////////////
         // MM Vector2 Operations
         //////////////////////////////////////////////////////////
-        float _MM_CALLCONV MMVector2Dot(const Vector2& v, const Vector2& u);
-        float _MM_CALLCONV MMVector2Angle(const Vector2& v, const Vector2& u);
-        float _MM_CALLCONV MMVector2Distance(const Vector2& v, const Vector2& u);
-        float _MM_CALLCONV MMVector2MagnitudeSqr(const Vector2& v);
-        float _MM_CALLCONV MMVector2Magnitude(const Vector2& v);
-        Vector2 _MM_CALLCONV MMVector2Normalized(const Vector2& v);
+        float _MM_CALLCONV MMVector2Dot(FVector2 v, FVector2 u);
+        float _MM_CALLCONV MMVector2Angle(FVector2 v, FVector2 u);
+        float _MM_CALLCONV MMVector2Distance(FVector2 v, FVector2 u);
+        float _MM_CALLCONV MMVector2MagnitudeSqr(FVector2 v);
+        float _MM_CALLCONV MMVector2Magnitude(FVector2 v);
+        Vector2 _MM_CALLCONV MMVector2Normalized(FVector2 v);
+        MMFloat4 _MM_CALLCONV MMVector2DotV(FVector2 v, FVector2 u);
+        MMFloat4 _MM_CALLCONV MMVector2DistanceV(FVector2 v, FVector2 u);
+        MMFloat4 _MM_CALLCONV MMVector2MagnitudeSqrV(FVector2 v);
+        MMFloat4 _MM_CALLCONV MMVector2MagnitudeV(FVector2 v);
+        template <typename Precision>
+        Vector2 _MM_CALLCONV MMVector2Normalized(FVector2 v, Precision);
+        template <typename Precision>
+        MMFloat4 _MM_CALLCONV MMVector2MagnitudeV(FVector2 v, Precision);
+
+        MMMask4 _MM_CALLCONV MMVector2Less(FVector2 v, FVector2 u);
+        MMMask4 _MM_CALLCONV MMVector2LessEqual(FVector2 v, FVector2 u);
+        MMMask4 _MM_CALLCONV MMVector2Greater(FVector2 v, FVector2 u);
+        MMMask4 _MM_CALLCONV MMVector2GreaterEqual(FVector2 v, FVector2 u);
+        MMMask4 _MM_CALLCONV MMVector2NearEqual(FVector2 v, FVector2 u, float epsilon);
+        MMMask4 _MM_CALLCONV MMVector2IsNaN(FVector2 v);
+        MMMask4 _MM_CALLCONV MMVector2IsInf(FVector2 v);
+        bool    _MM_CALLCONV MMVector2AllTrue(MMMask4 mask);
+        bool    _MM_CALLCONV MMVector2AnyTrue(MMMask4 mask);
+        Vector2 _MM_CALLCONV MMVector2Select(MMMask4 mask, FVector2 v, FVector2 u);
+
+        Vector2 _MM_CALLCONV MMVector2Min(FVector2 v, FVector2 u);
+        Vector2 _MM_CALLCONV MMVector2Max(FVector2 v, FVector2 u);
+        Vector2 _MM_CALLCONV MMVector2Abs(FVector2 v);
+        Vector2 _MM_CALLCONV MMVector2Floor(FVector2 v);
+        Vector2 _MM_CALLCONV MMVector2Ceil(FVector2 v);
+        Vector2 _MM_CALLCONV MMVector2Round(FVector2 v);
+        Vector2 _MM_CALLCONV MMVector2Clamp(FVector2 v, FVector2 min, FVector2 max);
+        void    _MM_CALLCONV MMVector2MinStream(Vector2* out, const Vector2* v, const Vector2* u, size_t count);
+        void    _MM_CALLCONV MMVector2MaxStream(Vector2* out, const Vector2* v, const Vector2* u, size_t count);
+        void    _MM_CALLCONV MMVector2AbsStream(Vector2* out, const Vector2* in, size_t count);
+        void    _MM_CALLCONV MMVector2FloorStream(Vector2* out, const Vector2* in, size_t count);
+        void    _MM_CALLCONV MMVector2CeilStream(Vector2* out, const Vector2* in, size_t count);
+        void    _MM_CALLCONV MMVector2RoundStream(Vector2* out, const Vector2* in, size_t count);
+        void    _MM_CALLCONV MMVector2ClampStream(Vector2* out, const Vector2* in, size_t count, FVector2 min, FVector2 max);
+
+        template <uint32_t X, uint32_t Y>
+        Vector2 _MM_CALLCONV Swizzle(FVector2 v);
+        template <uint32_t X, uint32_t Y>
+        Vector2 _MM_CALLCONV Permute(FVector2 v, FVector2 u);
+
+        //////////////////////////////////////////////////////////
+        // MM Vector2x2 Operations
+        //////////////////////////////////////////////////////////
+        Vector2   _MM_CALLCONV MMVector2x2Dot(FVector2x2 v, FVector2x2 u);
+        Vector2   _MM_CALLCONV MMVector2x2Distance(FVector2x2 v, FVector2x2 u);
+        Vector2   _MM_CALLCONV MMVector2x2MagnitudeSqr(FVector2x2 v);
+        Vector2   _MM_CALLCONV MMVector2x2Magnitude(FVector2x2 v);
+        Vector2x2 _MM_CALLCONV MMVector2x2Normalized(FVector2x2 v);
+        template <typename Precision>
+        Vector2x2 _MM_CALLCONV MMVector2x2Normalized(FVector2x2 v, Precision);
+        void      _MM_CALLCONV MMVector2x2LoadArray(Vector2x2* dst, const Float2* src, size_t count);
+        void      _MM_CALLCONV MMVector2x2StoreArray(Float2* dst, const Vector2x2* src, size_t count);
 
         //////////////////////////////////////////////////////////
         // MM Vector3 Operations
         //////////////////////////////////////////////////////////
         
-        Vector3 _MM_CALLCONV MMVector3Cross(const Vector3& v, const Vector3& u);
-        float	_MM_CALLCONV MMVector3Dot(const Vector3& v, const Vector3& u);
-        float	_MM_CALLCONV MMVector3Angle(const Vector3& v, const Vector3& u);
-        float	_MM_CALLCONV MMVector3Distance(const Vector3& v, const Vector3& u);
-        float   _MM_CALLCONV MMVector3MagnitudeSqr(const Vector3& v);
-        float   _MM_CALLCONV MMVector3Magnitude(const Vector3& v);
-        Vector3 _MM_CALLCONV MMVector3Normalized(const Vector3& v);
+        Vector3 _MM_CALLCONV MMVector3Cross(FVector3 v, FVector3 u);
+        float	_MM_CALLCONV MMVector3Dot(FVector3 v, FVector3 u);
+        float	_MM_CALLCONV MMVector3Angle(FVector3 v, FVector3 u);
+        float	_MM_CALLCONV MMVector3Distance(FVector3 v, FVector3 u);
+        float   _MM_CALLCONV MMVector3MagnitudeSqr(FVector3 v);
+        float   _MM_CALLCONV MMVector3Magnitude(FVector3 v);
+        Vector3 _MM_CALLCONV MMVector3Normalized(FVector3 v);
+        void    _MM_CALLCONV MMVector3LoadArray(Vector3* dst, const Float3* src, size_t count);
+        void    _MM_CALLCONV MMVector3StoreArray(Float3* dst, const Vector3* src, size_t count);
+
+        MMFloat4 _MM_CALLCONV MMVector3DotV(FVector3 v, FVector3 u);
+        MMFloat4 _MM_CALLCONV MMVector3DistanceV(FVector3 v, FVector3 u);
+        MMFloat4 _MM_CALLCONV MMVector3MagnitudeSqrV(FVector3 v);
+        MMFloat4 _MM_CALLCONV MMVector3MagnitudeV(FVector3 v);
+        template <typename Precision>
+        Vector3 _MM_CALLCONV MMVector3Normalized(FVector3 v, Precision);
+        template <typename Precision>
+        MMFloat4 _MM_CALLCONV MMVector3MagnitudeV(FVector3 v, Precision);
+
+        MMMask4 _MM_CALLCONV MMVector3Less(FVector3 v, FVector3 u);
+        MMMask4 _MM_CALLCONV MMVector3LessEqual(FVector3 v, FVector3 u);
+        MMMask4 _MM_CALLCONV MMVector3Greater(FVector3 v, FVector3 u);
+        MMMask4 _MM_CALLCONV MMVector3GreaterEqual(FVector3 v, FVector3 u);
+        MMMask4 _MM_CALLCONV MMVector3NearEqual(FVector3 v, FVector3 u, float epsilon);
+        MMMask4 _MM_CALLCONV MMVector3IsNaN(FVector3 v);
+        MMMask4 _MM_CALLCONV MMVector3IsInf(FVector3 v);
+        bool    _MM_CALLCONV MMVector3AllTrue(MMMask4 mask);
+        bool    _MM_CALLCONV MMVector3AnyTrue(MMMask4 mask);
+        Vector3 _MM_CALLCONV MMVector3Select(MMMask4 mask, FVector3 v, FVector3 u);
+
+        Vector3 _MM_CALLCONV MMVector3Min(FVector3 v, FVector3 u);
+        Vector3 _MM_CALLCONV MMVector3Max(FVector3 v, FVector3 u);
+        Vector3 _MM_CALLCONV MMVector3Abs(FVector3 v);
+        Vector3 _MM_CALLCONV MMVector3Floor(FVector3 v);
+        Vector3 _MM_CALLCONV MMVector3Ceil(FVector3 v);
+        Vector3 _MM_CALLCONV MMVector3Round(FVector3 v);
+        Vector3 _MM_CALLCONV MMVector3Clamp(FVector3 v, FVector3 min, FVector3 max);
+        void    _MM_CALLCONV MMVector3MinStream(Vector3* out, const Vector3* v, const Vector3* u, size_t count);
+        void    _MM_CALLCONV MMVector3MaxStream(Vector3* out, const Vector3* v, const Vector3* u, size_t count);
+        void    _MM_CALLCONV MMVector3AbsStream(Vector3* out, const Vector3* in, size_t count);
+        void    _MM_CALLCONV MMVector3FloorStream(Vector3* out, const Vector3* in, size_t count);
+        void    _MM_CALLCONV MMVector3CeilStream(Vector3* out, const Vector3* in, size_t count);
+        void    _MM_CALLCONV MMVector3RoundStream(Vector3* out, const Vector3* in, size_t count);
+        void    _MM_CALLCONV MMVector3ClampStream(Vector3* out, const Vector3* in, size_t count, FVector3 min, FVector3 max);
+
+        template <uint32_t X, uint32_t Y, uint32_t Z>
+        Vector3 _MM_CALLCONV Swizzle(FVector3 v);
+        template <uint32_t X, uint32_t Y, uint32_t Z>
+        Vector3 _MM_CALLCONV Permute(FVector3 v, FVector3 u);
 
         
         //////////////////////////////////////////////////////////
         // MM Vector4 Operations
         //////////////////////////////////////////////////////////
-        float   _MM_CALLCONV MMVector4Dot(const Vector4& v, const Vector4& u);
-        Vector4 _MM_CALLCONV MMVector4Normalize(const Vector4& v);
-        Vector4 _MM_CALLCONV MMVector4NormalizeEst(const Vector4& v);
-        float   _MM_CALLCONV MMVector4Magnitude(const Vector4& v);
-        float   _MM_CALLCONV MMVector4MagnitudeSqr(const Vector4& v);
+        float   _MM_CALLCONV MMVector4Dot(FVector4 v, FVector4 u);
+        Vector4 _MM_CALLCONV MMVector4Normalize(FVector4 v);
+        Vector4 _MM_CALLCONV MMVector4NormalizeEst(FVector4 v);
+        float   _MM_CALLCONV MMVector4Magnitude(FVector4 v);
+        float   _MM_CALLCONV MMVector4MagnitudeSqr(FVector4 v);
+        MMFloat4 _MM_CALLCONV MMVector4DotV(FVector4 v, FVector4 u);
+        MMFloat4 _MM_CALLCONV MMVector4DistanceV(FVector4 v, FVector4 u);
+        MMFloat4 _MM_CALLCONV MMVector4MagnitudeSqrV(FVector4 v);
+        MMFloat4 _MM_CALLCONV MMVector4MagnitudeV(FVector4 v);
+        template <typename Precision>
+        Vector4 _MM_CALLCONV MMVector4Normalize(FVector4 v, Precision);
+        template <typename Precision>
+        MMFloat4 _MM_CALLCONV MMVector4MagnitudeV(FVector4 v, Precision);
+
+        MMMask4 _MM_CALLCONV MMVector4Less(FVector4 v, FVector4 u);
+        MMMask4 _MM_CALLCONV MMVector4LessEqual(FVector4 v, FVector4 u);
+        MMMask4 _MM_CALLCONV MMVector4Greater(FVector4 v, FVector4 u);
+        MMMask4 _MM_CALLCONV MMVector4GreaterEqual(FVector4 v, FVector4 u);
+        MMMask4 _MM_CALLCONV MMVector4NearEqual(FVector4 v, FVector4 u, float epsilon);
+        MMMask4 _MM_CALLCONV MMVector4IsNaN(FVector4 v);
+        MMMask4 _MM_CALLCONV MMVector4IsInf(FVector4 v);
+        bool    _MM_CALLCONV MMVector4AllTrue(MMMask4 mask);
+        bool    _MM_CALLCONV MMVector4AnyTrue(MMMask4 mask);
+        Vector4 _MM_CALLCONV MMVector4Select(MMMask4 mask, FVector4 v, FVector4 u);
+
+        Vector4 _MM_CALLCONV MMVector4Min(FVector4 v, FVector4 u);
+        Vector4 _MM_CALLCONV MMVector4Max(FVector4 v, FVector4 u);
+        Vector4 _MM_CALLCONV MMVector4Abs(FVector4 v);
+        Vector4 _MM_CALLCONV MMVector4Floor(FVector4 v);
+        Vector4 _MM_CALLCONV MMVector4Ceil(FVector4 v);
+        Vector4 _MM_CALLCONV MMVector4Round(FVector4 v);
+        Vector4 _MM_CALLCONV MMVector4Clamp(FVector4 v, FVector4 min, FVector4 max);
+        void    _MM_CALLCONV MMVector4MinStream(Vector4* out, const Vector4* v, const Vector4* u, size_t count);
+        void    _MM_CALLCONV MMVector4MaxStream(Vector4* out, const Vector4* v, const Vector4* u, size_t count);
+        void    _MM_CALLCONV MMVector4AbsStream(Vector4* out, const Vector4* in, size_t count);
+        void    _MM_CALLCONV MMVector4FloorStream(Vector4* out, const Vector4* in, size_t count);
+        void    _MM_CALLCONV MMVector4CeilStream(Vector4* out, const Vector4* in, size_t count);
+        void    _MM_CALLCONV MMVector4RoundStream(Vector4* out, const Vector4* in, size_t count);
+        void    _MM_CALLCONV MMVector4ClampStream(Vector4* out, const Vector4* in, size_t count, FVector4 min, FVector4 max);
+
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        Vector4 _MM_CALLCONV Swizzle(FVector4 v);
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        Vector4 _MM_CALLCONV Permute(FVector4 v, FVector4 u);
 
 
         //////////////////////////////////////////////////////////
         // MM Quaternion Operations
         //////////////////////////////////////////////////////////
-        float   _MM_CALLCONV MMQuaternionDot(const Quaternion& q, const Quaternion& r);
-        Quaternion _MM_CALLCONV MMQuaternionNormalize(const Quaternion& q);
-        Quaternion _MM_CALLCONV MMQuaternionNormalizeEst(const Quaternion& q);
-        float   _MM_CALLCONV MMQuaternionMagnitude(const Quaternion& q);
-        float   _MM_CALLCONV MMQuaternionMagnitudeSqr(const Quaternion& q);
-        Quaternion _MM_CALLCONV MMQuaternionConjugate(const Quaternion& q);
+        float   _MM_CALLCONV MMQuaternionDot(FQuaternion q, FQuaternion r);
+        Quaternion _MM_CALLCONV MMQuaternionNormalize(FQuaternion q);
+        Quaternion _MM_CALLCONV MMQuaternionNormalizeEst(FQuaternion q);
+        float   _MM_CALLCONV MMQuaternionMagnitude(FQuaternion q);
+        float   _MM_CALLCONV MMQuaternionMagnitudeSqr(FQuaternion q);
+        MMFloat4 _MM_CALLCONV MMQuaternionDotV(FQuaternion q, FQuaternion r);
+        MMFloat4 _MM_CALLCONV MMQuaternionMagnitudeSqrV(FQuaternion q);
+        MMFloat4 _MM_CALLCONV MMQuaternionMagnitudeV(FQuaternion q);
+        template <typename Precision>
+        Quaternion _MM_CALLCONV MMQuaternionNormalize(FQuaternion q, Precision);
+        template <typename Precision>
+        MMFloat4 _MM_CALLCONV MMQuaternionMagnitudeV(FQuaternion q, Precision);
+        Quaternion _MM_CALLCONV MMQuaternionConjugate(FQuaternion q);
+
+        MMMask4 _MM_CALLCONV MMQuaternionNearEqual(FQuaternion v, FQuaternion u, float epsilon);
+        MMMask4 _MM_CALLCONV MMQuaternionIsNaN(FQuaternion v);
+        MMMask4 _MM_CALLCONV MMQuaternionIsInf(FQuaternion v);
+        bool    _MM_CALLCONV MMQuaternionAllTrue(MMMask4 mask);
+        bool    _MM_CALLCONV MMQuaternionAnyTrue(MMMask4 mask);
+        Quaternion _MM_CALLCONV MMQuaternionSelect(MMMask4 mask, FQuaternion v, FQuaternion u);
+        Quaternion _MM_CALLCONV MMQuaternionFromMatrix(FMatrix4 m);
+        Quaternion _MM_CALLCONV MMQuaternionFromAffine(FAffineTransform a);
+        Quaternion _MM_CALLCONV MMQuaternionFromMatrix3(FMatrix3 m);
+        void _MM_CALLCONV MMQuaternionFromMatrixStream(Quaternion* out, const Matrix4* in, size_t count);
+        void _MM_CALLCONV MMQuaternionFromAffineStream(Quaternion* out, const AffineTransform* in, size_t count);
+        void _MM_CALLCONV MMQuaternionFromMatrix3Stream(Quaternion* out, const Matrix3* in, size_t count);
+        size_t _MM_CALLCONV MMQuaternionRenormalizeStream(Quaternion* q, size_t count, float tolerance);
+
+
+        //////////////////////////////////////////////////////////
+        // MM DualQuaternion Operations
+        //////////////////////////////////////////////////////////
+        DualQuaternion _MM_CALLCONV MMDualQuaternionNormalize(FDualQuaternion dq);
+        DualQuaternion _MM_CALLCONV MMDualQuaternionConjugate(FDualQuaternion dq);
+        DualQuaternion _MM_CALLCONV MMDualQuaternionFromMatrix(FMatrix4 m);
+        Vector3        _MM_CALLCONV MMDualQuaternionGetTranslation(FDualQuaternion dq);
+        Vector3        _MM_CALLCONV MMDualQuaternionTransformPoint(FDualQuaternion dq, FVector3 p);
+        Vector3        _MM_CALLCONV MMDualQuaternionTransformVector(FDualQuaternion dq, FVector3 v);
+        DualQuaternion _MM_CALLCONV MMDualQuaternionBlend(const DualQuaternion* palette, const uint32_t* indices, const float* weights, size_t influences);
+        void _MM_CALLCONV MMDualQuaternionBlendStream(DualQuaternion* out, const DualQuaternion* palette, const uint32_t* indices,
+                                                      const float* weights, size_t influences, size_t count);
+        void _MM_CALLCONV MMDualQuaternionTransformPointStream(Vector3* out, const DualQuaternion* dq, const Vector3* in, size_t count);
+
+        //////////////////////////////////////////////////////////
+        // MM Skinning Operations
+        //////////////////////////////////////////////////////////
+        void _MM_CALLCONV MMSkinStream(Vector3* outPositions, Vector3* outNormals, const AffineTransform* palette,
+                                       const Vector3* positions, const Vector3* normals,
+                                       const uint32_t* indices, const float* weights, size_t count, bool renormalize = true);
+        void _MM_CALLCONV MMSkinStream(MMWorkerPool& pool, Vector3* outPositions, Vector3* outNormals, const AffineTransform* palette,
+                                       const Vector3* positions, const Vector3* normals,
+                                       const uint32_t* indices, const float* weights, size_t count, bool renormalize = true,
+                                       size_t grainSize = 1024);
+
+        //////////////////////////////////////////////////////////
+        // MM Wide Operations
+        //////////////////////////////////////////////////////////
+        MMFloatW _MM_CALLCONV MMWideZero();
+        MMFloatW _MM_CALLCONV MMWideSplat(float s);
+        MMFloatW _MM_CALLCONV MMWideLoad(const float* p);
+        MMFloatW _MM_CALLCONV MMWideLoadUnaligned(const float* p);
+        void     _MM_CALLCONV MMWideStore(float* p, MMFloatW v);
+        void     _MM_CALLCONV MMWideStoreUnaligned(float* p, MMFloatW v);
+        float    _MM_CALLCONV MMWideGetLane(MMFloatW v, size_t lane);
+        MMFloatW _MM_CALLCONV MMWideSetLane(MMFloatW v, size_t lane, float s);
+        void     _MM_CALLCONV MMWideFromRows(const MMFloat4* rows, MMFloatW& x, MMFloatW& y, MMFloatW& z, MMFloatW& w);
+        void     _MM_CALLCONV MMWideToRows(MMFloat4* rows, MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w);
+
+        MMFloatW _MM_CALLCONV MMWideAdd(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideSub(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideMul(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideMin(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideMax(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v);
+        MMFloatW _MM_CALLCONV MMWideReciprocalEst(MMFloatW v);
+        MMFloatW _MM_CALLCONV MMWideReciprocalSqrtEst(MMFloatW v);
+        MMFloatW _MM_CALLCONV MMWideReciprocal(MMFloatW v, MMPrecisionExact = MMPrecisionExact());
+        MMFloatW _MM_CALLCONV MMWideReciprocal(MMFloatW v, MMPrecisionFast);
+        MMFloatW _MM_CALLCONV MMWideReciprocalSqrt(MMFloatW v, MMPrecisionExact = MMPrecisionExact());
+        MMFloatW _MM_CALLCONV MMWideReciprocalSqrt(MMFloatW v, MMPrecisionFast);
+        MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u, MMPrecisionExact);
+        MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u, MMPrecisionFast);
+        MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v, MMPrecisionExact);
+        MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v, MMPrecisionFast);
+
+        MMFloatW _MM_CALLCONV MMWideAnd(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideAndNot(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideOr(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideXor(MMFloatW v, MMFloatW u);
+
+        MMMaskW  _MM_CALLCONV MMWideCompareEqual(MMFloatW v, MMFloatW u);
+        MMMaskW  _MM_CALLCONV MMWideCompareLess(MMFloatW v, MMFloatW u);
+        MMMaskW  _MM_CALLCONV MMWideCompareLessEqual(MMFloatW v, MMFloatW u);
+        MMMaskW  _MM_CALLCONV MMWideCompareGreater(MMFloatW v, MMFloatW u);
+        MMMaskW  _MM_CALLCONV MMWideCompareGreaterEqual(MMFloatW v, MMFloatW u);
+        MMFloatW _MM_CALLCONV MMWideSelect(MMMaskW mask, MMFloatW v, MMFloatW u);
+        int      _MM_CALLCONV MMWideMaskToBits(MMMaskW m);
+        bool     _MM_CALLCONV MMWideMaskAllTrue(MMMaskW m);
+        bool     _MM_CALLCONV MMWideMaskAnyTrue(MMMaskW m);
+
+        MMFloatW    _MM_CALLCONV MMVector3WideDot(const Vector3Wide& v, const Vector3Wide& u);
+        Vector3Wide _MM_CALLCONV MMVector3WideCross(const Vector3Wide& v, const Vector3Wide& u);
+        MMFloatW    _MM_CALLCONV MMVector3WideMagnitudeSqr(const Vector3Wide& v);
+        MMFloatW    _MM_CALLCONV MMVector3WideMagnitude(const Vector3Wide& v);
+        Vector3Wide _MM_CALLCONV MMVector3WideNormalized(const Vector3Wide& v);
+        template <typename Precision>
+        Vector3Wide _MM_CALLCONV MMVector3WideNormalized(const Vector3Wide& v, Precision);
+        Vector3Wide _MM_CALLCONV MMVector3WideSelect(MMMaskW mask, const Vector3Wide& v, const Vector3Wide& u);
+        Vector3Wide _MM_CALLCONV MMVector3WideLoad(const float* x, const float* y, const float* z);
+        void        _MM_CALLCONV MMVector3WideStore(float* x, float* y, float* z, const Vector3Wide& v);
+        Vector3Wide _MM_CALLCONV MMVector3WideLoadAoS(const Vector3* src);
+        void        _MM_CALLCONV MMVector3WideStoreAoS(Vector3* dst, const Vector3Wide& v);
+
+        MMFloatW    _MM_CALLCONV MMVector4WideDot(const Vector4Wide& v, const Vector4Wide& u);
+        MMFloatW    _MM_CALLCONV MMVector4WideMagnitudeSqr(const Vector4Wide& v);
+        MMFloatW    _MM_CALLCONV MMVector4WideMagnitude(const Vector4Wide& v);
+        Vector4Wide _MM_CALLCONV MMVector4WideNormalize(const Vector4Wide& v);
+        template <typename Precision>
+        Vector4Wide _MM_CALLCONV MMVector4WideNormalize(const Vector4Wide& v, Precision);
+        Vector4Wide _MM_CALLCONV MMVector4WideSelect(MMMaskW mask, const Vector4Wide& v, const Vector4Wide& u);
+        Vector4Wide _MM_CALLCONV MMVector4WideLoad(const float* x, const float* y, const float* z, const float* w);
+        void        _MM_CALLCONV MMVector4WideStore(float* x, float* y, float* z, float* w, const Vector4Wide& v);
+        Vector4Wide _MM_CALLCONV MMVector4WideLoadAoS(const Vector4* src);
+        void        _MM_CALLCONV MMVector4WideStoreAoS(Vector4* dst, const Vector4Wide& v);
+
+        MMFloatW       _MM_CALLCONV MMQuaternionWideDot(const QuaternionWide& q, const QuaternionWide& r);
+        QuaternionWide _MM_CALLCONV MMQuaternionWideNormalize(const QuaternionWide& q);
+        template <typename Precision>
+        QuaternionWide _MM_CALLCONV MMQuaternionWideNormalize(const QuaternionWide& q, Precision);
+        QuaternionWide _MM_CALLCONV MMQuaternionWideConjugate(const QuaternionWide& q);
+        Vector3Wide    _MM_CALLCONV MMQuaternionWideRotate(const QuaternionWide& q, const Vector3Wide& v);
+        QuaternionWide _MM_CALLCONV MMQuaternionWideSelect(MMMaskW mask, const QuaternionWide& q, const QuaternionWide& r);
+        QuaternionWide _MM_CALLCONV MMQuaternionWideLoad(const float* x, const float* y, const float* z, const float* w);
+        void           _MM_CALLCONV MMQuaternionWideStore(float* x, float* y, float* z, float* w, const QuaternionWide& q);
+        QuaternionWide _MM_CALLCONV MMQuaternionWideLoadAoS(const Quaternion* src);
+        void           _MM_CALLCONV MMQuaternionWideStoreAoS(Quaternion* dst, const QuaternionWide& q);
+
+        Vector4Wide _MM_CALLCONV MMMatrixTransformWide(FMatrix4 m, const Vector4Wide& v);
+        Vector3Wide _MM_CALLCONV MMMatrixTransformPointWide(FMatrix4 m, const Vector3Wide& p);
+        Vector3Wide _MM_CALLCONV MMMatrixTransformDirectionWide(FMatrix4 m, const Vector3Wide& d);
+        Matrix4Wide _MM_CALLCONV MMMatrix4WideTranspose(const Matrix4Wide& m);
+        Matrix4Wide _MM_CALLCONV MMMatrix4WideLoadAoS(const Matrix4* src);
+        void        _MM_CALLCONV MMMatrix4WideStoreAoS(Matrix4* dst, const Matrix4Wide& m);
+        MMFloatW    _MM_CALLCONV MMMatrix4WideDeterminant(const Matrix4Wide& m);
+        MMFloatW    _MM_CALLCONV MMMatrix4WideDeterminant3x3(const Matrix4Wide& m);
+
+
+        //////////////////////////////////////////////////////////
+        // AoSoA Containers
+        //////////////////////////////////////////////////////////
+
+        constexpr size_t cacheLineAlignment = 64;
+
+        /**
+        * \struct MMWideTraits
+        * \brief Maps an element type onto its wide type for AoSoAArray
+        *
+        * Specialized for Vector3, Vector4 and Quaternion. Components are addressed
+        * as base[c * stride] so the same traits serve any block width.
+        */
+        template <typename T>
+        struct MMWideTraits;
+
+        template <>
+        struct MMWideTraits<Vector3>
+        {
+            typedef Vector3Wide Wide;
+            static constexpr size_t components = 3;
+
+            static Vector3 Gather(const float* base, size_t stride);
+            static void    Scatter(float* base, size_t stride, const Vector3& v);
+            static Wide    Load(const float* base, size_t stride);
+            static void    Store(float* base, size_t stride, const Wide& v);
+            static Wide    LoadAoS(const Vector3* src);
+            static void    StoreAoS(Vector3* dst, const Wide& v);
+        };
+
+        template <>
+        struct MMWideTraits<Vector4>
+        {
+            typedef Vector4Wide Wide;
+            static constexpr size_t components = 4;
+
+            static Vector4 Gather(const float* base, size_t stride);
+            static void    Scatter(float* base, size_t stride, const Vector4& v);
+            static Wide    Load(const float* base, size_t stride);
+            static void    Store(float* base, size_t stride, const Wide& v);
+            static Wide    LoadAoS(const Vector4* src);
+            static void    StoreAoS(Vector4* dst, const Wide& v);
+        };
+
+        template <>
+        struct MMWideTraits<Quaternion>
+        {
+            typedef QuaternionWide Wide;
+            static constexpr size_t components = 4;
+
+            static Quaternion Gather(const float* base, size_t stride);
+            static void       Scatter(float* base, size_t stride, const Quaternion& q);
+            static Wide       Load(const float* base, size_t stride);
+            static void       Store(float* base, size_t stride, const Wide& q);
+            static Wide       LoadAoS(const Quaternion* src);
+            static void       StoreAoS(Quaternion* dst, const Wide& q);
+        };
+
+        /**
+        * \class AoSoAArray
+        * \brief Array of structures of arrays, blocks of BlockWidth elements stored component-wise
+        *
+        * Each block holds x[BlockWidth] y[BlockWidth] z[BlockWidth] (w[BlockWidth]) and the
+        * storage is aligned to a cache line. Touching one element reads one block instead of
+        * one cache line per component stream, while whole blocks still load straight into
+        * wide registers. Lanes past Size() in the last block are zero filled and are visited
+        * by ForEachWide, so kernels must tolerate zero inputs there.
+        */
+        template <typename T, size_t BlockWidth = wideLaneCount>
+        class AoSoAArray
+        {
+            static_assert(BlockWidth % wideLaneCount == 0, "AoSoA block width must be a multiple of wideLaneCount");
+
+        public:
+            typedef MMWideTraits<T>         Traits;
+            typedef typename Traits::Wide   Wide;
+
+            static constexpr size_t components = Traits::components;
+            static constexpr size_t blockWidth = BlockWidth;
+            static constexpr size_t widePerBlock = BlockWidth / wideLaneCount;
+
+            struct Block
+            {
+                float m_data[Traits::components][BlockWidth];
+            };
+
+            AoSoAArray();
+            explicit AoSoAArray(size_t count);
+            AoSoAArray(const T* src, size_t count);
+            AoSoAArray(const AoSoAArray& other);
+            AoSoAArray(AoSoAArray&& other);
+            ~AoSoAArray();
+
+            AoSoAArray& operator=(const AoSoAArray& other);
+            AoSoAArray& operator=(AoSoAArray&& other);
+
+            void   Resize(size_t count);
+            size_t Size() const;
+            size_t BlockCount() const;
+            size_t WideCount() const;
+
+            T    Get(size_t index) const;
+            void Set(size_t index, const T& value);
+
+            Wide LoadWide(size_t wideIndex) const;
+            void StoreWide(size_t wideIndex, const Wide& value);
+
+            template <typename Function>
+            void ForEachWide(Function function);
+            template <typename Function>
+            void ForEachWide(Function function) const;
+
+            void Load(const T* src, size_t count);
+            void Store(T* dst) const;
+
+            Block*       Blocks();
+            const Block* Blocks() const;
+
+        private:
+            Block*  m_blocks;
+            size_t  m_size;
+            size_t  m_blockCount;
+
+            const float* WideBase(size_t wideIndex) const;
+        };
+
+
+        //////////////////////////////////////////////////////////
+        // Worker Pool
+        //////////////////////////////////////////////////////////
+
+        /**
+        * \class MMWorkerPool
+        * \brief Persistent threads for splitting batch kernels into independent tasks
+        *
+        * ParallelFor hands out task indices from a shared counter, the calling thread
+        * takes tasks as well and the call returns once every task finished. Workers run
+        * each job under the caller's MXCSR rounding and denormal modes, so a kernel gives
+        * bit-identical results no matter which thread ran a task. One job runs at a time,
+        * ParallelFor must not be called from inside a task.
+        */
+        class MMWorkerPool
+        {
+        public:
+            explicit MMWorkerPool(size_t workerCount = DefaultWorkerCount());
+            ~MMWorkerPool();
+
+            MMWorkerPool(const MMWorkerPool&) = delete;
+            MMWorkerPool& operator=(const MMWorkerPool&) = delete;
+
+            //Workers plus the calling thread
+            size_t ThreadCount() const;
+
+            template <typename Function>
+            void ParallelFor(size_t taskCount, Function function);
+
+            static size_t DefaultWorkerCount();
+
+        private:
+            typedef void (*Invoke)(void* context, size_t task);
+
+            std::vector<std::thread>    m_workers;
+            std::mutex                  m_mutex;
+            std::condition_variable     m_wake;
+            std::condition_variable     m_done;
+            Invoke                      m_invoke;
+            void*                       m_context;
+            size_t                      m_taskCount;
+            std::atomic<size_t>         m_nextTask;
+            std::atomic<size_t>         m_pending;
+            uint64_t                    m_generation;
+            size_t                      m_busy;
+            uint32_t                    m_controlStatus;
+            bool                        m_stop;
+
+            void Run(size_t taskCount, Invoke invoke, void* context);
+            void Drain();
+            void WorkerMain();
+        };
+
+        //////////////////////////////////////////////////////////
+        // Camera Definition
+        //////////////////////////////////////////////////////////
+
+        /**
+        * \class Camera
+        * \brief Eye, orientation and projection with lazily rebuilt matrices
+        *
+        * The camera looks down its local -z axis. View, projection, their product, the
+        * inverses and the frustum planes are only rebuilt when read after a change, and
+        * setters that pass the current value change nothing. ViewVersion, ProjectionVersion
+        * and Version increase with every change so consumers can skip work when they match
+        * the value seen last time. The getters fill the cache, so a Camera must not be
+        * read from several threads while it is dirty.
+        */
+        class _MM_ALIGN16 Camera
+        {
+        public:
+            //Indices into FrustumPlanes, each plane is (normal, d) with the normal pointing inside
+            enum FrustumPlane : uint32_t
+            {
+                FRUSTUM_LEFT        = 0,
+                FRUSTUM_RIGHT       = 1,
+                FRUSTUM_BOTTOM      = 2,
+                FRUSTUM_TOP         = 3,
+                FRUSTUM_NEAR        = 4,
+                FRUSTUM_FAR         = 5,
+                FRUSTUM_PLANE_COUNT = 6
+            };
+
+            Camera();
+
+            void* operator new(size_t size);
+            void  operator delete(void* p);
+            void* operator new[](size_t size);
+            void  operator delete[](void* p);
+
+            void SetPosition(const Vector3& position);
+            void SetOrientation(const Quaternion& orientation);
+            void LookAt(const Vector3& eye, const Vector3& target, const Vector3& up);
+            void SetPerspective(float fov, float width, float height, float znear, float zfar,
+                                MMDepthRange depth = MM_DEPTH_NEGATIVE_ONE_TO_ONE);
+            void SetOrthographic(float left, float right, float bottom, float top, float znear, float zfar,
+                                 MMDepthRange depth = MM_DEPTH_NEGATIVE_ONE_TO_ONE);
+
+            const Vector3&    Position() const;
+            const Quaternion& Orientation() const;
+            MMDepthRange      DepthRange() const;
+            bool              IsPerspective() const;
+
+            const Matrix4& View() const;
+            const Matrix4& InverseView() const;
+            const Matrix4& Projection() const;
+            const Matrix4& InverseProjection() const;
+            const Matrix4& ViewProjection() const;
+            const Matrix4& InverseViewProjection() const;
+            const Vector4* FrustumPlanes() const;
+
+            uint32_t ViewVersion() const;
+            uint32_t ProjectionVersion() const;
+            uint32_t Version() const;
+
+        private:
+            enum DirtyBits : uint32_t
+            {
+                DIRTY_VIEW              = 0x1,
+                DIRTY_PROJECTION        = 0x2,
+                DIRTY_VIEW_PROJECTION   = 0x4,
+                DIRTY_FRUSTUM           = 0x8
+            };
+
+            Vector3         m_position;
+            Quaternion      m_orientation;
+            float           m_projectionParams[6];
+            MMDepthRange    m_depth;
+            bool            m_perspective;
+            uint32_t        m_viewVersion;
+            uint32_t        m_projectionVersion;
+
+            mutable uint32_t    m_dirty;
+            mutable Matrix4     m_view;
+            mutable Matrix4     m_inverseView;
+            mutable Matrix4     m_projection;
+            mutable Matrix4     m_inverseProjection;
+            mutable Matrix4     m_viewProjection;
+            mutable Matrix4     m_inverseViewProjection;
+            mutable Vector4     m_frustum[FRUSTUM_PLANE_COUNT];
+
+            void SetProjection(bool perspective, const float* params, MMDepthRange depth);
+            void UpdateView() const;
+            void UpdateProjection() const;
+            void UpdateViewProjection() const;
+            void UpdateFrustum() const;
+        };
+
+
+        //////////////////////////////////////////////////////////
+        // Transform Hierarchy Definition
+        //////////////////////////////////////////////////////////
+
+        //Handle of a node in a TransformHierarchy, stays valid when nodes are reordered
+        typedef uint32_t TransformNode;
+        constexpr TransformNode invalidTransformNode = 0xFFFFFFFF;
+
+        /**
+        * \class TransformHierarchy
+        * \brief Scene graph of translation, rotation, scale nodes stored flat in breadth-first order
+        *
+        * Local TRS and world matrices live in separate arrays sorted by depth, so every
+        * parent is stored before its children and each depth level is one contiguous
+        * range. Update walks the arrays once, building each dirty local matrix and
+        * multiplying it into the already finished parent world matrix. Nodes whose
+        * local transform and ancestors did not change are skipped. Structural changes
+        * (adding a shallower node, reparenting) re-sort the arrays lazily on the next
+        * Update. Handles are stable, array indices are not.
+        *
+        * World matrices are affine, their bottom row is always (0, 0, 0, 1).
+        */
+        class TransformHierarchy
+        {
+        public:
+            template <typename T>
+            using Array = std::vector<T, aligned_allocator<T, cacheLineAlignment>>;
+
+            TransformHierarchy();
+
+            TransformNode Add(TransformNode parent = invalidTransformNode);
+            TransformNode Add(TransformNode parent, const Vector3& translation, const Quaternion& rotation, const Vector3& scale);
+            void          Reparent(TransformNode node, TransformNode parent);
+            void          Reserve(size_t count);
+            void          Clear();
+
+            void SetLocal(TransformNode node, const Vector3& translation, const Quaternion& rotation, const Vector3& scale);
+            void SetTranslation(TransformNode node, const Vector3& translation);
+            void SetRotation(TransformNode node, const Quaternion& rotation);
+            void SetScale(TransformNode node, const Vector3& scale);
+
+            const Vector3&    Translation(TransformNode node) const;
+            const Quaternion& Rotation(TransformNode node) const;
+            const Vector3&    Scale(TransformNode node) const;
+            const Matrix4&    World(TransformNode node) const;
+            TransformNode     Parent(TransformNode node) const;
+
+            void Update();
+            void Update(MMWorkerPool& pool, uint32_t grainSize = 2048);
+
+            size_t   Size() const;
+            size_t   LevelCount() const;
+            uint32_t LevelBegin(size_t level) const;
+            uint32_t IndexOf(TransformNode node) const;
+
+            //Flat arrays in breadth-first order, valid until the next structural change
+            const Matrix4*  WorldMatrices() const;
+            const uint32_t* ParentIndices() const;
+
+        private:
+            Array<Vector3>      m_translation;
+            Array<Quaternion>   m_rotation;
+            Array<Vector3>      m_scale;
+            Array<Matrix4>      m_world;
+            Array<uint32_t>     m_parent;       //parent index, invalidTransformNode for roots
+            Array<uint32_t>     m_depth;
+            Array<uint8_t>      m_dirty;
+            Array<TransformNode> m_handle;      //index -> handle
+            Array<uint32_t>     m_index;        //handle -> index
+            Array<uint32_t>     m_levelBegin;   //first index of every level plus the end
+            bool                m_anyDirty;
+            bool                m_unsorted;
+
+            void MarkDirty(uint32_t index);
+            void Sort();
+            void UpdateRange(uint32_t begin, uint32_t end);
+        };
     }
 }
 
 
 #include <ht_math.inl>
 #include <ht_mathmm.inl>
+#include <ht_mathdenormal.inl>
 #include <ht_mathconvert.inl>
 #include <ht_mathvector2.inl>
+#include <ht_mathvector2x2.inl>
 #include <ht_mathvector3.inl>
 #include <ht_mathvector4.inl>
 #include <ht_mathmatrix.inl>
 #include <ht_mathquaternion.inl>
+#include <ht_mathaffine.inl>
+#include <ht_mathmatrix3.inl>
+#include <ht_mathdualquaternion.inl>
+#include <ht_mathwide.inl>
+#include <ht_mathaosoa.inl>
+#include <ht_mathworker.inl>
+#include <ht_mathskinning.inl>
+#include <ht_mathcamera.inl>
+#include <ht_mathhierarchy.inl>
@@ -130,6 +130,9 @@ namespace Hatchit {
         *   Calculates the closest whole number int32_t less than num
         *
         * \return The closest whole number int32_t less than num
+        *
+        * NOTE: The result goes through int32_t and overflows for |num| >= 2^31.
+        *       Use MMVectorFloor for large magnitudes or whole vectors.
         */
         constexpr inline int32_t _MM_CALLCONV Floorf(float num)
         {
@@ -156,6 +159,9 @@ namespace Hatchit {
         *   Calculates the closest whole number int32_t greater than num
         *
         * \return The closest whole number int32_t greater than num
+        *
+        * NOTE: The result goes through int32_t and overflows for |num| >= 2^31.
+        *       Use MMVectorCeil for large magnitudes or whole vectors.
         */
         constexpr inline int32_t _MM_CALLCONV Ceilingf(float num)
         {
@@ -182,6 +188,9 @@ namespace Hatchit {
         *   Calculates the value of num rounded to the nearest whole number int32_t
         *
         * \return  Num rounded to the nearest whole number int32_t
+        *
+        * NOTE: The result goes through int32_t and overflows for |num| >= 2^31.
+        *       Use MMVectorRound for large magnitudes or whole vectors.
         */
         constexpr inline int32_t _MM_CALLCONV Roundf(float num)
         {
@@ -0,0 +1,310 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+namespace Hatchit {
+
+    namespace Math {
+
+        namespace Internal
+        {
+            //Row of a * b for affine a and b, the implied bottom row of b contributes only a.w
+            inline MMFloat4 _MM_CALLCONV MMAffineMultiplyRow(MMFloat4 a, const MMFloat4* b)
+            {
+                static const MMFloat4 maskW = MMVectorSetInt(0, 0, 0, 0xFFFFFFFF);
+                MMFloat4 result = MMVectorMul(MMVectorSplatX(a), b[0]);
+                result = MMVectorAdd(result, MMVectorMul(MMVectorSplatY(a), b[1]));
+                result = MMVectorAdd(result, MMVectorMul(MMVectorSplatZ(a), b[2]));
+                return MMVectorAdd(result, MMVectorAnd(a, maskW));
+            }
+
+            //Transposes the three rows into the four columns (x, y, z, translation) with zero w lanes
+            inline void _MM_CALLCONV MMAffineColumns(const MMFloat4* rows, MMFloat4* columns)
+            {
+                columns[0] = rows[0];
+                columns[1] = rows[1];
+                columns[2] = rows[2];
+                columns[3] = MMVectorZero();
+                MMVectorTranspose4(columns[0], columns[1], columns[2], columns[3]);
+            }
+
+            //c0 * v.x + c1 * v.y + c2 * v.z + t, with t zero for directions
+            inline MMFloat4 _MM_CALLCONV MMAffineTransformColumns(const MMFloat4* columns, MMFloat4 v, MMFloat4 t)
+            {
+                MMFloat4 result = MMVectorMul(columns[0], MMVectorSplatX(v));
+                result = MMVectorAdd(result, MMVectorMul(columns[1], MMVectorSplatY(v)));
+                result = MMVectorAdd(result, MMVectorMul(columns[2], MMVectorSplatZ(v)));
+                return MMVectorAdd(result, t);
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // AffineTransform
+        /////////////////////////////////////////////////////////
+
+        //Creates an identity transform
+        inline AffineTransform::AffineTransform()
+        {
+            MMFloat4 v = MMVectorSet(1, 0, 0, 0);
+            m_rows[0] = v;
+            m_rows[1] = MMVectorSwizzle<2, 0, 2, 2>(v);
+            m_rows[2] = MMVectorSwizzle<2, 2, 0, 2>(v);
+        }
+
+        //Creates a transform from 12 row-major values
+        inline AffineTransform::AffineTransform(const float rawArray[])
+        {
+            m_rows[0] = MMVectorLoadUnaligned(rawArray);
+            m_rows[1] = MMVectorLoadUnaligned(rawArray + 4);
+            m_rows[2] = MMVectorLoadUnaligned(rawArray + 8);
+        }
+
+        //Creates a transform from the top three rows, the w column is the translation
+        inline AffineTransform::AffineTransform(float xx, float xy, float xz, float xw,
+            float yx, float yy, float yz, float yw,
+            float zx, float zy, float zz, float zw)
+        {
+            m_rows[0] = MMVectorSet(xx, xy, xz, xw);
+            m_rows[1] = MMVectorSet(yx, yy, yz, yw);
+            m_rows[2] = MMVectorSet(zx, zy, zz, zw);
+        }
+
+        /** Takes the top three rows of a Matrix4
+        * NOTE: the bottom row is dropped, m should be affine
+        */
+        inline AffineTransform::AffineTransform(const Matrix4& m)
+        {
+            m_rows[0] = m.m_rows[0];
+            m_rows[1] = m.m_rows[1];
+            m_rows[2] = m.m_rows[2];
+        }
+
+        inline void* AffineTransform::operator new(size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void AffineTransform::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* AffineTransform::operator new[](size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void AffineTransform::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        /** Composes two transforms, same as multiplying the equivalent Matrix4s
+        * \param other The transform applied first
+        * \return this * other
+        */
+        inline AffineTransform AffineTransform::operator*(const AffineTransform& other) const
+        {
+            AffineTransform result;
+            result.m_rows[0] = Internal::MMAffineMultiplyRow(m_rows[0], other.m_rows);
+            result.m_rows[1] = Internal::MMAffineMultiplyRow(m_rows[1], other.m_rows);
+            result.m_rows[2] = Internal::MMAffineMultiplyRow(m_rows[2], other.m_rows);
+            return result;
+        }
+
+        inline AffineTransform& AffineTransform::operator*=(const AffineTransform& other)
+        {
+            return *this = *this * other;
+        }
+
+        //Expands to a Matrix4 with a (0, 0, 0, 1) bottom row
+        inline Matrix4 AffineTransform::ToMatrix4() const
+        {
+            Matrix4 result;
+            result.m_rows[0] = m_rows[0];
+            result.m_rows[1] = m_rows[1];
+            result.m_rows[2] = m_rows[2];
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM AffineTransform Operations
+        /////////////////////////////////////////////////////////
+
+        //Transforms a point, w = 1
+        inline Vector3 _MM_CALLCONV MMAffineTransformPoint(FAffineTransform a, FVector3 p)
+        {
+            MMFloat4 columns[4];
+            Internal::MMAffineColumns(a.m_rows, columns);
+
+            Vector3 result;
+            result.m_vector = Internal::MMAffineTransformColumns(columns, p.m_vector, columns[3]);
+            return result;
+        }
+
+        //Transforms a direction, w = 0, so the translation is ignored
+        inline Vector3 _MM_CALLCONV MMAffineTransformVector(FAffineTransform a, FVector3 v)
+        {
+            MMFloat4 columns[4];
+            Internal::MMAffineColumns(a.m_rows, columns);
+
+            Vector3 result;
+            result.m_vector = Internal::MMAffineTransformColumns(columns, v.m_vector, MMVectorZero());
+            return result;
+        }
+
+        /** Inverts an affine transform
+        * \param a Transform with a non singular 3x3 part
+        * \param determinant Receives the determinant of a when not null
+        * \return The inverse transform
+        */
+        inline AffineTransform _MM_CALLCONV MMAffineInverse(FAffineTransform a, float* determinant)
+        {
+            AffineTransform result;
+            MMFloat4 det = Internal::MMAffineInverseRows(a.m_rows, result.m_rows);
+            if (determinant)
+                *determinant = MMVectorGetX(det);
+            return result;
+        }
+
+        inline AffineTransform _MM_CALLCONV MMAffineTranslation(FVector3 t)
+        {
+            return AffineTransform(1, 0, 0, t.x,
+                                   0, 1, 0, t.y,
+                                   0, 0, 1, t.z);
+        }
+
+        inline AffineTransform _MM_CALLCONV MMAffineRotationQuaternion(FQuaternion q)
+        {
+            return AffineTransform(MMMatrixRotationQuaternion(q));
+        }
+
+        inline AffineTransform _MM_CALLCONV MMAffineScale(FVector3 s)
+        {
+            return AffineTransform(s.x, 0, 0, 0,
+                                   0, s.y, 0, 0,
+                                   0, 0, s.z, 0);
+        }
+
+        /** Repairs drift in the 3x3 part, see MMMatrixOrthonormalize
+        * \return a with orthonormal columns and the same translation
+        */
+        inline AffineTransform _MM_CALLCONV MMAffineOrthonormalize(FAffineTransform a)
+        {
+            AffineTransform result;
+            Internal::MMOrthonormalizeRows(a.m_rows, result.m_rows);
+            return result;
+        }
+
+        /** Writes a[i] * b[i] to out[i] for count elements
+        * out may alias a or b
+        */
+        inline void _MM_CALLCONV MMAffineMultiplyStream(AffineTransform* out, const AffineTransform* a, const AffineTransform* b, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineMultiplyStream");
+
+            for (size_t i = 0; i < count; i++)
+            {
+                MMFloat4 r0 = Internal::MMAffineMultiplyRow(a[i].m_rows[0], b[i].m_rows);
+                MMFloat4 r1 = Internal::MMAffineMultiplyRow(a[i].m_rows[1], b[i].m_rows);
+                MMFloat4 r2 = Internal::MMAffineMultiplyRow(a[i].m_rows[2], b[i].m_rows);
+                out[i].m_rows[0] = r0;
+                out[i].m_rows[1] = r1;
+                out[i].m_rows[2] = r2;
+            }
+        }
+
+        /** Writes MMAffineInverse(in[i]) to out[i] for count elements
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMAffineInverseStream(AffineTransform* out, const AffineTransform* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineInverseStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i] = MMAffineInverse(in[i]);
+        }
+
+        /** Transforms count points by one transform
+        * The columns are extracted once, each point then costs three multiplies and three adds.
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMAffineTransformPointStream(Vector3* out, FAffineTransform a, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineTransformPointStream");
+
+            MMFloat4 columns[4];
+            Internal::MMAffineColumns(a.m_rows, columns);
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = Internal::MMAffineTransformColumns(columns, in[i].m_vector, columns[3]);
+        }
+
+        /** Transforms count directions by one transform, ignoring the translation
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMAffineTransformVectorStream(Vector3* out, FAffineTransform a, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineTransformVectorStream");
+
+            MMFloat4 columns[4];
+            Internal::MMAffineColumns(a.m_rows, columns);
+
+            MMFloat4 zero = MMVectorZero();
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = Internal::MMAffineTransformColumns(columns, in[i].m_vector, zero);
+        }
+
+        /** Writes MMAffineOrthonormalize(in[i]) to out[i] for count elements
+        * wideLaneCount transforms are repaired at once, one transform per lane.
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMAffineOrthonormalizeStream(AffineTransform* out, const AffineTransform* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineOrthonormalizeStream");
+
+            Internal::MMOrthonormalizeStream(out, in, count);
+        }
+
+        //Expands count transforms into Matrix4s
+        inline void _MM_CALLCONV MMAffineToMatrix4Stream(Matrix4* out, const AffineTransform* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineToMatrix4Stream");
+
+            MMFloat4 bottom = MMVectorSet(0, 0, 0, 1);
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i].m_rows[0] = in[i].m_rows[0];
+                out[i].m_rows[1] = in[i].m_rows[1];
+                out[i].m_rows[2] = in[i].m_rows[2];
+                out[i].m_rows[3] = bottom;
+            }
+        }
+
+        //Packs count affine Matrix4s, dropping their bottom rows
+        inline void _MM_CALLCONV MMAffineFromMatrix4Stream(AffineTransform* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMAffineFromMatrix4Stream");
+
+            for (size_t i = 0; i < count; i++)
+            {
+                out[i].m_rows[0] = in[i].m_rows[0];
+                out[i].m_rows[1] = in[i].m_rows[1];
+                out[i].m_rows[2] = in[i].m_rows[2];
+            }
+        }
+    }
+}
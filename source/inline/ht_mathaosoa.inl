@@ -0,0 +1,368 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cassert>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        /////////////////////////////////////////////////////////
+        // MMWideTraits
+        /////////////////////////////////////////////////////////
+
+        inline Vector3 MMWideTraits<Vector3>::Gather(const float* base, size_t stride)
+        {
+            return Vector3(base[0], base[stride], base[2 * stride]);
+        }
+
+        inline void MMWideTraits<Vector3>::Scatter(float* base, size_t stride, const Vector3& v)
+        {
+            base[0] = v.x;
+            base[stride] = v.y;
+            base[2 * stride] = v.z;
+        }
+
+        inline Vector3Wide MMWideTraits<Vector3>::Load(const float* base, size_t stride)
+        {
+            return MMVector3WideLoad(base, base + stride, base + 2 * stride);
+        }
+
+        inline void MMWideTraits<Vector3>::Store(float* base, size_t stride, const Vector3Wide& v)
+        {
+            MMVector3WideStore(base, base + stride, base + 2 * stride, v);
+        }
+
+        inline Vector3Wide MMWideTraits<Vector3>::LoadAoS(const Vector3* src)
+        {
+            return MMVector3WideLoadAoS(src);
+        }
+
+        inline void MMWideTraits<Vector3>::StoreAoS(Vector3* dst, const Vector3Wide& v)
+        {
+            MMVector3WideStoreAoS(dst, v);
+        }
+
+        inline Vector4 MMWideTraits<Vector4>::Gather(const float* base, size_t stride)
+        {
+            return Vector4(base[0], base[stride], base[2 * stride], base[3 * stride]);
+        }
+
+        inline void MMWideTraits<Vector4>::Scatter(float* base, size_t stride, const Vector4& v)
+        {
+            base[0] = v.x;
+            base[stride] = v.y;
+            base[2 * stride] = v.z;
+            base[3 * stride] = v.w;
+        }
+
+        inline Vector4Wide MMWideTraits<Vector4>::Load(const float* base, size_t stride)
+        {
+            return MMVector4WideLoad(base, base + stride, base + 2 * stride, base + 3 * stride);
+        }
+
+        inline void MMWideTraits<Vector4>::Store(float* base, size_t stride, const Vector4Wide& v)
+        {
+            MMVector4WideStore(base, base + stride, base + 2 * stride, base + 3 * stride, v);
+        }
+
+        inline Vector4Wide MMWideTraits<Vector4>::LoadAoS(const Vector4* src)
+        {
+            return MMVector4WideLoadAoS(src);
+        }
+
+        inline void MMWideTraits<Vector4>::StoreAoS(Vector4* dst, const Vector4Wide& v)
+        {
+            MMVector4WideStoreAoS(dst, v);
+        }
+
+        inline Quaternion MMWideTraits<Quaternion>::Gather(const float* base, size_t stride)
+        {
+            return Quaternion(base[0], base[stride], base[2 * stride], base[3 * stride]);
+        }
+
+        inline void MMWideTraits<Quaternion>::Scatter(float* base, size_t stride, const Quaternion& q)
+        {
+            base[0] = q.x;
+            base[stride] = q.y;
+            base[2 * stride] = q.z;
+            base[3 * stride] = q.w;
+        }
+
+        inline QuaternionWide MMWideTraits<Quaternion>::Load(const float* base, size_t stride)
+        {
+            return MMQuaternionWideLoad(base, base + stride, base + 2 * stride, base + 3 * stride);
+        }
+
+        inline void MMWideTraits<Quaternion>::Store(float* base, size_t stride, const QuaternionWide& q)
+        {
+            MMQuaternionWideStore(base, base + stride, base + 2 * stride, base + 3 * stride, q);
+        }
+
+        inline QuaternionWide MMWideTraits<Quaternion>::LoadAoS(const Quaternion* src)
+        {
+            return MMQuaternionWideLoadAoS(src);
+        }
+
+        inline void MMWideTraits<Quaternion>::StoreAoS(Quaternion* dst, const QuaternionWide& q)
+        {
+            MMQuaternionWideStoreAoS(dst, q);
+        }
+
+        /////////////////////////////////////////////////////////
+        // AoSoAArray
+        /////////////////////////////////////////////////////////
+
+        template <typename T, size_t BlockWidth>
+        constexpr size_t AoSoAArray<T, BlockWidth>::components;
+        template <typename T, size_t BlockWidth>
+        constexpr size_t AoSoAArray<T, BlockWidth>::blockWidth;
+        template <typename T, size_t BlockWidth>
+        constexpr size_t AoSoAArray<T, BlockWidth>::widePerBlock;
+
+        //Creates an empty array
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>::AoSoAArray() : m_blocks(nullptr), m_size(0), m_blockCount(0) {}
+
+        //Creates count zero filled elements
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>::AoSoAArray(size_t count) : AoSoAArray()
+        {
+            Resize(count);
+        }
+
+        //Creates the array from count AoS elements
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>::AoSoAArray(const T* src, size_t count) : AoSoAArray()
+        {
+            Load(src, count);
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>::AoSoAArray(const AoSoAArray& other) : AoSoAArray()
+        {
+            *this = other;
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>::AoSoAArray(AoSoAArray&& other)
+            : m_blocks(other.m_blocks), m_size(other.m_size), m_blockCount(other.m_blockCount)
+        {
+            other.m_blocks = nullptr;
+            other.m_size = 0;
+            other.m_blockCount = 0;
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>::~AoSoAArray()
+        {
+            aligned_free(m_blocks);
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>& AoSoAArray<T, BlockWidth>::operator=(const AoSoAArray& other)
+        {
+            if (this != &other)
+            {
+                Resize(other.m_size);
+                if (m_blockCount > 0)
+                    memcpy(m_blocks, other.m_blocks, m_blockCount * sizeof(Block));
+            }
+            return *this;
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline AoSoAArray<T, BlockWidth>& AoSoAArray<T, BlockWidth>::operator=(AoSoAArray&& other)
+        {
+            if (this != &other)
+            {
+                aligned_free(m_blocks);
+                m_blocks = other.m_blocks;
+                m_size = other.m_size;
+                m_blockCount = other.m_blockCount;
+                other.m_blocks = nullptr;
+                other.m_size = 0;
+                other.m_blockCount = 0;
+            }
+            return *this;
+        }
+
+        /** Changes the number of elements
+        * Existing elements are kept, new elements and the padding lanes of the last block are zero.
+        * \param count The new element count
+        */
+        template <typename T, size_t BlockWidth>
+        inline void AoSoAArray<T, BlockWidth>::Resize(size_t count)
+        {
+            size_t blockCount = (count + BlockWidth - 1) / BlockWidth;
+            if (blockCount != m_blockCount)
+            {
+                Block* blocks = nullptr;
+                if (blockCount > 0)
+                {
+                    blocks = static_cast<Block*>(aligned_malloc(blockCount * sizeof(Block), cacheLineAlignment));
+                    assert(blocks != nullptr);
+
+                    size_t kept = blockCount < m_blockCount ? blockCount : m_blockCount;
+                    if (kept > 0)
+                        memcpy(blocks, m_blocks, kept * sizeof(Block));
+                    memset(blocks + kept, 0, (blockCount - kept) * sizeof(Block));
+                }
+
+                aligned_free(m_blocks);
+                m_blocks = blocks;
+                m_blockCount = blockCount;
+            }
+
+            //clear lanes that fell off the end so the padding invariant holds after shrinking
+            size_t lane = count % BlockWidth;
+            if (count < m_size && lane != 0)
+            {
+                Block& last = m_blocks[blockCount - 1];
+                for (size_t c = 0; c < components; c++)
+                    memset(&last.m_data[c][lane], 0, (BlockWidth - lane) * sizeof(float));
+            }
+
+            m_size = count;
+        }
+
+        //Number of elements
+        template <typename T, size_t BlockWidth>
+        inline size_t AoSoAArray<T, BlockWidth>::Size() const
+        {
+            return m_size;
+        }
+
+        //Number of BlockWidth element blocks
+        template <typename T, size_t BlockWidth>
+        inline size_t AoSoAArray<T, BlockWidth>::BlockCount() const
+        {
+            return m_blockCount;
+        }
+
+        //Number of wideLaneCount element groups needed to cover Size() elements
+        template <typename T, size_t BlockWidth>
+        inline size_t AoSoAArray<T, BlockWidth>::WideCount() const
+        {
+            return (m_size + wideLaneCount - 1) / wideLaneCount;
+        }
+
+        //Reads one element
+        template <typename T, size_t BlockWidth>
+        inline T AoSoAArray<T, BlockWidth>::Get(size_t index) const
+        {
+            assert(index < m_size);
+            return Traits::Gather(&m_blocks[index / BlockWidth].m_data[0][index % BlockWidth], BlockWidth);
+        }
+
+        //Writes one element, touching only its own block
+        template <typename T, size_t BlockWidth>
+        inline void AoSoAArray<T, BlockWidth>::Set(size_t index, const T& value)
+        {
+            assert(index < m_size);
+            Traits::Scatter(&m_blocks[index / BlockWidth].m_data[0][index % BlockWidth], BlockWidth, value);
+        }
+
+        //Start of the wideIndex-th lane group inside its block
+        template <typename T, size_t BlockWidth>
+        inline const float* AoSoAArray<T, BlockWidth>::WideBase(size_t wideIndex) const
+        {
+            assert(wideIndex < WideCount());
+            return &m_blocks[wideIndex / widePerBlock].m_data[0][(wideIndex % widePerBlock) * wideLaneCount];
+        }
+
+        //Loads elements [wideIndex * wideLaneCount, (wideIndex + 1) * wideLaneCount) into a wide view
+        template <typename T, size_t BlockWidth>
+        inline typename AoSoAArray<T, BlockWidth>::Wide AoSoAArray<T, BlockWidth>::LoadWide(size_t wideIndex) const
+        {
+            return Traits::Load(WideBase(wideIndex), BlockWidth);
+        }
+
+        //Writes a wide view back to elements [wideIndex * wideLaneCount, (wideIndex + 1) * wideLaneCount)
+        template <typename T, size_t BlockWidth>
+        inline void AoSoAArray<T, BlockWidth>::StoreWide(size_t wideIndex, const Wide& value)
+        {
+            Traits::Store(const_cast<float*>(WideBase(wideIndex)), BlockWidth, value);
+        }
+
+        /** Calls function(Wide&) for every lane group and writes the result back
+        * \param function Kernel applied to each wide view in order
+        */
+        template <typename T, size_t BlockWidth>
+        template <typename Function>
+        inline void AoSoAArray<T, BlockWidth>::ForEachWide(Function function)
+        {
+            size_t wideCount = WideCount();
+            for (size_t i = 0; i < wideCount; i++)
+            {
+                Wide view = LoadWide(i);
+                function(view);
+                StoreWide(i, view);
+            }
+        }
+
+        //Calls function(const Wide&) for every lane group
+        template <typename T, size_t BlockWidth>
+        template <typename Function>
+        inline void AoSoAArray<T, BlockWidth>::ForEachWide(Function function) const
+        {
+            size_t wideCount = WideCount();
+            for (size_t i = 0; i < wideCount; i++)
+                function(LoadWide(i));
+        }
+
+        /** Replaces the contents with count AoS elements
+        * Whole lane groups are transposed in registers, the tail is copied element by element.
+        */
+        template <typename T, size_t BlockWidth>
+        inline void AoSoAArray<T, BlockWidth>::Load(const T* src, size_t count)
+        {
+            Resize(count);
+
+            size_t groups = count / wideLaneCount;
+            for (size_t i = 0; i < groups; i++)
+                StoreWide(i, Traits::LoadAoS(src + i * wideLaneCount));
+
+            for (size_t i = groups * wideLaneCount; i < count; i++)
+                Set(i, src[i]);
+        }
+
+        //Writes all Size() elements out as AoS
+        template <typename T, size_t BlockWidth>
+        inline void AoSoAArray<T, BlockWidth>::Store(T* dst) const
+        {
+            size_t groups = m_size / wideLaneCount;
+            for (size_t i = 0; i < groups; i++)
+                Traits::StoreAoS(dst + i * wideLaneCount, LoadWide(i));
+
+            for (size_t i = groups * wideLaneCount; i < m_size; i++)
+                dst[i] = Get(i);
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline typename AoSoAArray<T, BlockWidth>::Block* AoSoAArray<T, BlockWidth>::Blocks()
+        {
+            return m_blocks;
+        }
+
+        template <typename T, size_t BlockWidth>
+        inline const typename AoSoAArray<T, BlockWidth>::Block* AoSoAArray<T, BlockWidth>::Blocks() const
+        {
+            return m_blocks;
+        }
+    }
+}
@@ -0,0 +1,280 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cstring>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        /////////////////////////////////////////////////////////
+        // Camera
+        /////////////////////////////////////////////////////////
+
+        //Creates a camera at the origin looking down -z with a 60 degree square perspective
+        inline Camera::Camera()
+            : m_depth(MM_DEPTH_NEGATIVE_ONE_TO_ONE),
+              m_perspective(true),
+              m_viewVersion(0),
+              m_projectionVersion(0),
+              m_dirty(DIRTY_VIEW | DIRTY_PROJECTION | DIRTY_VIEW_PROJECTION | DIRTY_FRUSTUM)
+        {
+            const float params[6] = { Pi / 3.0f, 1.0f, 1.0f, 0.1f, 1000.0f, 0.0f };
+            memcpy(m_projectionParams, params, sizeof(params));
+        }
+
+        inline void* Camera::operator new(size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void Camera::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* Camera::operator new[](size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void Camera::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void Camera::SetPosition(const Vector3& position)
+        {
+            if (MMVectorEqual(position.m_vector, m_position.m_vector))
+                return;
+
+            m_position = position;
+            m_viewVersion++;
+            m_dirty |= DIRTY_VIEW | DIRTY_VIEW_PROJECTION | DIRTY_FRUSTUM;
+        }
+
+        inline void Camera::SetOrientation(const Quaternion& orientation)
+        {
+            if (MMVectorEqual(orientation.m_quaternion, m_orientation.m_quaternion))
+                return;
+
+            m_orientation = orientation;
+            m_viewVersion++;
+            m_dirty |= DIRTY_VIEW | DIRTY_VIEW_PROJECTION | DIRTY_FRUSTUM;
+        }
+
+        /** Places the camera at eye facing target
+        * \param eye The point that the camera is located
+        * \param target The point for the camera to look at
+        * \param up The vector representing which way is up for this camera
+        */
+        inline void Camera::LookAt(const Vector3& eye, const Vector3& target, const Vector3& up)
+        {
+            //MMMatrixLookAt builds a mirrored basis, a rotation needs x = up cross z
+            Vector3 zAxis = MMVector3Normalized(eye - target);
+            Vector3 xAxis = MMVector3Normalized(MMVector3Cross(up, zAxis));
+            Vector3 yAxis = MMVector3Cross(zAxis, xAxis);
+
+            //the axes are the columns of the camera's world rotation
+            SetPosition(eye);
+            SetOrientation(MMQuaternionFromMatrix3(MMMatrix3Transpose(Matrix3(xAxis, yAxis, zAxis))));
+        }
+
+        /** Switches to a perspective projection
+        * A zfar of infinity builds MMMatrixPerspProjInfinite, the far plane of the
+        * frustum is then degenerate and should not be used for culling.
+        */
+        inline void Camera::SetPerspective(float fov, float width, float height, float znear, float zfar, MMDepthRange depth)
+        {
+            const float params[6] = { fov, width, height, znear, zfar, 0.0f };
+            SetProjection(true, params, depth);
+        }
+
+        inline void Camera::SetOrthographic(float left, float right, float bottom, float top, float znear, float zfar, MMDepthRange depth)
+        {
+            const float params[6] = { left, right, bottom, top, znear, zfar };
+            SetProjection(false, params, depth);
+        }
+
+        inline void Camera::SetProjection(bool perspective, const float* params, MMDepthRange depth)
+        {
+            if (perspective == m_perspective && depth == m_depth &&
+                memcmp(params, m_projectionParams, sizeof(m_projectionParams)) == 0)
+                return;
+
+            m_perspective = perspective;
+            m_depth = depth;
+            memcpy(m_projectionParams, params, sizeof(m_projectionParams));
+            m_projectionVersion++;
+            m_dirty |= DIRTY_PROJECTION | DIRTY_VIEW_PROJECTION | DIRTY_FRUSTUM;
+        }
+
+        inline const Vector3& Camera::Position() const
+        {
+            return m_position;
+        }
+
+        inline const Quaternion& Camera::Orientation() const
+        {
+            return m_orientation;
+        }
+
+        inline MMDepthRange Camera::DepthRange() const
+        {
+            return m_depth;
+        }
+
+        inline bool Camera::IsPerspective() const
+        {
+            return m_perspective;
+        }
+
+        inline const Matrix4& Camera::View() const
+        {
+            if (m_dirty & DIRTY_VIEW)
+                UpdateView();
+            return m_view;
+        }
+
+        inline const Matrix4& Camera::InverseView() const
+        {
+            if (m_dirty & DIRTY_VIEW)
+                UpdateView();
+            return m_inverseView;
+        }
+
+        inline const Matrix4& Camera::Projection() const
+        {
+            if (m_dirty & DIRTY_PROJECTION)
+                UpdateProjection();
+            return m_projection;
+        }
+
+        inline const Matrix4& Camera::InverseProjection() const
+        {
+            if (m_dirty & DIRTY_PROJECTION)
+                UpdateProjection();
+            return m_inverseProjection;
+        }
+
+        inline const Matrix4& Camera::ViewProjection() const
+        {
+            if (m_dirty & DIRTY_VIEW_PROJECTION)
+                UpdateViewProjection();
+            return m_viewProjection;
+        }
+
+        inline const Matrix4& Camera::InverseViewProjection() const
+        {
+            if (m_dirty & DIRTY_VIEW_PROJECTION)
+                UpdateViewProjection();
+            return m_inverseViewProjection;
+        }
+
+        //The six planes indexed by FrustumPlane, in the space the view matrix maps from
+        inline const Vector4* Camera::FrustumPlanes() const
+        {
+            if (m_dirty & DIRTY_FRUSTUM)
+                UpdateFrustum();
+            return m_frustum;
+        }
+
+        inline uint32_t Camera::ViewVersion() const
+        {
+            return m_viewVersion;
+        }
+
+        inline uint32_t Camera::ProjectionVersion() const
+        {
+            return m_projectionVersion;
+        }
+
+        //Changes whenever either the view or the projection changes
+        inline uint32_t Camera::Version() const
+        {
+            return m_viewVersion + m_projectionVersion;
+        }
+
+        inline void Camera::UpdateView() const
+        {
+            //the camera's world transform is rigid, so the view is its orthonormal inverse
+            m_inverseView = MMMatrixRotationQuaternion(m_orientation);
+            m_inverseView.m_rows[0] = MMVectorSetW(m_inverseView.m_rows[0], m_position.x);
+            m_inverseView.m_rows[1] = MMVectorSetW(m_inverseView.m_rows[1], m_position.y);
+            m_inverseView.m_rows[2] = MMVectorSetW(m_inverseView.m_rows[2], m_position.z);
+            m_view = MMMatrixInverseOrthonormal(m_inverseView);
+            m_dirty &= ~DIRTY_VIEW;
+        }
+
+        inline void Camera::UpdateProjection() const
+        {
+            const float* p = m_projectionParams;
+            if (!m_perspective)
+                m_projection = MMMatrixOrthoProj(p[0], p[1], p[2], p[3], p[4], p[5], m_depth, &m_inverseProjection);
+            else if (std::isinf(p[4]))
+                m_projection = MMMatrixPerspProjInfinite(p[0], p[1], p[2], p[3], m_depth, &m_inverseProjection);
+            else
+                m_projection = MMMatrixPerspProj(p[0], p[1], p[2], p[3], p[4], m_depth, &m_inverseProjection);
+            m_dirty &= ~DIRTY_PROJECTION;
+        }
+
+        inline void Camera::UpdateViewProjection() const
+        {
+            //both inverses are closed form, so the product of them replaces a general inverse
+            m_viewProjection = Projection() * View();
+            m_inverseViewProjection = InverseView() * InverseProjection();
+            m_dirty &= ~DIRTY_VIEW_PROJECTION;
+        }
+
+        inline void Camera::UpdateFrustum() const
+        {
+            const Matrix4& vp = ViewProjection();
+            MMFloat4 r0 = vp.m_rows[0];
+            MMFloat4 r1 = vp.m_rows[1];
+            MMFloat4 r2 = vp.m_rows[2];
+            MMFloat4 r3 = vp.m_rows[3];
+
+            //clip space bounds -w <= x <= w etc. written as row combinations
+            MMFloat4 planes[FRUSTUM_PLANE_COUNT];
+            planes[FRUSTUM_LEFT] = MMVectorAdd(r3, r0);
+            planes[FRUSTUM_RIGHT] = MMVectorSub(r3, r0);
+            planes[FRUSTUM_BOTTOM] = MMVectorAdd(r3, r1);
+            planes[FRUSTUM_TOP] = MMVectorSub(r3, r1);
+            if (m_depth == MM_DEPTH_REVERSED)
+            {
+                planes[FRUSTUM_NEAR] = MMVectorSub(r3, r2);
+                planes[FRUSTUM_FAR] = r2;
+            }
+            else
+            {
+                planes[FRUSTUM_NEAR] = m_depth == MM_DEPTH_ZERO_TO_ONE ? r2 : MMVectorAdd(r3, r2);
+                planes[FRUSTUM_FAR] = MMVectorSub(r3, r2);
+            }
+
+            //scale to unit normals, a degenerate infinite far plane is left as is
+            const MMFloat4 zero = MMVectorZero();
+            for (uint32_t i = 0; i < FRUSTUM_PLANE_COUNT; i++)
+            {
+                MMFloat4 lengthSqr = Internal::MMVectorDot3V(planes[i], planes[i]);
+                MMMask4 degenerate = MMVectorCompareEqual(lengthSqr, zero);
+                MMFloat4 invLength = MMVectorReciprocalSqrt(MMVectorSelect(degenerate, MMVectorSplat(1.0f), lengthSqr));
+                m_frustum[i].m_vector = MMVectorMul(planes[i], invLength);
+            }
+            m_dirty &= ~DIRTY_FRUSTUM;
+        }
+    }
+}
@@ -0,0 +1,196 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cassert>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        ///////////////////////////////////////////////////////////
+        // MMDenormalGuard definition
+        ///////////////////////////////////////////////////////////
+
+        //Enables both flush-to-zero and denormals-are-zero
+        inline MMDenormalGuard::MMDenormalGuard()
+            : MMDenormalGuard(MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO) {}
+
+        /** Enables a custom subset of the denormal mode bits
+        * \param modeBits Any combination of MM_CONTROL_FLUSH_TO_ZERO and MM_CONTROL_DENORMALS_ARE_ZERO
+        */
+        inline MMDenormalGuard::MMDenormalGuard(uint32_t modeBits)
+        {
+            assert((modeBits & ~(MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO)) == 0);
+            uint32_t csr = MMGetControlStatus();
+            m_previous = csr & (MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO);
+            MMSetControlStatus(csr | modeBits);
+        }
+
+        //Puts the FTZ/DAZ bits back the way they were, other MXCSR state is left alone
+        inline MMDenormalGuard::~MMDenormalGuard()
+        {
+            uint32_t csr = MMGetControlStatus() & ~(MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO);
+            MMSetControlStatus(csr | m_previous);
+        }
+
+        ///////////////////////////////////////////////////////////
+        // Per-thread helpers
+        ///////////////////////////////////////////////////////////
+
+        /** Enables FTZ and DAZ on the calling thread until explicitly restored
+        * Call this at the top of every worker thread, MXCSR is not shared between threads.
+        * \return The previous FTZ/DAZ bits to hand to MMDenormalFlushRestore
+        */
+        inline uint32_t _MM_CALLCONV MMDenormalFlushInstall()
+        {
+            uint32_t csr = MMGetControlStatus();
+            MMSetControlStatus(csr | MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO);
+            return csr & (MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO);
+        }
+
+        //Restores the FTZ/DAZ bits returned by MMDenormalFlushInstall
+        inline void _MM_CALLCONV MMDenormalFlushRestore(uint32_t previous)
+        {
+            uint32_t csr = MMGetControlStatus() & ~(MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO);
+            MMSetControlStatus(csr | (previous & (MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO)));
+        }
+
+        //Returns true if the calling thread flushes denormal results and inputs to zero
+        inline bool _MM_CALLCONV MMDenormalFlushEnabled()
+        {
+            const uint32_t bits = MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO;
+            return (MMGetControlStatus() & bits) == bits;
+        }
+
+        //Wraps function so it always runs with FTZ and DAZ enabled
+        template <typename Function>
+        inline MMDenormalFlushTask<Function> MMMakeDenormalFlushTask(Function function)
+        {
+            return MMDenormalFlushTask<Function>(std::move(function));
+        }
+
+        ///////////////////////////////////////////////////////////
+        // MMDenormalCounter definition
+        ///////////////////////////////////////////////////////////
+
+        //Creates a zeroed counter and links it into the global counter list
+        inline MMDenormalCounter::MMDenormalCounter(const char* stage)
+            : m_stage(stage), m_samples(0), m_denormalInputs(0), m_underflows(0), m_next(nullptr)
+        {
+            std::atomic<MMDenormalCounter*>& head = Head();
+            m_next = head.load(std::memory_order_relaxed);
+            while (!head.compare_exchange_weak(m_next, this, std::memory_order_release, std::memory_order_relaxed))
+                ;
+        }
+
+        /** Adds one sample of MXCSR flags to the counter
+        * \param flags MXCSR value, only MM_CONTROL_DENORMAL_FLAG and MM_CONTROL_UNDERFLOW_FLAG are looked at
+        */
+        inline void MMDenormalCounter::Record(uint32_t flags)
+        {
+            m_samples.fetch_add(1, std::memory_order_relaxed);
+            if (flags & MM_CONTROL_DENORMAL_FLAG)
+                m_denormalInputs.fetch_add(1, std::memory_order_relaxed);
+            if (flags & MM_CONTROL_UNDERFLOW_FLAG)
+                m_underflows.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        inline void MMDenormalCounter::Reset()
+        {
+            m_samples.store(0, std::memory_order_relaxed);
+            m_denormalInputs.store(0, std::memory_order_relaxed);
+            m_underflows.store(0, std::memory_order_relaxed);
+        }
+
+        inline const char* MMDenormalCounter::Stage() const
+        {
+            return m_stage;
+        }
+
+        //Number of times the stage was sampled
+        inline uint64_t MMDenormalCounter::Samples() const
+        {
+            return m_samples.load(std::memory_order_relaxed);
+        }
+
+        //Samples in which the stage read a denormal operand (never raised while DAZ is on)
+        inline uint64_t MMDenormalCounter::DenormalInputs() const
+        {
+            return m_denormalInputs.load(std::memory_order_relaxed);
+        }
+
+        //Samples in which the stage produced a result too small for a normal float
+        inline uint64_t MMDenormalCounter::Underflows() const
+        {
+            return m_underflows.load(std::memory_order_relaxed);
+        }
+
+        inline const MMDenormalCounter* MMDenormalCounter::Next() const
+        {
+            return m_next;
+        }
+
+        //Most recently registered counter, walk the rest with Next()
+        inline const MMDenormalCounter* MMDenormalCounter::First()
+        {
+            return Head().load(std::memory_order_acquire);
+        }
+
+        inline std::atomic<MMDenormalCounter*>& MMDenormalCounter::Head()
+        {
+            static std::atomic<MMDenormalCounter*> head(nullptr);
+            return head;
+        }
+
+        ///////////////////////////////////////////////////////////
+        // MMDenormalSampleScope definition
+        ///////////////////////////////////////////////////////////
+
+        inline MMDenormalSampleScope::MMDenormalSampleScope(MMDenormalCounter& counter)
+            : m_counter(counter)
+        {
+            const uint32_t flagBits = MM_CONTROL_DENORMAL_FLAG | MM_CONTROL_UNDERFLOW_FLAG;
+            uint32_t csr = MMGetControlStatus();
+            m_savedFlags = csr & flagBits;
+            MMSetControlStatus(csr & ~flagBits);
+        }
+
+        inline MMDenormalSampleScope::~MMDenormalSampleScope()
+        {
+            uint32_t csr = MMGetControlStatus();
+            m_counter.Record(csr);
+            MMSetControlStatus(csr | m_savedFlags);
+        }
+
+        /** Writes every registered counter that saw denormals as "stage: inputs/underflows/samples"
+        * \param output The ostream to write to
+        */
+        inline void MMDenormalReport(std::ostream& output)
+        {
+            for (const MMDenormalCounter* counter = MMDenormalCounter::First(); counter; counter = counter->Next())
+            {
+                if (counter->DenormalInputs() == 0 && counter->Underflows() == 0)
+                    continue;
+
+                output << counter->Stage() << ": "
+                       << counter->DenormalInputs() << " denormal inputs, "
+                       << counter->Underflows() << " underflows in "
+                       << counter->Samples() << " samples" << std::endl;
+            }
+        }
+    }
+}
@@ -0,0 +1,299 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+namespace Hatchit {
+
+    namespace Math {
+
+        namespace Internal
+        {
+            //Vector part of 2 * dual * conjugate(real), the translation of a unit dual quaternion
+            inline MMFloat4 _MM_CALLCONV MMDualQuaternionTranslation(MMFloat4 real, MMFloat4 dual)
+            {
+                MMFloat4 t = MMVectorMul(MMVectorSplatW(real), dual);
+                t = MMVectorSub(t, MMVectorMul(MMVectorSplatW(dual), real));
+                t = MMVectorAdd(t, MMVectorCross3(real, dual));
+                return MMVectorAdd(t, t);
+            }
+
+            //Rotates the xyz lanes of v by the unit quaternion q, the w lane of v is kept
+            inline MMFloat4 _MM_CALLCONV MMQuaternionRotate3(MMFloat4 q, MMFloat4 v)
+            {
+                MMFloat4 t = MMVectorCross3(q, v);
+                t = MMVectorAdd(t, t);
+                MMFloat4 result = MMVectorAdd(v, MMVectorMul(MMVectorSplatW(q), t));
+                return MMVectorAdd(result, MMVectorCross3(q, t));
+            }
+
+            //acc += q * weight for every component
+            inline void _MM_CALLCONV MMQuaternionWideMulAdd(QuaternionWide& acc, const QuaternionWide& q, MMFloatW weight)
+            {
+                acc.x = MMWideAdd(acc.x, MMWideMul(q.x, weight));
+                acc.y = MMWideAdd(acc.y, MMWideMul(q.y, weight));
+                acc.z = MMWideAdd(acc.z, MMWideMul(q.z, weight));
+                acc.w = MMWideAdd(acc.w, MMWideMul(q.w, weight));
+            }
+
+            inline QuaternionWide _MM_CALLCONV MMQuaternionWideScale(const QuaternionWide& q, MMFloatW s)
+            {
+                return QuaternionWide(MMWideMul(q.x, s), MMWideMul(q.y, s), MMWideMul(q.z, s), MMWideMul(q.w, s));
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // DualQuaternion
+        /////////////////////////////////////////////////////////
+
+        //Creates the identity transform
+        inline DualQuaternion::DualQuaternion()
+            : m_real(), m_dual(MMVectorZero())
+        {
+        }
+
+        //Creates a dual quaternion from its raw parts
+        inline DualQuaternion::DualQuaternion(const Quaternion& real, const Quaternion& dual)
+            : m_real(real), m_dual(dual)
+        {
+        }
+
+        /** Creates the rigid transform that rotates and then translates
+        * \param rotation Unit rotation
+        * \param translation Translation applied after the rotation
+        */
+        inline DualQuaternion::DualQuaternion(const Quaternion& rotation, const Vector3& translation)
+            : m_real(rotation)
+        {
+            //dual = 0.5 * (t, 0) * rotation
+            static const MMFloat4 maskXYZ = MMVectorSetInt(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0);
+            Quaternion t(MMVectorMul(MMVectorAnd(translation.m_vector, maskXYZ), MMVectorSplat(0.5f)));
+            m_dual = t * rotation;
+        }
+
+        inline void* DualQuaternion::operator new(size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void DualQuaternion::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* DualQuaternion::operator new[](size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void DualQuaternion::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        /** Composes two transforms, other is applied first
+        * \param other The transform applied before this one
+        * \return this * other as a DualQuaternion
+        */
+        inline DualQuaternion DualQuaternion::operator*(const DualQuaternion& other) const
+        {
+            Quaternion dual = m_real * other.m_dual;
+            dual += m_dual * other.m_real;
+            return DualQuaternion(m_real * other.m_real, dual);
+        }
+
+        inline DualQuaternion& DualQuaternion::operator*=(const DualQuaternion& other)
+        {
+            return *this = *this * other;
+        }
+
+        //Expands a unit dual quaternion to a rotation and translation Matrix4
+        inline Matrix4 DualQuaternion::ToMatrix4() const
+        {
+            static const MMFloat4 maskW = MMVectorSetInt(0, 0, 0, 0xFFFFFFFF);
+            MMFloat4 t = Internal::MMDualQuaternionTranslation(m_real.m_quaternion, m_dual.m_quaternion);
+
+            Matrix4 result = MMMatrixRotationQuaternion(m_real);
+            result.m_rows[0] = MMVectorSelect(maskW, MMVectorSplatX(t), result.m_rows[0]);
+            result.m_rows[1] = MMVectorSelect(maskW, MMVectorSplatY(t), result.m_rows[1]);
+            result.m_rows[2] = MMVectorSelect(maskW, MMVectorSplatZ(t), result.m_rows[2]);
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM DualQuaternion Operations
+        /////////////////////////////////////////////////////////
+
+        /** Scales dq so its real part has unit length
+        * Blended dual quaternions only need this division to be rigid transforms again.
+        */
+        inline DualQuaternion _MM_CALLCONV MMDualQuaternionNormalize(FDualQuaternion dq)
+        {
+            assert(MMQuaternionMagnitudeSqr(dq.m_real) > 0.0f);
+            MMFloat4 invLength = MMVectorReciprocalSqrt(MMQuaternionDotV(dq.m_real, dq.m_real), MMPrecisionDefault());
+            return DualQuaternion(Quaternion(MMVectorMul(dq.m_real.m_quaternion, invLength)),
+                                  Quaternion(MMVectorMul(dq.m_dual.m_quaternion, invLength)));
+        }
+
+        //Conjugates both parts, for a unit dual quaternion this is the inverse transform
+        inline DualQuaternion _MM_CALLCONV MMDualQuaternionConjugate(FDualQuaternion dq)
+        {
+            return DualQuaternion(MMQuaternionConjugate(dq.m_real), MMQuaternionConjugate(dq.m_dual));
+        }
+
+        //Reads the rotation and translation of a rigid Matrix4
+        inline DualQuaternion _MM_CALLCONV MMDualQuaternionFromMatrix(FMatrix4 m)
+        {
+            Vector3 translation;
+            translation.m_vector = MMVectorShuffle<2, 3, 3, 0>(MMVectorMergeZW(m.m_rows[0], m.m_rows[1]),
+                                                              MMVectorAnd(m.m_rows[2], MMVectorSetInt(0, 0, 0, 0xFFFFFFFF)));
+            return DualQuaternion(MMQuaternionFromMatrix(m), translation);
+        }
+
+        inline Vector3 _MM_CALLCONV MMDualQuaternionGetTranslation(FDualQuaternion dq)
+        {
+            Vector3 result;
+            result.m_vector = Internal::MMDualQuaternionTranslation(dq.m_real.m_quaternion, dq.m_dual.m_quaternion);
+            return result;
+        }
+
+        inline Vector3 _MM_CALLCONV MMDualQuaternionTransformPoint(FDualQuaternion dq, FVector3 p)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorAdd(Internal::MMQuaternionRotate3(dq.m_real.m_quaternion, p.m_vector),
+                                          Internal::MMDualQuaternionTranslation(dq.m_real.m_quaternion, dq.m_dual.m_quaternion));
+            return result;
+        }
+
+        //Rotates v, directions ignore the translation
+        inline Vector3 _MM_CALLCONV MMDualQuaternionTransformVector(FDualQuaternion dq, FVector3 v)
+        {
+            Vector3 result;
+            result.m_vector = Internal::MMQuaternionRotate3(dq.m_real.m_quaternion, v.m_vector);
+            return result;
+        }
+
+        /** Blends the bones influencing one vertex
+        * Bones whose real part points away from the first bone's are negated so the
+        * blend takes the short path, then the sum is normalized.
+        * \param palette Bone transforms
+        * \param indices influences palette indices
+        * \param weights influences blend weights
+        * \param influences Number of bones affecting the vertex, at least one
+        * \return The normalized blended transform
+        */
+        inline DualQuaternion _MM_CALLCONV MMDualQuaternionBlend(const DualQuaternion* palette, const uint32_t* indices,
+                                                                 const float* weights, size_t influences)
+        {
+            assert(influences > 0);
+            static const MMFloat4 signMask = MMVectorSetInt(0x80000000, 0x80000000, 0x80000000, 0x80000000);
+
+            const DualQuaternion& pivot = palette[indices[0]];
+            MMFloat4 real = MMVectorZero();
+            MMFloat4 dual = MMVectorZero();
+            for (size_t k = 0; k < influences; k++)
+            {
+                const DualQuaternion& bone = palette[indices[k]];
+                MMFloat4 flip = MMVectorAnd(MMQuaternionDotV(pivot.m_real, bone.m_real), signMask);
+                MMFloat4 weight = MMVectorXor(MMVectorSplat(weights[k]), flip);
+                real = MMVectorAdd(real, MMVectorMul(bone.m_real.m_quaternion, weight));
+                dual = MMVectorAdd(dual, MMVectorMul(bone.m_dual.m_quaternion, weight));
+            }
+            return MMDualQuaternionNormalize(DualQuaternion(Quaternion(real), Quaternion(dual)));
+        }
+
+        /** Blends count vertices whose influences are stored as SoA streams
+        * Influence k of vertex i is indices[k * count + i] with weight weights[k * count + i].
+        * wideLaneCount vertices are blended at once, gathering their bones into wide registers.
+        * \param out Receives count normalized transforms
+        * \param palette Bone transforms, 8 floats each
+        * \param influences Number of index and weight streams
+        */
+        inline void _MM_CALLCONV MMDualQuaternionBlendStream(DualQuaternion* out, const DualQuaternion* palette, const uint32_t* indices,
+                                                             const float* weights, size_t influences, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMDualQuaternionBlendStream");
+            assert(influences > 0);
+
+            const MMFloatW zero = MMWideZero();
+            const MMFloatW signBit = MMWideSplat(-0.0f);
+
+            Quaternion real[wideLaneCount];
+            Quaternion dual[wideLaneCount];
+
+            size_t i = 0;
+            for (; i + wideLaneCount <= count; i += wideLaneCount)
+            {
+                QuaternionWide pivot;
+                QuaternionWide accReal(zero, zero, zero, zero);
+                QuaternionWide accDual(zero, zero, zero, zero);
+                for (size_t k = 0; k < influences; k++)
+                {
+                    const uint32_t* laneIndices = indices + k * count + i;
+                    for (size_t lane = 0; lane < wideLaneCount; lane++)
+                    {
+                        real[lane] = palette[laneIndices[lane]].m_real;
+                        dual[lane] = palette[laneIndices[lane]].m_dual;
+                    }
+                    QuaternionWide boneReal = MMQuaternionWideLoadAoS(real);
+                    QuaternionWide boneDual = MMQuaternionWideLoadAoS(dual);
+
+                    MMFloatW weight = MMWideLoadUnaligned(weights + k * count + i);
+                    if (k == 0)
+                        pivot = boneReal;
+                    else
+                        weight = MMWideXor(weight, MMWideAnd(MMQuaternionWideDot(pivot, boneReal), signBit));
+
+                    Internal::MMQuaternionWideMulAdd(accReal, boneReal, weight);
+                    Internal::MMQuaternionWideMulAdd(accDual, boneDual, weight);
+                }
+
+                MMFloatW invLength = MMWideReciprocalSqrt(MMQuaternionWideDot(accReal, accReal), MMPrecisionDefault());
+                MMQuaternionWideStoreAoS(real, Internal::MMQuaternionWideScale(accReal, invLength));
+                MMQuaternionWideStoreAoS(dual, Internal::MMQuaternionWideScale(accDual, invLength));
+                for (size_t lane = 0; lane < wideLaneCount; lane++)
+                {
+                    out[i + lane].m_real = real[lane];
+                    out[i + lane].m_dual = dual[lane];
+                }
+            }
+
+            //tail, gather the strided influences of each remaining vertex
+            uint32_t vertexIndices[16];
+            float vertexWeights[16];
+            assert(i == count || influences <= 16);
+            for (; i < count; i++)
+            {
+                for (size_t k = 0; k < influences; k++)
+                {
+                    vertexIndices[k] = indices[k * count + i];
+                    vertexWeights[k] = weights[k * count + i];
+                }
+                out[i] = MMDualQuaternionBlend(palette, vertexIndices, vertexWeights, influences);
+            }
+        }
+
+        /** Transforms in[i] by dq[i] for count elements
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMDualQuaternionTransformPointStream(Vector3* out, const DualQuaternion* dq, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMDualQuaternionTransformPointStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i] = MMDualQuaternionTransformPoint(dq[i], in[i]);
+        }
+    }
+}
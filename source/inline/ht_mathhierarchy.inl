@@ -0,0 +1,403 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cassert>
+#include <algorithm>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        namespace Internal
+        {
+            //Top three rows of translation * rotation * scale
+            inline void _MM_CALLCONV MMTransformLocalRows(const Vector3& t, const Quaternion& r, const Vector3& s, MMFloat4* rows)
+            {
+                static const MMFloat4 maskW = MMVectorSetInt(0, 0, 0, 0xFFFFFFFF);
+
+                //scaling the columns of the rotation is a lane-wise multiply of every row
+                Matrix4 rotation = MMMatrixRotationQuaternion(r);
+                rows[0] = MMVectorSelect(maskW, MMVectorSplatX(t.m_vector), MMVectorMul(rotation.m_rows[0], s.m_vector));
+                rows[1] = MMVectorSelect(maskW, MMVectorSplatY(t.m_vector), MMVectorMul(rotation.m_rows[1], s.m_vector));
+                rows[2] = MMVectorSelect(maskW, MMVectorSplatZ(t.m_vector), MMVectorMul(rotation.m_rows[2], s.m_vector));
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // TransformHierarchy
+        /////////////////////////////////////////////////////////
+
+        inline TransformHierarchy::TransformHierarchy()
+            : m_levelBegin(1, 0),
+              m_anyDirty(false),
+              m_unsorted(false)
+        {
+        }
+
+        //Adds an identity node under parent, or a new root for invalidTransformNode
+        inline TransformNode TransformHierarchy::Add(TransformNode parent)
+        {
+            return Add(parent, Vector3(), Quaternion(), Vector3(1.0f, 1.0f, 1.0f));
+        }
+
+        /** Adds a node under parent with the given local transform
+        * \param parent Handle of the parent node, invalidTransformNode adds a root
+        * \return Handle of the new node
+        */
+        inline TransformNode TransformHierarchy::Add(TransformNode parent, const Vector3& translation,
+                                                     const Quaternion& rotation, const Vector3& scale)
+        {
+            uint32_t index = static_cast<uint32_t>(m_parent.size());
+            uint32_t parentIndex = parent == invalidTransformNode ? invalidTransformNode : IndexOf(parent);
+            uint32_t depth = parentIndex == invalidTransformNode ? 0 : m_depth[parentIndex] + 1;
+
+            //appending keeps the levels contiguous unless a deeper level already exists
+            if (m_unsorted || (index > 0 && depth < m_depth.back()))
+                m_unsorted = true;
+            else
+            {
+                if (depth == m_levelBegin.size() - 1)
+                    m_levelBegin.push_back(m_levelBegin.back());
+                m_levelBegin.back()++;
+            }
+
+            TransformNode handle = static_cast<TransformNode>(m_index.size());
+            m_index.push_back(index);
+            m_handle.push_back(handle);
+            m_parent.push_back(parentIndex);
+            m_depth.push_back(depth);
+            m_translation.push_back(translation);
+            m_rotation.push_back(rotation);
+            m_scale.push_back(scale);
+            m_world.push_back(Matrix4());
+            m_dirty.push_back(0);
+            MarkDirty(index);
+            return handle;
+        }
+
+        /** Moves node and its subtree under a new parent
+        * The arrays are re-sorted on the next Update.
+        * \param node Handle of the node to move
+        * \param parent Handle of the new parent, invalidTransformNode makes node a root
+        */
+        inline void TransformHierarchy::Reparent(TransformNode node, TransformNode parent)
+        {
+            uint32_t index = IndexOf(node);
+            uint32_t parentIndex = parent == invalidTransformNode ? invalidTransformNode : IndexOf(parent);
+
+#ifndef NDEBUG
+            for (uint32_t p = parentIndex; p != invalidTransformNode; p = m_parent[p])
+                assert(p != index && "TransformHierarchy::Reparent would create a cycle");
+#endif
+
+            m_parent[index] = parentIndex;
+            m_unsorted = true;
+            MarkDirty(index);
+        }
+
+        inline void TransformHierarchy::Reserve(size_t count)
+        {
+            m_translation.reserve(count);
+            m_rotation.reserve(count);
+            m_scale.reserve(count);
+            m_world.reserve(count);
+            m_parent.reserve(count);
+            m_depth.reserve(count);
+            m_dirty.reserve(count);
+            m_handle.reserve(count);
+            m_index.reserve(count);
+        }
+
+        //Removes every node, previously returned handles become invalid
+        inline void TransformHierarchy::Clear()
+        {
+            m_translation.clear();
+            m_rotation.clear();
+            m_scale.clear();
+            m_world.clear();
+            m_parent.clear();
+            m_depth.clear();
+            m_dirty.clear();
+            m_handle.clear();
+            m_index.clear();
+            m_levelBegin.assign(1, 0);
+            m_anyDirty = false;
+            m_unsorted = false;
+        }
+
+        inline void TransformHierarchy::SetLocal(TransformNode node, const Vector3& translation,
+                                                 const Quaternion& rotation, const Vector3& scale)
+        {
+            uint32_t index = IndexOf(node);
+            m_translation[index] = translation;
+            m_rotation[index] = rotation;
+            m_scale[index] = scale;
+            MarkDirty(index);
+        }
+
+        inline void TransformHierarchy::SetTranslation(TransformNode node, const Vector3& translation)
+        {
+            uint32_t index = IndexOf(node);
+            m_translation[index] = translation;
+            MarkDirty(index);
+        }
+
+        inline void TransformHierarchy::SetRotation(TransformNode node, const Quaternion& rotation)
+        {
+            uint32_t index = IndexOf(node);
+            m_rotation[index] = rotation;
+            MarkDirty(index);
+        }
+
+        inline void TransformHierarchy::SetScale(TransformNode node, const Vector3& scale)
+        {
+            uint32_t index = IndexOf(node);
+            m_scale[index] = scale;
+            MarkDirty(index);
+        }
+
+        inline const Vector3& TransformHierarchy::Translation(TransformNode node) const
+        {
+            return m_translation[IndexOf(node)];
+        }
+
+        inline const Quaternion& TransformHierarchy::Rotation(TransformNode node) const
+        {
+            return m_rotation[IndexOf(node)];
+        }
+
+        inline const Vector3& TransformHierarchy::Scale(TransformNode node) const
+        {
+            return m_scale[IndexOf(node)];
+        }
+
+        //World matrix of node as of the last Update
+        inline const Matrix4& TransformHierarchy::World(TransformNode node) const
+        {
+            return m_world[IndexOf(node)];
+        }
+
+        inline TransformNode TransformHierarchy::Parent(TransformNode node) const
+        {
+            uint32_t parentIndex = m_parent[IndexOf(node)];
+            return parentIndex == invalidTransformNode ? invalidTransformNode : m_handle[parentIndex];
+        }
+
+        /** Brings every world matrix up to date
+        * Re-sorts first if the structure changed, then makes one pass in array order.
+        * Costs one flag test per node when nothing moved.
+        */
+        inline void TransformHierarchy::Update()
+        {
+            if (m_unsorted)
+                Sort();
+            if (!m_anyDirty)
+                return;
+
+            UpdateRange(0, static_cast<uint32_t>(m_parent.size()));
+
+            std::fill(m_dirty.begin(), m_dirty.end(), 0);
+            m_anyDirty = false;
+        }
+
+        /** Brings every world matrix up to date using a worker pool
+        * Each depth level only reads the level above it, so a level is split into
+        * equally sized index ranges that run in parallel, with ParallelFor acting as
+        * the barrier between levels. Levels of at most grainSize nodes run on the
+        * calling thread. Every node goes through the same operations as in the serial
+        * Update, so the results are bit-identical.
+        * \param pool Pool the level ranges are scheduled on
+        * \param grainSize Smallest number of nodes worth handing to another thread
+        */
+        inline void TransformHierarchy::Update(MMWorkerPool& pool, uint32_t grainSize)
+        {
+            if (m_unsorted)
+                Sort();
+            if (!m_anyDirty)
+                return;
+
+            const uint32_t maxTasks = static_cast<uint32_t>(pool.ThreadCount() * 4);
+            grainSize = std::max(grainSize, 1u);
+
+            for (size_t level = 0; level + 1 < m_levelBegin.size(); level++)
+            {
+                uint32_t begin = m_levelBegin[level];
+                uint32_t count = m_levelBegin[level + 1] - begin;
+                uint32_t tasks = std::min((count + grainSize - 1) / grainSize, maxTasks);
+                if (tasks <= 1)
+                {
+                    UpdateRange(begin, begin + count);
+                    continue;
+                }
+
+                pool.ParallelFor(tasks, [this, begin, count, tasks](size_t task) {
+                    uint32_t first = begin + static_cast<uint32_t>(uint64_t(count) * task / tasks);
+                    uint32_t last = begin + static_cast<uint32_t>(uint64_t(count) * (task + 1) / tasks);
+                    UpdateRange(first, last);
+                });
+            }
+
+            std::fill(m_dirty.begin(), m_dirty.end(), 0);
+            m_anyDirty = false;
+        }
+
+        inline size_t TransformHierarchy::Size() const
+        {
+            return m_parent.size();
+        }
+
+        //Number of depth levels, valid after Update
+        inline size_t TransformHierarchy::LevelCount() const
+        {
+            assert(!m_unsorted);
+            return m_levelBegin.size() - 1;
+        }
+
+        //First array index of a level, LevelBegin(LevelCount()) is Size()
+        inline uint32_t TransformHierarchy::LevelBegin(size_t level) const
+        {
+            assert(!m_unsorted && level < m_levelBegin.size());
+            return m_levelBegin[level];
+        }
+
+        inline uint32_t TransformHierarchy::IndexOf(TransformNode node) const
+        {
+            assert(node < m_index.size());
+            return m_index[node];
+        }
+
+        inline const Matrix4* TransformHierarchy::WorldMatrices() const
+        {
+            return m_world.data();
+        }
+
+        inline const uint32_t* TransformHierarchy::ParentIndices() const
+        {
+            return m_parent.data();
+        }
+
+        inline void TransformHierarchy::MarkDirty(uint32_t index)
+        {
+            m_dirty[index] = 1;
+            m_anyDirty = true;
+        }
+
+        //Restores breadth-first order with a stable counting sort on depth
+        inline void TransformHierarchy::Sort()
+        {
+            const uint32_t count = static_cast<uint32_t>(m_parent.size());
+            const uint32_t unknown = invalidTransformNode;
+
+            //depths from the parent links, walking up until a known depth
+            Array<uint32_t> depth(count, unknown);
+            Array<uint32_t> chain;
+            uint32_t levels = 0;
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint32_t p = i;
+                while (p != invalidTransformNode && depth[p] == unknown)
+                {
+                    chain.push_back(p);
+                    p = m_parent[p];
+                }
+                uint32_t d = p == invalidTransformNode ? 0 : depth[p] + 1;
+                while (!chain.empty())
+                {
+                    depth[chain.back()] = d++;
+                    chain.pop_back();
+                }
+                levels = std::max(levels, depth[i] + 1);
+            }
+
+            m_levelBegin.assign(levels + 1, 0);
+            for (uint32_t i = 0; i < count; i++)
+                m_levelBegin[depth[i] + 1]++;
+            for (uint32_t level = 0; level < levels; level++)
+                m_levelBegin[level + 1] += m_levelBegin[level];
+
+            //newIndex[old] keeps the previous relative order inside each level
+            Array<uint32_t> next(m_levelBegin.begin(), m_levelBegin.end() - 1);
+            Array<uint32_t> newIndex(count);
+            for (uint32_t i = 0; i < count; i++)
+                newIndex[i] = next[depth[i]]++;
+
+            Array<Vector3> translation(count);
+            Array<Quaternion> rotation(count);
+            Array<Vector3> scale(count);
+            Array<Matrix4> world(count);
+            Array<uint32_t> parent(count);
+            Array<uint8_t> dirty(count);
+            Array<TransformNode> handle(count);
+            Array<uint32_t> sortedDepth(count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                uint32_t n = newIndex[i];
+                sortedDepth[n] = depth[i];
+                translation[n] = m_translation[i];
+                rotation[n] = m_rotation[i];
+                scale[n] = m_scale[i];
+                world[n] = m_world[i];
+                parent[n] = m_parent[i] == invalidTransformNode ? invalidTransformNode : newIndex[m_parent[i]];
+                dirty[n] = m_dirty[i];
+                handle[n] = m_handle[i];
+                m_index[m_handle[i]] = n;
+            }
+
+            m_translation.swap(translation);
+            m_rotation.swap(rotation);
+            m_scale.swap(scale);
+            m_world.swap(world);
+            m_parent.swap(parent);
+            m_depth.swap(sortedDepth);
+            m_dirty.swap(dirty);
+            m_handle.swap(handle);
+            m_unsorted = false;
+        }
+
+        //Updates the nodes in [begin, end), parents must already be up to date
+        inline void TransformHierarchy::UpdateRange(uint32_t begin, uint32_t end)
+        {
+            for (uint32_t i = begin; i < end; i++)
+            {
+                uint32_t p = m_parent[i];
+                if (!m_dirty[i] && (p == invalidTransformNode || !m_dirty[p]))
+                    continue;
+
+                //mark the node so its children see the change
+                m_dirty[i] = 1;
+
+                MMFloat4 local[3];
+                Internal::MMTransformLocalRows(m_translation[i], m_rotation[i], m_scale[i], local);
+
+                MMFloat4* world = m_world[i].m_rows;
+                if (p == invalidTransformNode)
+                {
+                    world[0] = local[0];
+                    world[1] = local[1];
+                    world[2] = local[2];
+                }
+                else
+                {
+                    const MMFloat4* parentWorld = m_world[p].m_rows;
+                    world[0] = Internal::MMAffineMultiplyRow(parentWorld[0], local);
+                    world[1] = Internal::MMAffineMultiplyRow(parentWorld[1], local);
+                    world[2] = Internal::MMAffineMultiplyRow(parentWorld[2], local);
+                }
+            }
+        }
+    }
+}
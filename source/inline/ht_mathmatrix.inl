@@ -28,7 +28,7 @@ namespace Hatchit
         *\param v vector3 to translate by
         *\return the translation matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixTranslation(const Vector3 & v)
+        inline Matrix4 _MM_CALLCONV MMMatrixTranslation(FVector3 v)
         {
             return Matrix4(1, 0, 0, v.x,
                            0, 1, 0, v.y,
@@ -40,11 +40,10 @@ namespace Hatchit
         {
             Matrix4 result;
 
-            result.m_rows[0] = _mm_set_ss(1);
-            result.m_rows[1] = _mm_setr_ps(0, cosf(r),-sinf(r), 0);
-            result.m_rows[2] = _mm_setr_ps(0, sinf(r), cosf(r), 0);
-            result.m_rows[3] = _mm_set_ss(1);
-            result.m_rows[3] = _mm_shuffle_ps(result.m_rows[3], result.m_rows[3], _MM_SHUFFLE(0, 2, 2, 2));
+            result.m_rows[0] = MMVectorSet(1, 0, 0, 0);
+            result.m_rows[1] = MMVectorSet(0, cosf(r),-sinf(r), 0);
+            result.m_rows[2] = MMVectorSet(0, sinf(r), cosf(r), 0);
+            result.m_rows[3] = MMVectorSet(0, 0, 0, 1);
 
             return result;
         }
@@ -53,12 +52,10 @@ namespace Hatchit
         {
             Matrix4 result;
 
-            result.m_rows[0] = _mm_setr_ps(cosf(r), 0, sinf(r), 0);
-            result.m_rows[1] = _mm_set_ss(1);
-            result.m_rows[1] = _mm_shuffle_ps(result.m_rows[1], result.m_rows[1], _MM_SHUFFLE(2, 2, 0, 2));
-            result.m_rows[2] = _mm_setr_ps(-sinf(r), 0, cosf(r), 0);
-            result.m_rows[3] = _mm_set_ss(1);
-            result.m_rows[3] = _mm_shuffle_ps(result.m_rows[3], result.m_rows[3], _MM_SHUFFLE(0, 2, 2, 2));
+            result.m_rows[0] = MMVectorSet(cosf(r), 0, sinf(r), 0);
+            result.m_rows[1] = MMVectorSet(0, 1, 0, 0);
+            result.m_rows[2] = MMVectorSet(-sinf(r), 0, cosf(r), 0);
+            result.m_rows[3] = MMVectorSet(0, 0, 0, 1);
 
             return result;
         }
@@ -67,22 +64,20 @@ namespace Hatchit
         {
             Matrix4 result;
 
-            result.m_rows[0] = _mm_setr_ps(cosf(r), -sinf(r), 0, 0);
-            result.m_rows[1] = _mm_setr_ps(sinf(r), cosf(r), 0, 0);
-            result.m_rows[2] = _mm_set_ss(1);
-            result.m_rows[2] = _mm_shuffle_ps(result.m_rows[2], result.m_rows[2], _MM_SHUFFLE(2, 0, 2, 2));
-            result.m_rows[3] = _mm_set_ss(1);
-            result.m_rows[3] = _mm_shuffle_ps(result.m_rows[3], result.m_rows[3], _MM_SHUFFLE(0, 2, 2, 2));
+            result.m_rows[0] = MMVectorSet(cosf(r), -sinf(r), 0, 0);
+            result.m_rows[1] = MMVectorSet(sinf(r), cosf(r), 0, 0);
+            result.m_rows[2] = MMVectorSet(0, 0, 1, 0);
+            result.m_rows[3] = MMVectorSet(0, 0, 0, 1);
 
             return result;
         }
 
-        inline Matrix4 _MM_CALLCONV MMMatrixRotationXYZ(const Vector3 & r)
+        inline Matrix4 _MM_CALLCONV MMMatrixRotationXYZ(FVector3 r)
         {
             return (MMMatrixRotationY(r.y) * MMMatrixRotationX(r.x)) * MMMatrixRotationZ(r.z);
         }
 
-        inline Matrix4 _MM_CALLCONV MMMatrixRotationQuaternion(const Quaternion& q)
+        inline Matrix4 _MM_CALLCONV MMMatrixRotationQuaternion(FQuaternion q)
         {
             assert(MMQuaternionMagnitudeSqr(q) > 0.0f);
 
@@ -99,15 +94,15 @@ namespace Hatchit
         }
 
 
-        inline Matrix4 _MM_CALLCONV MMMatrixScale(const Vector3 & scale)
+        inline Matrix4 _MM_CALLCONV MMMatrixScale(FVector3 scale)
         {
             Matrix4 result;
 
-            result.m_rows[0] = _mm_set_ss(scale.x);
-            result.m_rows[3] = _mm_setr_ps(0, scale.y, scale.z, 1);
-            result.m_rows[1] = _mm_shuffle_ps(result.m_rows[3], result.m_rows[3], _MM_SHUFFLE(0, 0, 1, 0));
-            result.m_rows[2] = _mm_shuffle_ps(result.m_rows[3], result.m_rows[3], _MM_SHUFFLE(0, 2, 0, 0));
-            result.m_rows[3] = _mm_shuffle_ps(result.m_rows[3], result.m_rows[3], _MM_SHUFFLE(3, 0, 0, 0));
+            result.m_rows[0] = MMVectorSet(scale.x, 0, 0, 0);
+            result.m_rows[3] = MMVectorSet(0, scale.y, scale.z, 1);
+            result.m_rows[1] = MMVectorSwizzle<0, 1, 0, 0>(result.m_rows[3]);
+            result.m_rows[2] = MMVectorSwizzle<0, 0, 2, 0>(result.m_rows[3]);
+            result.m_rows[3] = MMVectorSwizzle<0, 0, 0, 3>(result.m_rows[3]);
 
             return result;
         }
@@ -122,17 +117,30 @@ namespace Hatchit
         */
         inline Matrix4 _MM_CALLCONV MMMatrixOrthoProj(float left, float right, float bottom, float top, float znear, float zfar)
         {
-            float a = 2 / (right - left);
-            float b = 2 / (top - bottom);
-            float c = 2 / (znear - zfar);
-            float d = (right + left) / (left - right);
-            float e = (top + bottom) / (bottom - top);
-            float f = (zfar + znear) / (znear - zfar);
+            return MMMatrixOrthoProj(left, right, bottom, top, znear, zfar, MMPrecisionDefault());
+        }
+
+        /** Generates an orthographic projection with an explicit precision
+        * The six divisions are done as two vector divisions, MMPrecisionFast keeps
+        * every element within 2^-21 relative error.
+        */
+        template <typename Precision>
+        inline Matrix4 _MM_CALLCONV MMMatrixOrthoProj(float left, float right, float bottom, float top, float znear, float zfar, Precision)
+        {
+            const MMFloat4 zero = MMVectorZero();
+
+            //(a, b, c, -) and (d, e, f, -)
+            MMFloat4 scale = MMVectorDiv(MMVectorSet(2.0f, 2.0f, 2.0f, 1.0f),
+                                         MMVectorSet(right - left, top - bottom, znear - zfar, 1.0f), Precision());
+            MMFloat4 offset = MMVectorDiv(MMVectorSet(right + left, top + bottom, zfar + znear, 1.0f),
+                                          MMVectorSet(left - right, bottom - top, znear - zfar, 1.0f), Precision());
 
-            return Matrix4(a, 0, 0, 0,
-                           0, b, 0, 0,
-                           0, 0, c, 0,
-                           d, e, f, 1);
+            Matrix4 result;
+            result.m_rows[0] = MMVectorBlend<0, 1, 1, 1>(scale, zero);
+            result.m_rows[1] = MMVectorBlend<1, 0, 1, 1>(scale, zero);
+            result.m_rows[2] = MMVectorBlend<1, 1, 0, 1>(scale, zero);
+            result.m_rows[3] = MMVectorSetW(offset, 1.0f);
+            return result;
         }
 
         /** Generates a perspective projection from the given values
@@ -145,17 +153,223 @@ namespace Hatchit
         */
         inline Matrix4 _MM_CALLCONV MMMatrixPerspProj(float fov, float width, float height, float znear, float zfar)
         {
-            float aspect = height / width;
+            return MMMatrixPerspProj(fov, width, height, znear, zfar, MMPrecisionDefault());
+        }
 
+        /** Generates a perspective projection with an explicit precision
+        * The four divisions are done as one vector division, MMPrecisionFast keeps
+        * every element within 2^-20 relative error.
+        */
+        template <typename Precision>
+        inline Matrix4 _MM_CALLCONV MMMatrixPerspProj(float fov, float width, float height, float znear, float zfar, Precision)
+        {
             //thanks to https://stackoverflow.com/questions/18404890/how-to-build-perspective-projection-matrix-no-api
-            float h = 1 / tanf(0.5f * fov);
-            float w = h * aspect;
             float depth = zfar - znear;
+            const MMFloat4 zero = MMVectorZero();
+
+            //(aspect, h, zz, zw) where h = 1 / tan(fov / 2)
+            MMFloat4 terms = MMVectorDiv(MMVectorSet(height, 1.0f, -(zfar + znear), -(2 * zfar * znear)),
+                                         MMVectorSet(width, tanf(0.5f * fov), depth, depth), Precision());
+            //w = h * aspect
+            MMFloat4 w = MMVectorMul(MMVectorSplatY(terms), terms);
 
-            return Matrix4( w,  0.0f,   0.0f,   0.0f,
-                            0.0f,   h, 0.0f,   0.0f,
-                            0.0f,   0.0f,   -(zfar + znear) / depth, -(2 * zfar * znear) / depth,
-                            0.0f,   0.0f, -1.f , 0.0f);
+            Matrix4 result;
+            result.m_rows[0] = MMVectorBlend<0, 1, 1, 1>(w, zero);
+            result.m_rows[1] = MMVectorBlend<1, 0, 1, 1>(terms, zero);
+            result.m_rows[2] = MMVectorBlend<0, 0, 1, 1>(zero, terms);
+            result.m_rows[3] = MMVectorSet(0.0f, 0.0f, -1.0f, 0.0f);
+            return result;
+        }
+
+        namespace Internal
+        {
+            /** Builds a perspective projection and its inverse from the depth terms
+            * The projection maps view z to (depthScale * z + depthOffset) / -z, inverting
+            * the 2x2 depth block in closed form gives
+            * (1/a, 0, 0, 0), (0, 1/b, 0, 0), (0, 0, 0, -1), (0, 0, 1/depthOffset, depthScale/depthOffset)
+            */
+            inline Matrix4 _MM_CALLCONV MMMatrixPerspFromDepth(float fov, float width, float height,
+                                                               float depthScale, float depthOffset, Matrix4* inverse)
+            {
+                const MMFloat4 zero = MMVectorZero();
+
+                //(aspect, h, zz, zw) where h = 1 / tan(fov / 2)
+                MMFloat4 terms = MMVectorDiv(MMVectorSet(height, 1.0f, depthScale, depthOffset),
+                                             MMVectorSet(width, tanf(0.5f * fov), 1.0f, 1.0f), MMPrecisionDefault());
+                //(a, b, zz, zw) where a = h * aspect
+                terms = MMVectorMoveX(terms, MMVectorMul(MMVectorSplatY(terms), terms));
+
+                Matrix4 result;
+                result.m_rows[0] = MMVectorBlend<0, 1, 1, 1>(terms, zero);
+                result.m_rows[1] = MMVectorBlend<1, 0, 1, 1>(terms, zero);
+                result.m_rows[2] = MMVectorBlend<1, 1, 0, 0>(terms, zero);
+                result.m_rows[3] = MMVectorSet(0.0f, 0.0f, -1.0f, 0.0f);
+
+                if (inverse)
+                {
+                    //(1/a, 1/b, 1/zw, zz/zw)
+                    MMFloat4 inv = MMVectorDiv(MMVectorBlend<0, 0, 0, 1>(MMVectorSplat(1.0f), MMVectorSplatZ(terms)),
+                                               MMVectorShuffle<0, 1, 3, 3>(terms, terms), MMPrecisionDefault());
+                    inverse->m_rows[0] = MMVectorBlend<0, 1, 1, 1>(inv, zero);
+                    inverse->m_rows[1] = MMVectorBlend<1, 0, 1, 1>(inv, zero);
+                    inverse->m_rows[2] = MMVectorSet(0.0f, 0.0f, 0.0f, -1.0f);
+                    inverse->m_rows[3] = MMVectorBlend<1, 1, 0, 0>(inv, zero);
+                }
+                return result;
+            }
+
+            //NDC depth of the near and far plane for a depth range
+            inline void _MM_CALLCONV MMDepthRangeBounds(MMDepthRange depth, float& nearDepth, float& farDepth)
+            {
+                nearDepth = depth == MM_DEPTH_NEGATIVE_ONE_TO_ONE ? -1.0f : (depth == MM_DEPTH_REVERSED ? 1.0f : 0.0f);
+                farDepth = depth == MM_DEPTH_REVERSED ? 0.0f : 1.0f;
+            }
+        }
+
+        /** Generates an orthographic projection for a depth range, optionally with its inverse
+        * Unlike the legacy overload the translation is stored in the w column, matching
+        * MMMatrixPerspProj and Matrix4 * Vector4.
+        * \param depth The clip space depth range to map [znear, zfar] to
+        * \param inverse Receives the closed form inverse when not null
+        * \return The resulting orthographic projection in a Matrix4
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixOrthoProj(float left, float right, float bottom, float top, float znear, float zfar,
+                                                      MMDepthRange depth, Matrix4* inverse)
+        {
+            const MMFloat4 zero = MMVectorZero();
+            float depthScale = -2.0f, depthOffset = -(zfar + znear);
+            if (depth == MM_DEPTH_ZERO_TO_ONE)
+            {
+                depthScale = -1.0f;
+                depthOffset = -znear;
+            }
+            else if (depth == MM_DEPTH_REVERSED)
+            {
+                depthScale = 1.0f;
+                depthOffset = zfar;
+            }
+
+            //(sx, sy, sz, 1) and (tx, ty, tz, 1)
+            MMFloat4 size = MMVectorSet(right - left, top - bottom, zfar - znear, 1.0f);
+            MMFloat4 scale = MMVectorDiv(MMVectorSet(2.0f, 2.0f, depthScale, 1.0f), size, MMPrecisionDefault());
+            MMFloat4 offset = MMVectorDiv(MMVectorSet(-(right + left), -(top + bottom), depthOffset, 1.0f), size, MMPrecisionDefault());
+
+            //built with the translation as the bottom row, then transposed into the w column
+            Matrix4 result;
+            result.m_rows[0] = MMVectorBlend<0, 1, 1, 1>(scale, zero);
+            result.m_rows[1] = MMVectorBlend<1, 0, 1, 1>(scale, zero);
+            result.m_rows[2] = MMVectorBlend<1, 1, 0, 1>(scale, zero);
+            result.m_rows[3] = offset;
+            MMVectorTranspose4(result.m_rows[0], result.m_rows[1], result.m_rows[2], result.m_rows[3]);
+
+            if (inverse)
+            {
+                //x = (x' - t) / s
+                MMFloat4 invScale = MMVectorReciprocal(scale, MMPrecisionDefault());
+                MMFloat4 invOffset = MMVectorSetW(MMVectorSub(zero, MMVectorMul(offset, invScale)), 1.0f);
+                inverse->m_rows[0] = MMVectorBlend<0, 1, 1, 1>(invScale, zero);
+                inverse->m_rows[1] = MMVectorBlend<1, 0, 1, 1>(invScale, zero);
+                inverse->m_rows[2] = MMVectorBlend<1, 1, 0, 1>(invScale, zero);
+                inverse->m_rows[3] = invOffset;
+                MMVectorTranspose4(inverse->m_rows[0], inverse->m_rows[1], inverse->m_rows[2], inverse->m_rows[3]);
+            }
+            return result;
+        }
+
+        /** Generates a perspective projection for a depth range, optionally with its inverse
+        * \param depth The clip space depth range to map [znear, zfar] to, MM_DEPTH_REVERSED
+        * spreads float precision evenly over distance
+        * \param inverse Receives the closed form inverse when not null
+        * \return The resulting perspective projection in a Matrix4
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixPerspProj(float fov, float width, float height, float znear, float zfar,
+                                                      MMDepthRange depth, Matrix4* inverse)
+        {
+            float range = zfar - znear;
+            if (depth == MM_DEPTH_ZERO_TO_ONE)
+                return Internal::MMMatrixPerspFromDepth(fov, width, height, -zfar / range, -(zfar * znear) / range, inverse);
+            if (depth == MM_DEPTH_REVERSED)
+                return Internal::MMMatrixPerspFromDepth(fov, width, height, znear / range, (zfar * znear) / range, inverse);
+            return Internal::MMMatrixPerspFromDepth(fov, width, height, -(zfar + znear) / range, -(2 * zfar * znear) / range, inverse);
+        }
+
+        /** Generates a perspective projection with the far plane at infinity
+        * The limit of MMMatrixPerspProj as zfar grows, nothing past the near plane is clipped.
+        * \param depth The clip space depth range, infinity maps to the far bound
+        * \param inverse Receives the closed form inverse when not null
+        * \return The resulting perspective projection in a Matrix4
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixPerspProjInfinite(float fov, float width, float height, float znear,
+                                                              MMDepthRange depth, Matrix4* inverse)
+        {
+            if (depth == MM_DEPTH_ZERO_TO_ONE)
+                return Internal::MMMatrixPerspFromDepth(fov, width, height, -1.0f, -znear, inverse);
+            if (depth == MM_DEPTH_REVERSED)
+                return Internal::MMMatrixPerspFromDepth(fov, width, height, 0.0f, znear, inverse);
+            return Internal::MMMatrixPerspFromDepth(fov, width, height, -1.0f, -2.0f * znear, inverse);
+        }
+
+        /** Maps a normalized device coordinate back through an inverse projection
+        * \param inverse Inverse of the projection (or view projection) that produced ndc
+        * \param ndc Clip space position after the perspective divide
+        * \return The position in the space before projection
+        */
+        inline Vector3 _MM_CALLCONV MMMatrixUnproject(FMatrix4 inverse, FVector3 ndc)
+        {
+            Vector4 h = inverse * Vector4(ndc.x, ndc.y, ndc.z, 1.0f);
+
+            Vector3 result;
+            result.m_vector = MMVectorDiv(h.m_vector, MMVectorSplatW(h.m_vector), MMPrecisionDefault());
+            return result;
+        }
+
+        /** Builds a picking ray through a point on screen
+        * The ray runs from the near plane towards the far plane. The direction is taken
+        * from the homogeneous points, so an infinite far plane still works.
+        * \param inverse Inverse view projection
+        * \param x Horizontal normalized device coordinate
+        * \param y Vertical normalized device coordinate
+        * \param depth The depth range the projection was built with
+        * \param origin Receives the point on the near plane
+        * \param direction Receives the normalized ray direction
+        */
+        inline void _MM_CALLCONV MMMatrixUnprojectRay(FMatrix4 inverse, float x, float y, MMDepthRange depth,
+                                                      Vector3& origin, Vector3& direction)
+        {
+            float nearDepth, farDepth;
+            Internal::MMDepthRangeBounds(depth, nearDepth, farDepth);
+
+            MMFloat4 n = (inverse * Vector4(x, y, nearDepth, 1.0f)).m_vector;
+            MMFloat4 f = (inverse * Vector4(x, y, farDepth, 1.0f)).m_vector;
+
+            //f / f.w - n / n.w scaled by n.w * f.w, finite even when f.w is zero
+            MMFloat4 dir = MMVectorSub(MMVectorMul(f, MMVectorSplatW(n)), MMVectorMul(n, MMVectorSplatW(f)));
+            origin.m_vector = MMVectorDiv(n, MMVectorSplatW(n), MMPrecisionDefault());
+            direction.m_vector = dir;
+            direction = MMVector3Normalized(direction);
+        }
+
+        /** Writes MMMatrixUnproject(inverse, ndc[i]) to out[i] for count elements
+        * out may alias ndc
+        */
+        inline void _MM_CALLCONV MMMatrixUnprojectStream(Vector3* out, FMatrix4 inverse, const Vector3* ndc, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixUnprojectStream");
+
+            MMFloat4 c0 = inverse.m_rows[0];
+            MMFloat4 c1 = inverse.m_rows[1];
+            MMFloat4 c2 = inverse.m_rows[2];
+            MMFloat4 c3 = inverse.m_rows[3];
+            MMVectorTranspose4(c0, c1, c2, c3);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                MMFloat4 v = ndc[i].m_vector;
+                MMFloat4 h = MMVectorAdd(MMVectorMul(c0, MMVectorSplatX(v)), c3);
+                h = MMVectorAdd(h, MMVectorMul(c1, MMVectorSplatY(v)));
+                h = MMVectorAdd(h, MMVectorMul(c2, MMVectorSplatZ(v)));
+                out[i].m_vector = MMVectorDiv(h, MMVectorSplatW(h), MMPrecisionDefault());
+            }
         }
 
         /** Generates a view matrix from the given values
@@ -164,32 +378,35 @@ namespace Hatchit
         * \param up The vector representing which way is up for this camera
         * \return The resulting view matrix in a Matrix4
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixLookAt(const Vector3& eye, const Vector3& lookAt, const Vector3& up)
+        inline Matrix4 _MM_CALLCONV MMMatrixLookAt(FVector3 eye, FVector3 lookAt, FVector3 up)
         {
             //Calculate axes
             Vector3 zAxis = MMVector3Normalized((eye - lookAt));
             Vector3 xAxis = MMVector3Normalized(MMVector3Cross(zAxis, up));
             Vector3 yAxis = MMVector3Cross(xAxis, zAxis);
 
-            //Create view matrix
-            return Matrix4(xAxis.x, xAxis.y, xAxis.z, -MMVector3Dot(xAxis, eye),
-                           yAxis.x, yAxis.y, yAxis.z, -MMVector3Dot(yAxis, eye),
-                           zAxis.x, zAxis.y, zAxis.z, -MMVector3Dot(zAxis, eye),
-                           0, 0, 0, 1);
+            //Create view matrix, the translation column is -dot(axis, eye)
+            const MMFloat4 zero = MMVectorZero();
+            Matrix4 view;
+            view.m_rows[0] = MMVectorBlend<0, 0, 0, 1>(xAxis.m_vector, MMVectorSub(zero, MMVector3DotV(xAxis, eye)));
+            view.m_rows[1] = MMVectorBlend<0, 0, 0, 1>(yAxis.m_vector, MMVectorSub(zero, MMVector3DotV(yAxis, eye)));
+            view.m_rows[2] = MMVectorBlend<0, 0, 0, 1>(zAxis.m_vector, MMVectorSub(zero, MMVector3DotV(zAxis, eye)));
+            view.m_rows[3] = MMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
+            return view;
         }
 
         /** Returns the transpose of a matrix as a Matrix4
         * \param mat matrix to transpose
         * \return A Matrix4 that is the transpoe of this matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixTranspose(const Matrix4& mat)
+        inline Matrix4 _MM_CALLCONV MMMatrixTranspose(FMatrix4 mat)
         {
             Matrix4 transpose;
             transpose.m_rows[0] = mat.m_rows[0];
             transpose.m_rows[1] = mat.m_rows[1];
             transpose.m_rows[2] = mat.m_rows[2];
             transpose.m_rows[3] = mat.m_rows[3];
-            _MM_TRANSPOSE4_PS(transpose.m_rows[0], transpose.m_rows[1], transpose.m_rows[2], transpose.m_rows[3]);
+            MMVectorTranspose4(transpose.m_rows[0], transpose.m_rows[1], transpose.m_rows[2], transpose.m_rows[3]);
             return transpose;
         }
 
@@ -197,13 +414,24 @@ namespace Hatchit
         * \param mat matrix to invert
         * \return A Matrix4 that is the inverse of this matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverse(const Matrix4& mat)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverse(FMatrix4 mat)
+        {
+            return MMMatrixInverse(mat, nullptr);
+        }
+
+        /** Returns the inverse of this matrix as a Matrix4
+        * \param mat matrix to invert
+        * \param determinant Receives the determinant of mat when not null, a zero
+        * determinant means the returned matrix is not finite
+        * \return A Matrix4 that is the inverse of this matrix
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixInverse(FMatrix4 mat, float* determinant)
         {
 
             Matrix4 result;
-            __m128 x, y, z, w;
-            __m128 temp1, temp2;
-            __m128 det;
+            MMFloat4 x, y, z, w;
+            MMFloat4 temp1, temp2;
+            MMFloat4 det;
 
             //xx, xy, xz, xw
             //yx, yy, yz, yw
@@ -212,173 +440,527 @@ namespace Hatchit
 
             //calculate cofactor
             //xx,xy
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(1, 3, 2, 0)),  //row 2 shifted backwards (ignoring 1st value)
-                               _mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(2, 1, 3, 0))); //row 3 shifted forwards (ignoring 1st value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(1, 3, 2, 0)),  //row 3 shifted backwards (ignoring 1st value)
-                               _mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(2, 1, 3, 0))); //row 2 shifted forwards (ignoring 1st value)
+            temp1 = MMVectorMul(MMVectorSwizzle<0, 2, 3, 1>(mat.m_rows[2]),  //row 2 shifted backwards (ignoring 1st value)
+                               MMVectorSwizzle<0, 3, 1, 2>(mat.m_rows[3])); //row 3 shifted forwards (ignoring 1st value)
+            temp2 = MMVectorMul(MMVectorSwizzle<0, 2, 3, 1>(mat.m_rows[3]),  //row 3 shifted backwards (ignoring 1st value)
+                               MMVectorSwizzle<0, 3, 1, 2>(mat.m_rows[2])); //row 2 shifted forwards (ignoring 1st value)
                                                                                         //+
-            x = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[1]); //multiply 3 rows together
-            x = _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 3, 2, 2)),
-                           _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 1, 3, 3)))); //add 3 values together into new vector
+            x = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[1]); //multiply 3 rows together
+            x = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 3>(x),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 1>(x),
+                           MMVectorSwizzle<3, 3, 1, 2>(x))); //add 3 values together into new vector
                                                                      //-
-            y = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[0]); //multiply 3 rows together
-            y = _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 3, 2, 2)),
-                           _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 1, 3, 3)))); //add 3 values together into new vector
+            y = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[0]); //multiply 3 rows together
+            y = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 3>(y),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 1>(y),
+                           MMVectorSwizzle<3, 3, 1, 2>(y))); //add 3 values together into new vector
 
                                                                      //xz,xw
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(1, 3, 2, 0)),  //row 0 shifted backwards (ignoring 1st value)
-                               _mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(2, 1, 3, 0))); //row 1 shifted forwards (ignoring 1st value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(1, 3, 2, 0)),  //row 1 shifted backwards (ignoring 1st value)
-                               _mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(2, 1, 3, 0))); //row 0 shifted forwards (ignoring 1st value)
+            temp1 = MMVectorMul(MMVectorSwizzle<0, 2, 3, 1>(mat.m_rows[0]),  //row 0 shifted backwards (ignoring 1st value)
+                               MMVectorSwizzle<0, 3, 1, 2>(mat.m_rows[1])); //row 1 shifted forwards (ignoring 1st value)
+            temp2 = MMVectorMul(MMVectorSwizzle<0, 2, 3, 1>(mat.m_rows[1]),  //row 1 shifted backwards (ignoring 1st value)
+                               MMVectorSwizzle<0, 3, 1, 2>(mat.m_rows[0])); //row 0 shifted forwards (ignoring 1st value)
                                                                                         //+
-            z = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[3]); //multiply 3 rows together
-            z = _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(1, 3, 2, 2)),
-                           _mm_shuffle_ps(z, z, _MM_SHUFFLE(2, 1, 3, 3)))); //add 3 values together into new vector
+            z = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[3]); //multiply 3 rows together
+            z = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 3>(z),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 1>(z),
+                           MMVectorSwizzle<3, 3, 1, 2>(z))); //add 3 values together into new vector
                                                                      //-
-            w = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[2]); //multiply 3 rows together
-            w = _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 3, 2, 2)),
-                           _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 1, 3, 3)))); //add 3 values together into new vector
+            w = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[2]); //multiply 3 rows together
+            w = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 3>(w),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 1>(w),
+                           MMVectorSwizzle<3, 3, 1, 2>(w))); //add 3 values together into new vector
 
-            result.m_rows[0] = _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, w));
+            result.m_rows[0] = MMVectorMoveLH(MMVectorMergeXY(x, y), MMVectorMergeXY(z, w));
 
             //yx,yy
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(0, 3, 1, 2)),  //row 2 shifted backwards (ignoring 2nd value)
-                               _mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(2, 0, 1, 3))); //row 3 shifted forwards (ignoring 2nd value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(0, 3, 1, 2)),  //row 3 shifted backwards (ignoring 2nd value)
-                               _mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(2, 0, 1, 3))); //row 2 shifted forwards (ignoring 2nd value)
+            temp1 = MMVectorMul(MMVectorSwizzle<2, 1, 3, 0>(mat.m_rows[2]),  //row 2 shifted backwards (ignoring 2nd value)
+                               MMVectorSwizzle<3, 1, 0, 2>(mat.m_rows[3])); //row 3 shifted forwards (ignoring 2nd value)
+            temp2 = MMVectorMul(MMVectorSwizzle<2, 1, 3, 0>(mat.m_rows[3]),  //row 3 shifted backwards (ignoring 2nd value)
+                               MMVectorSwizzle<3, 1, 0, 2>(mat.m_rows[2])); //row 2 shifted forwards (ignoring 2nd value)
             
             //-
-            x = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[1]); //multiply 3 rows together
-            x = _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 2, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 3, 2, 2)),
-                           _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 0, 3, 3)))); //add 3 values together into new vector
+            x = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[1]); //multiply 3 rows together
+            x = MMVectorAdd(MMVectorSwizzle<0, 0, 2, 3>(x),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 0>(x),
+                           MMVectorSwizzle<3, 3, 0, 2>(x))); //add 3 values together into new vector
 
             //+
-            y = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[0]); //multiply 3 rows together
-            y = _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 2, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 3, 2, 2)),
-                           _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 0, 3, 3)))); //add 3 values together into new vector
+            y = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[0]); //multiply 3 rows together
+            y = MMVectorAdd(MMVectorSwizzle<0, 0, 2, 3>(y),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 0>(y),
+                           MMVectorSwizzle<3, 3, 0, 2>(y))); //add 3 values together into new vector
 
             //yz,yw
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(0, 3, 1, 2)),  //row 0 shifted backwards (ignoring 2nd value)
-                               _mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(2, 0, 1, 3))); //row 1 shifted forwards (ignoring 2nd value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(0, 3, 1, 2)),  //row 1 shifted backwards (ignoring 2nd value)
-                               _mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(2, 0, 1, 3))); //row 0 shifted forwards (ignoring 2nd value)
+            temp1 = MMVectorMul(MMVectorSwizzle<2, 1, 3, 0>(mat.m_rows[0]),  //row 0 shifted backwards (ignoring 2nd value)
+                               MMVectorSwizzle<3, 1, 0, 2>(mat.m_rows[1])); //row 1 shifted forwards (ignoring 2nd value)
+            temp2 = MMVectorMul(MMVectorSwizzle<2, 1, 3, 0>(mat.m_rows[1]),  //row 1 shifted backwards (ignoring 2nd value)
+                               MMVectorSwizzle<3, 1, 0, 2>(mat.m_rows[0])); //row 0 shifted forwards (ignoring 2nd value)
 
             //-
-            z = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[3]); //multiply 3 rows together
-            z = _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 2, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(0, 3, 2, 2)),
-                           _mm_shuffle_ps(z, z, _MM_SHUFFLE(2, 0, 3, 3)))); //add 3 values together into new vector
+            z = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[3]); //multiply 3 rows together
+            z = MMVectorAdd(MMVectorSwizzle<0, 0, 2, 3>(z),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 0>(z),
+                           MMVectorSwizzle<3, 3, 0, 2>(z))); //add 3 values together into new vector
                                                                      //+
-            w = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[2]); //multiply 3 rows together
-            w = _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 2, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 3, 2, 2)),
-                           _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 0, 3, 3)))); //add 3 values together into new vector
+            w = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[2]); //multiply 3 rows together
+            w = MMVectorAdd(MMVectorSwizzle<0, 0, 2, 3>(w),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 3, 0>(w),
+                           MMVectorSwizzle<3, 3, 0, 2>(w))); //add 3 values together into new vector
 
-            result.m_rows[1] = _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, w));
+            result.m_rows[1] = MMVectorMoveLH(MMVectorMergeXY(x, y), MMVectorMergeXY(z, w));
 
             //zx,zy 
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(0, 2, 3, 1)),  //row 2 shifted backwards (ignoring 3rd value)
-                               _mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(1, 2, 0, 3))); //row 3 shifted forwards (ignoring 3rd value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(0, 2, 3, 1)),  //row 3 shifted backwards (ignoring 3rd value)
-                               _mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(1, 2, 0, 3))); //row 2 shifted forwards (ignoring 3rd value)
+            temp1 = MMVectorMul(MMVectorSwizzle<1, 3, 2, 0>(mat.m_rows[2]),  //row 2 shifted backwards (ignoring 3rd value)
+                               MMVectorSwizzle<3, 0, 2, 1>(mat.m_rows[3])); //row 3 shifted forwards (ignoring 3rd value)
+            temp2 = MMVectorMul(MMVectorSwizzle<1, 3, 2, 0>(mat.m_rows[3]),  //row 3 shifted backwards (ignoring 3rd value)
+                               MMVectorSwizzle<3, 0, 2, 1>(mat.m_rows[2])); //row 2 shifted forwards (ignoring 3rd value)
 
             //+
-            x = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[1]); //multiply 3 rows together
-            x = _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(3, 1, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 3, 1, 1)),
-                           _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 3, 3)))); //add 3 values together into new vector
+            x = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[1]); //multiply 3 rows together
+            x = MMVectorAdd(MMVectorSwizzle<0, 0, 1, 3>(x),
+                MMVectorAdd(MMVectorSwizzle<1, 1, 3, 0>(x),
+                           MMVectorSwizzle<3, 3, 0, 1>(x))); //add 3 values together into new vector
                                                                      //-
-            y = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[0]); //multiply 3 rows together
-            y = _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 1, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 3, 1, 1)),
-                           _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 0, 3, 3)))); //add 3 values together into new vector
+            y = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[0]); //multiply 3 rows together
+            y = MMVectorAdd(MMVectorSwizzle<0, 0, 1, 3>(y),
+                MMVectorAdd(MMVectorSwizzle<1, 1, 3, 0>(y),
+                           MMVectorSwizzle<3, 3, 0, 1>(y))); //add 3 values together into new vector
 
             //zz,zw 
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(0, 2, 3, 1)),  //row 0 shifted backwards (ignoring 3rd value)
-                               _mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(1, 2, 0, 3))); //row 1 shifted forwards (ignoring 3rd value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(0, 2, 3, 1)),  //row 1 shifted backwards (ignoring 3rd value)
-                               _mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(1, 2, 0, 3))); //row 0 shifted forwards (ignoring 3rd value)
+            temp1 = MMVectorMul(MMVectorSwizzle<1, 3, 2, 0>(mat.m_rows[0]),  //row 0 shifted backwards (ignoring 3rd value)
+                               MMVectorSwizzle<3, 0, 2, 1>(mat.m_rows[1])); //row 1 shifted forwards (ignoring 3rd value)
+            temp2 = MMVectorMul(MMVectorSwizzle<1, 3, 2, 0>(mat.m_rows[1]),  //row 1 shifted backwards (ignoring 3rd value)
+                               MMVectorSwizzle<3, 0, 2, 1>(mat.m_rows[0])); //row 0 shifted forwards (ignoring 3rd value)
 
             //+
-            z = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[3]); //multiply 3 rows together
-            z = _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 1, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(0, 3, 1, 1)),
-                           _mm_shuffle_ps(z, z, _MM_SHUFFLE(1, 0, 3, 3)))); //add 3 values together into new vector
+            z = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[3]); //multiply 3 rows together
+            z = MMVectorAdd(MMVectorSwizzle<0, 0, 1, 3>(z),
+                MMVectorAdd(MMVectorSwizzle<1, 1, 3, 0>(z),
+                           MMVectorSwizzle<3, 3, 0, 1>(z))); //add 3 values together into new vector
 
             //-
-            w = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[2]); //multiply 3 rows together
-            w = _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(3, 1, 0, 0)),
-                _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 3, 1, 1)),
-                           _mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 0, 3, 3)))); //add 3 values together into new vector
+            w = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[2]); //multiply 3 rows together
+            w = MMVectorAdd(MMVectorSwizzle<0, 0, 1, 3>(w),
+                MMVectorAdd(MMVectorSwizzle<1, 1, 3, 0>(w),
+                           MMVectorSwizzle<3, 3, 0, 1>(w))); //add 3 values together into new vector
 
-            result.m_rows[2] = _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, w));
+            result.m_rows[2] = MMVectorMoveLH(MMVectorMergeXY(x, y), MMVectorMergeXY(z, w));
 
             //wx,wy
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(3, 0, 2, 1)),  //row 2 shifted backwards (ignoring 4th value)
-                               _mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(3, 1, 0, 2))); //row 3 shifted forwards (ignoring 4th value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[3], mat.m_rows[3], _MM_SHUFFLE(3, 0, 2, 1)),  //row 3 shifted backwards (ignoring 4th value)
-                               _mm_shuffle_ps(mat.m_rows[2], mat.m_rows[2], _MM_SHUFFLE(3, 1, 0, 2))); //row 2 shifted forwards (ignoring 4th value)
+            temp1 = MMVectorMul(MMVectorSwizzle<1, 2, 0, 3>(mat.m_rows[2]),  //row 2 shifted backwards (ignoring 4th value)
+                               MMVectorSwizzle<2, 0, 1, 3>(mat.m_rows[3])); //row 3 shifted forwards (ignoring 4th value)
+            temp2 = MMVectorMul(MMVectorSwizzle<1, 2, 0, 3>(mat.m_rows[3]),  //row 3 shifted backwards (ignoring 4th value)
+                               MMVectorSwizzle<2, 0, 1, 3>(mat.m_rows[2])); //row 2 shifted forwards (ignoring 4th value)
                                                                                         //-
-            x = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[1]); //multiply 3 rows together
-            x = _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 0, 2, 2)),
-                           _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 1, 0, 0)))); //add 3 values together into new vector
+            x = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[1]); //multiply 3 rows together
+            x = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 0>(x),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 0, 1>(x),
+                           MMVectorSwizzle<0, 0, 1, 2>(x))); //add 3 values together into new vector
 
             //+
-            y = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[0]); //multiply 3 rows together
-            y = _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 0, 2, 2)),
-                           _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 1, 0, 0)))); //add 3 values together into new vector
+            y = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[0]); //multiply 3 rows together
+            y = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 0>(y),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 0, 1>(y),
+                           MMVectorSwizzle<0, 0, 1, 2>(y))); //add 3 values together into new vector
 
             //wz,ww
-            temp1 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(3, 0, 2, 1)),  //row 0 shifted backwards (ignoring 4th value)
-                               _mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(3, 1, 0, 2))); //row 1 shifted forwards (ignoring 4th value)
-            temp2 = _mm_mul_ps(_mm_shuffle_ps(mat.m_rows[1], mat.m_rows[1], _MM_SHUFFLE(3, 0, 2, 1)),  //row 1 shifted backwards (ignoring 4th value)
-                               _mm_shuffle_ps(mat.m_rows[0], mat.m_rows[0], _MM_SHUFFLE(3, 1, 0, 2))); //row 0 shifted forwards (ignoring 4th value)
+            temp1 = MMVectorMul(MMVectorSwizzle<1, 2, 0, 3>(mat.m_rows[0]),  //row 0 shifted backwards (ignoring 4th value)
+                               MMVectorSwizzle<2, 0, 1, 3>(mat.m_rows[1])); //row 1 shifted forwards (ignoring 4th value)
+            temp2 = MMVectorMul(MMVectorSwizzle<1, 2, 0, 3>(mat.m_rows[1]),  //row 1 shifted backwards (ignoring 4th value)
+                               MMVectorSwizzle<2, 0, 1, 3>(mat.m_rows[0])); //row 0 shifted forwards (ignoring 4th value)
 
             //-
-            z = _mm_mul_ps(_mm_sub_ps(temp2, temp1), mat.m_rows[3]); //multiply 3 rows together
-            z = _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(0, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(z, z, _MM_SHUFFLE(1, 0, 2, 2)),
-                           _mm_shuffle_ps(z, z, _MM_SHUFFLE(2, 1, 0, 0)))); //add 3 values together into new vector
+            z = MMVectorMul(MMVectorSub(temp2, temp1), mat.m_rows[3]); //multiply 3 rows together
+            z = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 0>(z),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 0, 1>(z),
+                           MMVectorSwizzle<0, 0, 1, 2>(z))); //add 3 values together into new vector
 
             //+
-            w = _mm_mul_ps(_mm_sub_ps(temp1, temp2), mat.m_rows[2]); //multiply 3 rows together
-            w = _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 2, 1, 1)),
-                _mm_add_ps(_mm_shuffle_ps(w, w, _MM_SHUFFLE(1, 0, 2, 2)),
-                           _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 1, 0, 0)))); //add 3 values together into new vector
+            w = MMVectorMul(MMVectorSub(temp1, temp2), mat.m_rows[2]); //multiply 3 rows together
+            w = MMVectorAdd(MMVectorSwizzle<1, 1, 2, 0>(w),
+                MMVectorAdd(MMVectorSwizzle<2, 2, 0, 1>(w),
+                           MMVectorSwizzle<0, 0, 1, 2>(w))); //add 3 values together into new vector
 
-            result.m_rows[3] = _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, w));
+            result.m_rows[3] = MMVectorMoveLH(MMVectorMergeXY(x, y), MMVectorMergeXY(z, w));
 
             //calculate determinant usinfg first element in each row
 
-            det = _mm_movelh_ps(_mm_unpacklo_ps(result.m_rows[0], result.m_rows[1]), _mm_unpacklo_ps(result.m_rows[2], result.m_rows[3]));
-            det = _mm_mul_ps(det, mat.m_rows[0]);
-            det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2, 3, 0, 1)));
-            det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(0, 1, 2, 3)));
+            det = MMVectorMoveLH(MMVectorMergeXY(result.m_rows[0], result.m_rows[1]), MMVectorMergeXY(result.m_rows[2], result.m_rows[3]));
+            det = MMVectorMul(det, mat.m_rows[0]);
+            det = MMVectorAdd(det, MMVectorSwizzle<1, 0, 3, 2>(det));
+            det = MMVectorAdd(det, MMVectorSwizzle<3, 2, 1, 0>(det));
+
+            if (determinant)
+                *determinant = MMVectorGetX(det);
+
+            det = MMVectorSplatX(MMVectorReciprocal(det, MMPrecisionDefault()));
+
+            result.m_rows[0] = MMVectorMul(result.m_rows[0], det);
+            result.m_rows[1] = MMVectorMul(result.m_rows[1], det);
+            result.m_rows[2] = MMVectorMul(result.m_rows[2], det);
+            result.m_rows[3] = MMVectorMul(result.m_rows[3], det);
+
+            return result;
+        }
+
+        namespace Internal
+        {
+            /** Inverts the affine transform held in three rows (3x3 part plus w column translation)
+            *
+            * The cross products of the rows are the columns of the adjugate, so dividing them
+            * by the determinant gives the columns of the inverse 3x3. The new translation is
+            * -inverse(3x3) * t, and one transpose of (c0, c1, c2, -t') yields the inverse rows.
+            * \param rows The three rows to invert
+            * \param inverse Receives the three inverse rows
+            * \return The determinant splatted to every lane
+            */
+            inline MMFloat4 _MM_CALLCONV MMAffineInverseRows(const MMFloat4* rows, MMFloat4* inverse)
+            {
+                MMFloat4 c0 = MMVectorCross3(rows[1], rows[2]);
+                MMFloat4 c1 = MMVectorCross3(rows[2], rows[0]);
+                MMFloat4 c2 = MMVectorCross3(rows[0], rows[1]);
+
+                MMFloat4 det = MMVectorDot3V(rows[0], c0);
+                MMFloat4 invDet = MMVectorReciprocal(det, MMPrecisionDefault());
+                c0 = MMVectorMul(c0, invDet);
+                c1 = MMVectorMul(c1, invDet);
+                c2 = MMVectorMul(c2, invDet);
+
+                //gather the translation column as (xw, yw, zw)
+                MMFloat4 t = MMVectorShuffle<2, 3, 3, 3>(MMVectorMergeZW(rows[0], rows[1]), rows[2]);
+
+                MMFloat4 negT = MMVectorMul(c0, MMVectorSplatX(t));
+                negT = MMVectorAdd(negT, MMVectorMul(c1, MMVectorSplatY(t)));
+                negT = MMVectorAdd(negT, MMVectorMul(c2, MMVectorSplatZ(t)));
+                negT = MMVectorSub(MMVectorZero(), negT);
+
+                MMVectorTranspose4(c0, c1, c2, negT);
+                inverse[0] = c0;
+                inverse[1] = c1;
+                inverse[2] = c2;
+                return det;
+            }
+        }
+
+        /** Inverts a matrix whose bottom row is (0, 0, 0, 1)
+        * Roughly a third of the work of MMMatrixInverse. The bottom row is not read.
+        * \param m Affine matrix to invert
+        * \param determinant Receives the determinant of m when not null
+        * \return The inverse of m
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseAffine(FMatrix4 m, float* determinant)
+        {
+            Matrix4 result;
+            MMFloat4 det = Internal::MMAffineInverseRows(m.m_rows, result.m_rows);
+            if (determinant)
+                *determinant = MMVectorGetX(det);
+            return result;
+        }
+
+        /** Inverts a rigid transform, an orthonormal 3x3 rotation plus a translation
+        * The inverse is the transposed rotation with translation -transpose(R) * t, no division
+        * is needed. The result is only correct if m has no scale or shear.
+        * \param m Rigid transform with a (0, 0, 0, 1) bottom row
+        * \return The inverse of m
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseOrthonormal(FMatrix4 m)
+        {
+            MMFloat4 r0 = m.m_rows[0];
+            MMFloat4 r1 = m.m_rows[1];
+            MMFloat4 r2 = m.m_rows[2];
 
-            det = _mm_rcp_ss(det);
-            det = _mm_shuffle_ps(det, det, _MM_SHUFFLE(0, 0, 0, 0));
+            //the columns of transpose(R) are the rows of R
+            MMFloat4 t = MMVectorShuffle<2, 3, 3, 3>(MMVectorMergeZW(r0, r1), r2);
+            MMFloat4 negT = MMVectorMul(r0, MMVectorSplatX(t));
+            negT = MMVectorAdd(negT, MMVectorMul(r1, MMVectorSplatY(t)));
+            negT = MMVectorAdd(negT, MMVectorMul(r2, MMVectorSplatZ(t)));
+            negT = MMVectorSub(MMVectorZero(), negT);
 
-            result.m_rows[0] = _mm_mul_ps(result.m_rows[0], det);
-            result.m_rows[1] = _mm_mul_ps(result.m_rows[1], det);
-            result.m_rows[2] = _mm_mul_ps(result.m_rows[2], det);
-            result.m_rows[3] = _mm_mul_ps(result.m_rows[3], det);
+            MMVectorTranspose4(r0, r1, r2, negT);
 
+            Matrix4 result;
+            result.m_rows[0] = r0;
+            result.m_rows[1] = r1;
+            result.m_rows[2] = r2;
             return result;
         }
 
+        /** Inverts any matrix, taking the affine path when the bottom row is exactly (0, 0, 0, 1)
+        * The check is a single compare of the bottom row.
+        * \param m Matrix to invert
+        * \param determinant Receives the determinant of m when not null
+        * \return The inverse of m
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseAuto(FMatrix4 m, float* determinant)
+        {
+            if (MMMatrixIsAffine(m))
+                return MMMatrixInverseAffine(m, determinant);
+            return MMMatrixInverse(m, determinant);
+        }
+
+        /** Returns the determinant of m without inverting it
+        * Expands along the first row, the six 2x2 minors of the bottom two rows are
+        * shared by all four 3x3 cofactors.
+        * \param m Matrix to take the determinant of
+        * \return The determinant splatted to every lane
+        */
+        inline MMFloat4 _MM_CALLCONV MMMatrixDeterminantV(FMatrix4 m)
+        {
+            static const MMFloat4 sign = MMVectorSet(1.0f, -1.0f, 1.0f, -1.0f);
+
+            //2x2 minors of rows 2 and 3, one set per pair of columns used by each cofactor
+            MMFloat4 p0 = MMVectorMul(MMVectorSwizzle<1, 0, 0, 0>(m.m_rows[2]), MMVectorSwizzle<2, 2, 1, 1>(m.m_rows[3]));
+            MMFloat4 p1 = MMVectorMul(MMVectorSwizzle<1, 0, 0, 0>(m.m_rows[2]), MMVectorSwizzle<3, 3, 3, 2>(m.m_rows[3]));
+            MMFloat4 p2 = MMVectorMul(MMVectorSwizzle<2, 2, 1, 1>(m.m_rows[2]), MMVectorSwizzle<3, 3, 3, 2>(m.m_rows[3]));
+            p0 = MMVectorSub(p0, MMVectorMul(MMVectorSwizzle<2, 2, 1, 1>(m.m_rows[2]), MMVectorSwizzle<1, 0, 0, 0>(m.m_rows[3])));
+            p1 = MMVectorSub(p1, MMVectorMul(MMVectorSwizzle<3, 3, 3, 2>(m.m_rows[2]), MMVectorSwizzle<1, 0, 0, 0>(m.m_rows[3])));
+            p2 = MMVectorSub(p2, MMVectorMul(MMVectorSwizzle<3, 3, 3, 2>(m.m_rows[2]), MMVectorSwizzle<2, 2, 1, 1>(m.m_rows[3])));
+
+            //3x3 minors of rows 1 to 3, lane i leaves out column i
+            MMFloat4 minors = MMVectorMul(MMVectorSwizzle<3, 3, 3, 2>(m.m_rows[1]), p0);
+            minors = MMVectorSub(minors, MMVectorMul(MMVectorSwizzle<2, 2, 1, 1>(m.m_rows[1]), p1));
+            minors = MMVectorAdd(minors, MMVectorMul(MMVectorSwizzle<1, 0, 0, 0>(m.m_rows[1]), p2));
+
+            MMFloat4 det = MMVectorMul(MMVectorMul(m.m_rows[0], sign), minors);
+            det = MMVectorAdd(det, MMVectorSwizzle<1, 0, 3, 2>(det));
+            return MMVectorAdd(det, MMVectorSwizzle<3, 2, 1, 0>(det));
+        }
+
+        inline float _MM_CALLCONV MMMatrixDeterminant(FMatrix4 m)
+        {
+            return MMVectorGetX(MMMatrixDeterminantV(m));
+        }
+
+        /** Returns the determinant of the upper 3x3 block, the part that rotates, scales and mirrors
+        * A negative value means m flips triangle winding.
+        * \return The determinant splatted to every lane
+        */
+        inline MMFloat4 _MM_CALLCONV MMMatrixDeterminant3x3V(FMatrix4 m)
+        {
+            return Internal::MMVectorDot3V(m.m_rows[0], Internal::MMVectorCross3(m.m_rows[1], m.m_rows[2]));
+        }
+
+        inline float _MM_CALLCONV MMMatrixDeterminant3x3(FMatrix4 m)
+        {
+            return MMVectorGetX(MMMatrixDeterminant3x3V(m));
+        }
+
+        //True when the bottom row is exactly (0, 0, 0, 1)
+        inline bool _MM_CALLCONV MMMatrixIsAffine(FMatrix4 m)
+        {
+            return MMVectorEqual(m.m_rows[3], MMVectorSet(0, 0, 0, 1));
+        }
+
+        namespace Internal
+        {
+            //Runs test on wideLaneCount matrices at a time and packs the lane bits, bit i of out[i / 32] is matrix i
+            template <typename WideTest, typename Test>
+            inline void _MM_CALLCONV MMMatrixMaskStream(uint32_t* out, const Matrix4* in, size_t count, WideTest wideTest, Test test)
+            {
+                std::fill(out, out + (count + 31) / 32, 0u);
+
+                size_t i = 0;
+                for (; i + wideLaneCount <= count; i += wideLaneCount)
+                {
+                    uint32_t bits = static_cast<uint32_t>(MMWideMaskToBits(wideTest(MMMatrix4WideLoadAoS(in + i))));
+                    out[i / 32] |= bits << (i % 32);
+                }
+                for (; i < count; i++)
+                {
+                    if (test(in[i]))
+                        out[i / 32] |= 1u << (i % 32);
+                }
+            }
+        }
+
+        /** Writes MMMatrixDeterminant(in[i]) to out[i] for count elements
+        * wideLaneCount matrices are expanded at once, one matrix per lane.
+        */
+        inline void _MM_CALLCONV MMMatrixDeterminantStream(float* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixDeterminantStream");
+
+            size_t i = 0;
+            for (; i + wideLaneCount <= count; i += wideLaneCount)
+                MMWideStoreUnaligned(out + i, MMMatrix4WideDeterminant(MMMatrix4WideLoadAoS(in + i)));
+            for (; i < count; i++)
+                out[i] = MMMatrixDeterminant(in[i]);
+        }
+
+        /** Flags matrices that cannot be inverted safely
+        * \param out Receives (count + 31) / 32 words, bit i of out[i / 32] is set when |det(in[i])| <= epsilon
+        * \param epsilon Largest determinant magnitude treated as singular
+        */
+        inline void _MM_CALLCONV MMMatrixSingularMaskStream(uint32_t* out, const Matrix4* in, size_t count, float epsilon)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixSingularMaskStream");
+
+            const MMFloatW wideEpsilon = MMWideSplat(epsilon);
+            const MMFloatW signBit = MMWideSplat(-0.0f);
+            Internal::MMMatrixMaskStream(out, in, count,
+                [=](const Matrix4Wide& m) {
+                    return MMWideCompareLessEqual(MMWideAndNot(signBit, MMMatrix4WideDeterminant(m)), wideEpsilon);
+                },
+                [=](const Matrix4& m) { return std::fabs(MMMatrixDeterminant(m)) <= epsilon; });
+        }
+
+        /** Flags matrices that mirror geometry, their front faces need the opposite winding
+        * \param out Receives (count + 31) / 32 words, bit i of out[i / 32] is set when the upper 3x3 determinant of in[i] is negative
+        */
+        inline void _MM_CALLCONV MMMatrixMirrorMaskStream(uint32_t* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixMirrorMaskStream");
+
+            const MMFloatW zero = MMWideZero();
+            Internal::MMMatrixMaskStream(out, in, count,
+                [=](const Matrix4Wide& m) { return MMWideCompareLess(MMMatrix4WideDeterminant3x3(m), zero); },
+                [](const Matrix4& m) { return MMMatrixDeterminant3x3(m) < 0.0f; });
+        }
+
+        /** Flags matrices that can take the MMMatrixInverseAffine path
+        * \param out Receives (count + 31) / 32 words, bit i of out[i / 32] is set when MMMatrixIsAffine(in[i])
+        */
+        inline void _MM_CALLCONV MMMatrixAffineMaskStream(uint32_t* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixAffineMaskStream");
+
+            const MMFloatW zero = MMWideZero();
+            const MMFloatW one = MMWideSplat(1.0f);
+            Internal::MMMatrixMaskStream(out, in, count,
+                [=](const Matrix4Wide& m) {
+                    const Vector4Wide& row = m.m_rows[3];
+                    MMMaskW mask = MMWideAnd(MMWideCompareEqual(row.x, zero), MMWideCompareEqual(row.y, zero));
+                    mask = MMWideAnd(mask, MMWideCompareEqual(row.z, zero));
+                    return MMWideAnd(mask, MMWideCompareEqual(row.w, one));
+                },
+                [](const Matrix4& m) { return MMMatrixIsAffine(m); });
+        }
+
+        namespace Internal
+        {
+            /** Modified Gram-Schmidt on the columns of the 3x3 block held in three rows
+            * The x axis keeps its direction, y loses its x component and z loses both, so
+            * mirrored bases stay mirrored. The w lanes of the rows pass through untouched.
+            * \param rows The three rows to repair
+            * \param result Receives the repaired rows, may alias rows
+            */
+            inline void _MM_CALLCONV MMOrthonormalizeRows(const MMFloat4* rows, MMFloat4* result)
+            {
+                MMFloat4 c0 = rows[0];
+                MMFloat4 c1 = rows[1];
+                MMFloat4 c2 = rows[2];
+                MMFloat4 c3 = MMVectorZero();
+                MMVectorTranspose4(c0, c1, c2, c3);
+
+                c0 = MMVectorDivSqrt(c0, MMVectorDot3V(c0, c0), MMPrecisionExact());
+                c1 = MMVectorSub(c1, MMVectorMul(c0, MMVectorDot3V(c1, c0)));
+                c1 = MMVectorDivSqrt(c1, MMVectorDot3V(c1, c1), MMPrecisionExact());
+                c2 = MMVectorSub(c2, MMVectorMul(c0, MMVectorDot3V(c2, c0)));
+                c2 = MMVectorSub(c2, MMVectorMul(c1, MMVectorDot3V(c2, c1)));
+                c2 = MMVectorDivSqrt(c2, MMVectorDot3V(c2, c2), MMPrecisionExact());
+
+                //c3 holds the original w column, transposing back restores it
+                MMVectorTranspose4(c0, c1, c2, c3);
+                result[0] = c0;
+                result[1] = c1;
+                result[2] = c2;
+            }
+
+            inline MMFloatW _MM_CALLCONV MMWideDot3(const MMFloatW* v, const MMFloatW* u)
+            {
+                return MMWideAdd(MMWideAdd(MMWideMul(v[0], u[0]), MMWideMul(v[1], u[1])), MMWideMul(v[2], u[2]));
+            }
+
+            //v -= u * s for the three components
+            inline void _MM_CALLCONV MMWideSubScaled3(MMFloatW* v, const MMFloatW* u, MMFloatW s)
+            {
+                for (int k = 0; k < 3; k++)
+                    v[k] = MMWideSub(v[k], MMWideMul(u[k], s));
+            }
+
+            inline void _MM_CALLCONV MMWideNormalize3(MMFloatW* v)
+            {
+                MMFloatW invLength = MMWideReciprocalSqrt(MMWideDot3(v, v), MMPrecisionExact());
+                for (int k = 0; k < 3; k++)
+                    v[k] = MMWideMul(v[k], invLength);
+            }
+
+            /** Orthonormalizes the first three rows of wideLaneCount consecutive elements at once
+            * T is any type with MMFloat4 m_rows[], every other member is copied unchanged.
+            * The rows are gathered so that column j of every lane sits in columns[j][0..2].
+            */
+            template <typename T>
+            inline void _MM_CALLCONV MMOrthonormalizeStream(T* out, const T* in, size_t count)
+            {
+                MMFloat4 rows[wideLaneCount];
+                MMFloatW columns[3][3];
+                MMFloatW w[3];
+
+                size_t i = 0;
+                for (; i + wideLaneCount <= count; i += wideLaneCount)
+                {
+                    for (int r = 0; r < 3; r++)
+                    {
+                        for (size_t lane = 0; lane < wideLaneCount; lane++)
+                            rows[lane] = in[i + lane].m_rows[r];
+                        MMWideFromRows(rows, columns[0][r], columns[1][r], columns[2][r], w[r]);
+                    }
+
+                    MMWideNormalize3(columns[0]);
+                    MMWideSubScaled3(columns[1], columns[0], MMWideDot3(columns[1], columns[0]));
+                    MMWideNormalize3(columns[1]);
+                    MMWideSubScaled3(columns[2], columns[0], MMWideDot3(columns[2], columns[0]));
+                    MMWideSubScaled3(columns[2], columns[1], MMWideDot3(columns[2], columns[1]));
+                    MMWideNormalize3(columns[2]);
+
+                    for (size_t lane = 0; lane < wideLaneCount; lane++)
+                        out[i + lane] = in[i + lane];
+                    for (int r = 0; r < 3; r++)
+                    {
+                        MMWideToRows(rows, columns[0][r], columns[1][r], columns[2][r], w[r]);
+                        for (size_t lane = 0; lane < wideLaneCount; lane++)
+                            out[i + lane].m_rows[r] = rows[lane];
+                    }
+                }
+
+                for (; i < count; i++)
+                {
+                    out[i] = in[i];
+                    MMOrthonormalizeRows(out[i].m_rows, out[i].m_rows);
+                }
+            }
+        }
+
+        /** Repairs a rotation block that drifted after many multiplications
+        * Gram-Schmidt orthonormalizes the columns of the upper 3x3, keeping the direction
+        * of the x axis. Any scale is removed. The translation and bottom row are kept.
+        * \param m Matrix whose upper 3x3 columns are linearly independent
+        * \return m with an orthonormal upper 3x3
+        */
+        inline Matrix4 _MM_CALLCONV MMMatrixOrthonormalize(FMatrix4 m)
+        {
+            Matrix4 result = m;
+            Internal::MMOrthonormalizeRows(m.m_rows, result.m_rows);
+            return result;
+        }
+
+        /** Writes MMMatrixOrthonormalize(in[i]) to out[i] for count elements
+        * wideLaneCount matrices are repaired at once, one matrix per lane.
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMMatrixOrthonormalizeStream(Matrix4* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixOrthonormalizeStream");
+
+            Internal::MMOrthonormalizeStream(out, in, count);
+        }
+
         /** Generates the inverse translation matrix from the given vector
         * \param v Translation vector to derive inverse from
         * \return The inverse translation matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(const Vector3& v)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(FVector3 v)
         {
             return Matrix4(1, 0, 0, -v.x,
                            0, 1, 0, -v.y,
@@ -390,7 +972,7 @@ namespace Hatchit
         * \param m Translation matrix to derive inverse from
         * \return The inverse of m
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(const Matrix4& m)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseTranslation(FMatrix4 m)
         {
             return Matrix4(1, 0, 0, -m.xw,
                            0, 1, 0, -m.yw,
@@ -402,7 +984,7 @@ namespace Hatchit
         * \param v Roll, pitch, yaw vector
         * \return The inverse rotation matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseRotation(const Vector3& v)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseRotation(FVector3 v)
         {
             Matrix4 rotation = MMMatrixRotationXYZ(v);
             return MMMatrixTranspose(rotation);
@@ -412,7 +994,7 @@ namespace Hatchit
         * \param m Rotation matrix to derive inverse from
         * \return The inverse of m
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseRotation(const Matrix4& m)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseRotation(FMatrix4 m)
         {
             return MMMatrixTranspose(m);
         }
@@ -421,7 +1003,7 @@ namespace Hatchit
         * \param q Quaternion to derive inverse from
         * \return The inverse rotation matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseRotation(const Quaternion& q)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseRotation(FQuaternion q)
         {
             Matrix4 rotation = MMMatrixRotationQuaternion(q);
             return MMMatrixTranspose(rotation);
@@ -431,7 +1013,7 @@ namespace Hatchit
         * \param v Scale vector to derive inverse from
         * \return The inverse scale matrix
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseScale(const Vector3& v)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseScale(FVector3 v)
         {
             return Matrix4(1 / v.x, 0, 0, 0,
                            0, 1 / v.y, 0, 0,
@@ -443,7 +1025,7 @@ namespace Hatchit
         * \param m Scale matrix to derive inverse from
         * \return The inverse of m
         */
-        inline Matrix4 _MM_CALLCONV MMMatrixInverseScale(const Matrix4& m)
+        inline Matrix4 _MM_CALLCONV MMMatrixInverseScale(FMatrix4 m)
         {
             return Matrix4(1 / m.xx, 0, 0, 0,
                            0, 1 / m.yy, 0, 0,
@@ -454,20 +1036,20 @@ namespace Hatchit
         //Creates a 4x4 identity matrix
         inline Matrix4::Matrix4()
         {
-            __m128 v = _mm_set_ss(1);
+            MMFloat4 v = MMVectorSet(1, 0, 0, 0);
             this->m_rows[0] = v;
-            this->m_rows[1] = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 2));
-            this->m_rows[2] = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 0, 2, 2));
-            this->m_rows[3] = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 2, 2, 2));
+            this->m_rows[1] = MMVectorSwizzle<2, 0, 2, 2>(v);
+            this->m_rows[2] = MMVectorSwizzle<2, 2, 0, 2>(v);
+            this->m_rows[3] = MMVectorSwizzle<2, 2, 2, 0>(v);
         }
 
         //Creates a 4x4 matrix from an array of 16 values
         inline Matrix4::Matrix4(const float rawArray[])
         {
-            this->m_rows[0] = _mm_load_ps(rawArray);
-            this->m_rows[1] = _mm_load_ps(rawArray + 4);
-            this->m_rows[2] = _mm_load_ps(rawArray + 8);
-            this->m_rows[3] = _mm_load_ps(rawArray + 12);
+            this->m_rows[0] = MMVectorLoadUnaligned(rawArray);
+            this->m_rows[1] = MMVectorLoadUnaligned(rawArray + 4);
+            this->m_rows[2] = MMVectorLoadUnaligned(rawArray + 8);
+            this->m_rows[3] = MMVectorLoadUnaligned(rawArray + 12);
         }
 
         //Creates a 4x4 matrix from 16 given values (it's recommended to send an array instead)
@@ -476,27 +1058,27 @@ namespace Hatchit
                                 float zx, float zy, float zz, float zw,
                                 float wx, float wy, float wz, float ww)
         {
-            __m128 xx0 = _mm_load_ss(&xx);
-            __m128 xy0 = _mm_load_ss(&xy);
-            __m128 xz0 = _mm_load_ss(&xz);
-            __m128 xw0 = _mm_load_ss(&xw);
-            __m128 yx0 = _mm_load_ss(&yx);
-            __m128 yy0 = _mm_load_ss(&yy);
-            __m128 yz0 = _mm_load_ss(&yz);
-            __m128 yw0 = _mm_load_ss(&yw);
-            __m128 zx0 = _mm_load_ss(&zx);
-            __m128 zy0 = _mm_load_ss(&zy);
-            __m128 zz0 = _mm_load_ss(&zz);
-            __m128 zw0 = _mm_load_ss(&zw);
-            __m128 wx0 = _mm_load_ss(&wx);
-            __m128 wy0 = _mm_load_ss(&wy);
-            __m128 wz0 = _mm_load_ss(&wz);
-            __m128 ww0 = _mm_load_ss(&ww);
-
-            this->m_rows[0] = _mm_movelh_ps(_mm_unpacklo_ps(xx0, xy0), _mm_unpacklo_ps(xz0, xw0));
-            this->m_rows[1] = _mm_movelh_ps(_mm_unpacklo_ps(yx0, yy0), _mm_unpacklo_ps(yz0, yw0));
-            this->m_rows[2] = _mm_movelh_ps(_mm_unpacklo_ps(zx0, zy0), _mm_unpacklo_ps(zz0, zw0));
-            this->m_rows[3] = _mm_movelh_ps(_mm_unpacklo_ps(wx0, wy0), _mm_unpacklo_ps(wz0, ww0));
+            MMFloat4 xx0 = MMVectorLoadScalar(&xx);
+            MMFloat4 xy0 = MMVectorLoadScalar(&xy);
+            MMFloat4 xz0 = MMVectorLoadScalar(&xz);
+            MMFloat4 xw0 = MMVectorLoadScalar(&xw);
+            MMFloat4 yx0 = MMVectorLoadScalar(&yx);
+            MMFloat4 yy0 = MMVectorLoadScalar(&yy);
+            MMFloat4 yz0 = MMVectorLoadScalar(&yz);
+            MMFloat4 yw0 = MMVectorLoadScalar(&yw);
+            MMFloat4 zx0 = MMVectorLoadScalar(&zx);
+            MMFloat4 zy0 = MMVectorLoadScalar(&zy);
+            MMFloat4 zz0 = MMVectorLoadScalar(&zz);
+            MMFloat4 zw0 = MMVectorLoadScalar(&zw);
+            MMFloat4 wx0 = MMVectorLoadScalar(&wx);
+            MMFloat4 wy0 = MMVectorLoadScalar(&wy);
+            MMFloat4 wz0 = MMVectorLoadScalar(&wz);
+            MMFloat4 ww0 = MMVectorLoadScalar(&ww);
+
+            this->m_rows[0] = MMVectorMoveLH(MMVectorMergeXY(xx0, xy0), MMVectorMergeXY(xz0, xw0));
+            this->m_rows[1] = MMVectorMoveLH(MMVectorMergeXY(yx0, yy0), MMVectorMergeXY(yz0, yw0));
+            this->m_rows[2] = MMVectorMoveLH(MMVectorMergeXY(zx0, zy0), MMVectorMergeXY(zz0, zw0));
+            this->m_rows[3] = MMVectorMoveLH(MMVectorMergeXY(wx0, wy0), MMVectorMergeXY(wz0, ww0));
         }
 
         /** Creates a 4x4 matrix from 4 given Vector3s
@@ -510,26 +1092,26 @@ namespace Hatchit
         inline Matrix4::Matrix4(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d)
         {
             float one = 1;
-            __m128 o = _mm_load_ss(&one);
-            __m128 z = _mm_setzero_ps();
-
-            __m128 xx = _mm_load_ss(&a[0]);
-            __m128 xy = _mm_load_ss(&a[1]);
-            __m128 xz = _mm_load_ss(&a[2]);
-            __m128 yx = _mm_load_ss(&b[0]);
-            __m128 yy = _mm_load_ss(&b[1]);
-            __m128 yz = _mm_load_ss(&b[2]);
-            __m128 zx = _mm_load_ss(&c[0]);
-            __m128 zy = _mm_load_ss(&c[1]);
-            __m128 zz = _mm_load_ss(&c[2]);
-            __m128 wx = _mm_load_ss(&d[0]);
-            __m128 wy = _mm_load_ss(&d[1]);
-            __m128 wz = _mm_load_ss(&d[2]);
-
-            this->m_rows[0] = _mm_movelh_ps(_mm_unpacklo_ps(xx, xy), _mm_unpacklo_ps(xz, z));
-            this->m_rows[1] = _mm_movelh_ps(_mm_unpacklo_ps(yx, yy), _mm_unpacklo_ps(yz, z));
-            this->m_rows[2] = _mm_movelh_ps(_mm_unpacklo_ps(zx, zy), _mm_unpacklo_ps(zz, z));
-            this->m_rows[3] = _mm_movelh_ps(_mm_unpacklo_ps(wx, wy), _mm_unpacklo_ps(wz, o));
+            MMFloat4 o = MMVectorLoadScalar(&one);
+            MMFloat4 z = MMVectorZero();
+
+            MMFloat4 xx = MMVectorLoadScalar(&a[0]);
+            MMFloat4 xy = MMVectorLoadScalar(&a[1]);
+            MMFloat4 xz = MMVectorLoadScalar(&a[2]);
+            MMFloat4 yx = MMVectorLoadScalar(&b[0]);
+            MMFloat4 yy = MMVectorLoadScalar(&b[1]);
+            MMFloat4 yz = MMVectorLoadScalar(&b[2]);
+            MMFloat4 zx = MMVectorLoadScalar(&c[0]);
+            MMFloat4 zy = MMVectorLoadScalar(&c[1]);
+            MMFloat4 zz = MMVectorLoadScalar(&c[2]);
+            MMFloat4 wx = MMVectorLoadScalar(&d[0]);
+            MMFloat4 wy = MMVectorLoadScalar(&d[1]);
+            MMFloat4 wz = MMVectorLoadScalar(&d[2]);
+
+            this->m_rows[0] = MMVectorMoveLH(MMVectorMergeXY(xx, xy), MMVectorMergeXY(xz, z));
+            this->m_rows[1] = MMVectorMoveLH(MMVectorMergeXY(yx, yy), MMVectorMergeXY(yz, z));
+            this->m_rows[2] = MMVectorMoveLH(MMVectorMergeXY(zx, zy), MMVectorMergeXY(zz, z));
+            this->m_rows[3] = MMVectorMoveLH(MMVectorMergeXY(wx, wy), MMVectorMergeXY(wz, o));
         }
 
         /** Creates a 4x4 matrix from 4 given Vector4s
@@ -565,24 +1147,24 @@ namespace Hatchit
             for (int i = 0; i < 4; i++)
             {
                 //columns
-                __m128 a = _mm_mul_ps(m_rows[i], other.m_rows[0]);
-                a = _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)));
-                a = _mm_add_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)));
+                MMFloat4 a = MMVectorMul(m_rows[i], other.m_rows[0]);
+                a = MMVectorAdd(a, MMVectorSwizzle<3, 2, 1, 0>(a));
+                a = MMVectorAdd(a, MMVectorSwizzle<1, 0, 3, 2>(a));
 
-                __m128 b = _mm_mul_ps(m_rows[i], other.m_rows[1]);
-                b = _mm_add_ps(b, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 1, 2, 3)));
-                b = _mm_add_ps(b, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 3, 0, 1)));
+                MMFloat4 b = MMVectorMul(m_rows[i], other.m_rows[1]);
+                b = MMVectorAdd(b, MMVectorSwizzle<3, 2, 1, 0>(b));
+                b = MMVectorAdd(b, MMVectorSwizzle<1, 0, 3, 2>(b));
 
-                __m128 c = _mm_mul_ps(m_rows[i], other.m_rows[2]);
-                c = _mm_add_ps(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(0, 1, 2, 3)));
-                c = _mm_add_ps(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(2, 3, 0, 1)));
+                MMFloat4 c = MMVectorMul(m_rows[i], other.m_rows[2]);
+                c = MMVectorAdd(c, MMVectorSwizzle<3, 2, 1, 0>(c));
+                c = MMVectorAdd(c, MMVectorSwizzle<1, 0, 3, 2>(c));
 
-                __m128 d = _mm_mul_ps(m_rows[i], other.m_rows[3]);
-                d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(0, 1, 2, 3)));
-                d = _mm_add_ps(d, _mm_shuffle_ps(d, d, _MM_SHUFFLE(2, 3, 0, 1)));
+                MMFloat4 d = MMVectorMul(m_rows[i], other.m_rows[3]);
+                d = MMVectorAdd(d, MMVectorSwizzle<3, 2, 1, 0>(d));
+                d = MMVectorAdd(d, MMVectorSwizzle<1, 0, 3, 2>(d));
 
                 //combine into one m128 and store in the new matrix
-                result.m_rows[i] = _mm_movelh_ps(_mm_unpacklo_ps(a, b), _mm_unpacklo_ps(c, d));
+                result.m_rows[i] = MMVectorMoveLH(MMVectorMergeXY(a, b), MMVectorMergeXY(c, d));
             }
 
             return result; //newMat;
@@ -597,21 +1179,21 @@ namespace Hatchit
         //{
         //    Vector3 result;
 
-        //    __m128 x = _mm_mul_ps(m_rows[0], vec.m_vector);
-        //    x = _mm_add_ps(x, _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 1, 2, 3)));
-        //    x = _mm_add_ps(x, _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)));
+        //    MMFloat4 x = MMVectorMul(m_rows[0], vec.m_vector);
+        //    x = MMVectorAdd(x, MMVectorSwizzle<3, 2, 1, 0>(x));
+        //    x = MMVectorAdd(x, MMVectorSwizzle<1, 0, 3, 2>(x));
 
-        //    __m128 y = _mm_mul_ps(m_rows[1], vec.m_vector);
-        //    y = _mm_add_ps(y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 1, 2, 3)));
-        //    y = _mm_add_ps(y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1)));
+        //    MMFloat4 y = MMVectorMul(m_rows[1], vec.m_vector);
+        //    y = MMVectorAdd(y, MMVectorSwizzle<3, 2, 1, 0>(y));
+        //    y = MMVectorAdd(y, MMVectorSwizzle<1, 0, 3, 2>(y));
 
-        //    __m128 z = _mm_mul_ps(m_rows[2], vec.m_vector);
-        //    z = _mm_add_ps(z, _mm_shuffle_ps(z, z, _MM_SHUFFLE(0, 1, 2, 3)));
-        //    z = _mm_add_ps(z, _mm_shuffle_ps(z, z, _MM_SHUFFLE(2, 3, 0, 1)));
+        //    MMFloat4 z = MMVectorMul(m_rows[2], vec.m_vector);
+        //    z = MMVectorAdd(z, MMVectorSwizzle<3, 2, 1, 0>(z));
+        //    z = MMVectorAdd(z, MMVectorSwizzle<1, 0, 3, 2>(z));
 
-        //    __m128 w = _mm_setzero_ps();
+        //    MMFloat4 w = MMVectorZero();
 
-        //    result.m_vector = _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, w));
+        //    result.m_vector = MMVectorMoveLH(MMVectorMergeXY(x, y), MMVectorMergeXY(z, w));
 
         //    return result;
         //}
@@ -625,23 +1207,23 @@ namespace Hatchit
         {
             Vector4 result;
 
-            __m128 x = _mm_mul_ps(m_rows[0], vec.m_vector);
-            x = _mm_add_ps(x, _mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 1, 2, 3)));
-            x = _mm_add_ps(x, _mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)));
+            MMFloat4 x = MMVectorMul(m_rows[0], vec.m_vector);
+            x = MMVectorAdd(x, MMVectorSwizzle<3, 2, 1, 0>(x));
+            x = MMVectorAdd(x, MMVectorSwizzle<1, 0, 3, 2>(x));
 
-            __m128 y = _mm_mul_ps(m_rows[1], vec.m_vector);
-            y = _mm_add_ps(y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 1, 2, 3)));
-            y = _mm_add_ps(y, _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1)));
+            MMFloat4 y = MMVectorMul(m_rows[1], vec.m_vector);
+            y = MMVectorAdd(y, MMVectorSwizzle<3, 2, 1, 0>(y));
+            y = MMVectorAdd(y, MMVectorSwizzle<1, 0, 3, 2>(y));
 
-            __m128 z = _mm_mul_ps(m_rows[2], vec.m_vector);
-            z = _mm_add_ps(z, _mm_shuffle_ps(z, z, _MM_SHUFFLE(0, 1, 2, 3)));
-            z = _mm_add_ps(z, _mm_shuffle_ps(z, z, _MM_SHUFFLE(2, 3, 0, 1)));
+            MMFloat4 z = MMVectorMul(m_rows[2], vec.m_vector);
+            z = MMVectorAdd(z, MMVectorSwizzle<3, 2, 1, 0>(z));
+            z = MMVectorAdd(z, MMVectorSwizzle<1, 0, 3, 2>(z));
 
-            __m128 w = _mm_mul_ps(m_rows[3], vec.m_vector);
-            w = _mm_add_ps(w, _mm_shuffle_ps(w, w, _MM_SHUFFLE(0, 1, 2, 3)));
-            w = _mm_add_ps(w, _mm_shuffle_ps(w, w, _MM_SHUFFLE(2, 3, 0, 1)));
+            MMFloat4 w = MMVectorMul(m_rows[3], vec.m_vector);
+            w = MMVectorAdd(w, MMVectorSwizzle<3, 2, 1, 0>(w));
+            w = MMVectorAdd(w, MMVectorSwizzle<1, 0, 3, 2>(w));
 
-            result.m_vector = _mm_movelh_ps(_mm_unpacklo_ps(x, y), _mm_unpacklo_ps(z, w));
+            result.m_vector = MMVectorMoveLH(MMVectorMergeXY(x, y), MMVectorMergeXY(z, w));
 
             return result;
         }
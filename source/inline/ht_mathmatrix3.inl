@@ -0,0 +1,380 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cassert>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        namespace Internal
+        {
+            //Clears the w lane so padded rows stay (x, y, z, 0)
+            inline MMFloat4 _MM_CALLCONV MMMatrix3Row(MMFloat4 v)
+            {
+                static const MMFloat4 maskXYZ = MMVectorSetInt(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0);
+                return MMVectorAnd(v, maskXYZ);
+            }
+
+            //Row of a * b, the rows of b weighted by the lanes of a
+            inline MMFloat4 _MM_CALLCONV MMMatrix3MultiplyRow(MMFloat4 a, const MMFloat4* b)
+            {
+                MMFloat4 result = MMVectorMul(MMVectorSplatX(a), b[0]);
+                result = MMVectorAdd(result, MMVectorMul(MMVectorSplatY(a), b[1]));
+                return MMVectorAdd(result, MMVectorMul(MMVectorSplatZ(a), b[2]));
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // Matrix3
+        /////////////////////////////////////////////////////////
+
+        //Creates a 3x3 identity matrix
+        inline Matrix3::Matrix3()
+        {
+            MMFloat4 v = MMVectorSet(1, 0, 0, 0);
+            m_rows[0] = v;
+            m_rows[1] = MMVectorSwizzle<2, 0, 2, 2>(v);
+            m_rows[2] = MMVectorSwizzle<2, 2, 0, 2>(v);
+        }
+
+        //Creates a 3x3 matrix from an array of 9 row-major values
+        inline Matrix3::Matrix3(const float rawArray[])
+        {
+            m_rows[0] = MMVectorSet(rawArray[0], rawArray[1], rawArray[2], 0);
+            m_rows[1] = MMVectorSet(rawArray[3], rawArray[4], rawArray[5], 0);
+            m_rows[2] = MMVectorSet(rawArray[6], rawArray[7], rawArray[8], 0);
+        }
+
+        //Creates a 3x3 matrix from 9 given values
+        inline Matrix3::Matrix3(float xx, float xy, float xz,
+            float yx, float yy, float yz,
+            float zx, float zy, float zz)
+        {
+            m_rows[0] = MMVectorSet(xx, xy, xz, 0);
+            m_rows[1] = MMVectorSet(yx, yy, yz, 0);
+            m_rows[2] = MMVectorSet(zx, zy, zz, 0);
+        }
+
+        //Creates a 3x3 matrix from 3 Vector3s where each Vector3 is a row
+        inline Matrix3::Matrix3(const Vector3& a, const Vector3& b, const Vector3& c)
+        {
+            m_rows[0] = Internal::MMMatrix3Row(a.m_vector);
+            m_rows[1] = Internal::MMMatrix3Row(b.m_vector);
+            m_rows[2] = Internal::MMMatrix3Row(c.m_vector);
+        }
+
+        //Takes the upper left 3x3 of a Matrix4
+        inline Matrix3::Matrix3(const Matrix4& m)
+        {
+            m_rows[0] = Internal::MMMatrix3Row(m.m_rows[0]);
+            m_rows[1] = Internal::MMMatrix3Row(m.m_rows[1]);
+            m_rows[2] = Internal::MMMatrix3Row(m.m_rows[2]);
+        }
+
+        inline void* Matrix3::operator new(size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void Matrix3::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* Matrix3::operator new[](size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        inline void Matrix3::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        /** Multiplies this Matrix3 by another given Matrix3 and returns the
+        * resulting matrix
+        * \param mat The other Matrix3 to multiply into this one
+        * \return The product of this matrix * mat as a Matrix3
+        */
+        inline Matrix3 Matrix3::operator*(const Matrix3& mat) const
+        {
+            Matrix3 result;
+            result.m_rows[0] = Internal::MMMatrix3MultiplyRow(m_rows[0], mat.m_rows);
+            result.m_rows[1] = Internal::MMMatrix3MultiplyRow(m_rows[1], mat.m_rows);
+            result.m_rows[2] = Internal::MMMatrix3MultiplyRow(m_rows[2], mat.m_rows);
+            return result;
+        }
+
+        /** Multiplies this Matrix3 by a given Vector3 and returns the
+        * resulting Vector3
+        * \param vec The Vector3 to multiply into this matrix
+        * \return The product of this matrix * vec as a Vector3
+        */
+        inline Vector3 Matrix3::operator*(const Vector3& vec) const
+        {
+            MMFloat4 columns[4];
+            Internal::MMAffineColumns(m_rows, columns);
+
+            Vector3 result;
+            result.m_vector = Internal::MMAffineTransformColumns(columns, vec.m_vector, MMVectorZero());
+            return result;
+        }
+
+        /** Fetches a row of this Matrix at the index row
+        * The row is padded to four floats, only [0, 3) is meaningful.
+        */
+        inline float* Matrix3::operator[](int row)
+        {
+            assert(row >= 0 && row < 3);
+            return m_data + row * 4;
+        }
+
+        inline const float* Matrix3::operator[](int row) const
+        {
+            assert(row >= 0 && row < 3);
+            return m_data + row * 4;
+        }
+
+        /** Expands to a Matrix4 laid out as
+        * xx, xy, xz, 0,
+        * yx, yy, yz, 0,
+        * zx, zy, zz, 0,
+        *  0,  0,  0, 1
+        */
+        inline Matrix4 Matrix3::ToMatrix4() const
+        {
+            Matrix4 result;
+            result.m_rows[0] = m_rows[0];
+            result.m_rows[1] = m_rows[1];
+            result.m_rows[2] = m_rows[2];
+            return result;
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM Matrix3 Operations
+        /////////////////////////////////////////////////////////
+
+        inline Matrix3 _MM_CALLCONV MMMatrix3Transpose(FMatrix3 m)
+        {
+            Matrix3 result;
+            MMFloat4 w = MMVectorZero();
+            result.m_rows[0] = m.m_rows[0];
+            result.m_rows[1] = m.m_rows[1];
+            result.m_rows[2] = m.m_rows[2];
+            MMVectorTranspose4(result.m_rows[0], result.m_rows[1], result.m_rows[2], w);
+            return result;
+        }
+
+        /** Inverts a 3x3 matrix through its cofactors
+        * \param m Matrix to invert
+        * \param determinant Receives the determinant of m when not null, a zero
+        * determinant means the returned matrix is not finite
+        * \return The inverse of m
+        */
+        inline Matrix3 _MM_CALLCONV MMMatrix3Inverse(FMatrix3 m, float* determinant)
+        {
+            //the zero w column acts as a zero translation
+            Matrix3 result;
+            MMFloat4 det = Internal::MMAffineInverseRows(m.m_rows, result.m_rows);
+            if (determinant)
+                *determinant = MMVectorGetX(det);
+            return result;
+        }
+
+        inline float _MM_CALLCONV MMMatrix3Determinant(FMatrix3 m)
+        {
+            MMFloat4 cross = Internal::MMVectorCross3(m.m_rows[1], m.m_rows[2]);
+            return MMVectorGetX(Internal::MMVectorDot3V(m.m_rows[0], cross));
+        }
+
+        /** Builds the matrix that transforms normals for m, transpose(inverse(3x3 of m))
+        * The rows of that matrix are the cross products of the rows of m over the
+        * determinant, so no transpose or full inverse is needed.
+        * \param m Transform applied to the positions
+        * \return The normal matrix
+        */
+        inline Matrix3 _MM_CALLCONV MMMatrix3NormalMatrix(FMatrix4 m)
+        {
+            MMFloat4 r0 = Internal::MMMatrix3Row(m.m_rows[0]);
+            MMFloat4 r1 = Internal::MMMatrix3Row(m.m_rows[1]);
+            MMFloat4 r2 = Internal::MMMatrix3Row(m.m_rows[2]);
+
+            MMFloat4 c0 = Internal::MMVectorCross3(r1, r2);
+            MMFloat4 invDet = MMVectorReciprocal(Internal::MMVectorDot3V(r0, c0), MMPrecisionDefault());
+
+            Matrix3 result;
+            result.m_rows[0] = MMVectorMul(c0, invDet);
+            result.m_rows[1] = MMVectorMul(Internal::MMVectorCross3(r2, r0), invDet);
+            result.m_rows[2] = MMVectorMul(Internal::MMVectorCross3(r0, r1), invDet);
+            return result;
+        }
+
+        inline Matrix3 _MM_CALLCONV MMMatrix3RotationQuaternion(FQuaternion q)
+        {
+            return Matrix3(MMMatrixRotationQuaternion(q));
+        }
+
+        inline Matrix3 _MM_CALLCONV MMMatrix3Scale(FVector3 scale)
+        {
+            return Matrix3(scale.x, 0, 0,
+                           0, scale.y, 0,
+                           0, 0, scale.z);
+        }
+
+        //Repairs drift by orthonormalizing the columns, see MMMatrixOrthonormalize
+        inline Matrix3 _MM_CALLCONV MMMatrix3Orthonormalize(FMatrix3 m)
+        {
+            Matrix3 result;
+            Internal::MMOrthonormalizeRows(m.m_rows, result.m_rows);
+            return result;
+        }
+
+        /** Writes a[i] * b[i] to out[i] for count elements
+        * out may alias a or b
+        */
+        inline void _MM_CALLCONV MMMatrix3MultiplyStream(Matrix3* out, const Matrix3* a, const Matrix3* b, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrix3MultiplyStream");
+
+            for (size_t i = 0; i < count; i++)
+            {
+                MMFloat4 r0 = Internal::MMMatrix3MultiplyRow(a[i].m_rows[0], b[i].m_rows);
+                MMFloat4 r1 = Internal::MMMatrix3MultiplyRow(a[i].m_rows[1], b[i].m_rows);
+                MMFloat4 r2 = Internal::MMMatrix3MultiplyRow(a[i].m_rows[2], b[i].m_rows);
+                out[i].m_rows[0] = r0;
+                out[i].m_rows[1] = r1;
+                out[i].m_rows[2] = r2;
+            }
+        }
+
+        /** Writes MMMatrix3Inverse(in[i]) to out[i] for count elements
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMMatrix3InverseStream(Matrix3* out, const Matrix3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrix3InverseStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i] = MMMatrix3Inverse(in[i]);
+        }
+
+        /** Transforms count vectors by one matrix
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMMatrix3TransformStream(Vector3* out, FMatrix3 m, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrix3TransformStream");
+
+            MMFloat4 columns[4];
+            Internal::MMAffineColumns(m.m_rows, columns);
+
+            MMFloat4 zero = MMVectorZero();
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = Internal::MMAffineTransformColumns(columns, in[i].m_vector, zero);
+        }
+
+        //Writes MMMatrix3NormalMatrix(in[i]) to out[i] for count elements
+        inline void _MM_CALLCONV MMMatrix3NormalMatrixStream(Matrix3* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrix3NormalMatrixStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i] = MMMatrix3NormalMatrix(in[i]);
+        }
+
+        /** Writes MMMatrix3Orthonormalize(in[i]) to out[i] for count elements
+        * wideLaneCount matrices are repaired at once, one matrix per lane.
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMMatrix3OrthonormalizeStream(Matrix3* out, const Matrix3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrix3OrthonormalizeStream");
+
+            Internal::MMOrthonormalizeStream(out, in, count);
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM Matrix4 Decomposition
+        /////////////////////////////////////////////////////////
+
+        /** Splits a translation * rotation * scale matrix back into its parts
+        * The scale is the length of each basis column. A mirrored matrix (negative
+        * determinant) is reported as a negative x scale so that the remaining 3x3
+        * is a proper rotation. Shear cannot be represented and is folded into the
+        * rotation.
+        * \param m Affine matrix to decompose, the bottom row is not read
+        * \param translation Receives the translation column
+        * \param rotation Receives the rotation, identity when decomposition fails
+        * \param scale Receives the per-axis scale
+        * \return False if any axis has a (near) zero scale
+        */
+        inline bool _MM_CALLCONV MMMatrixDecompose(FMatrix4 m, Vector3& translation, Quaternion& rotation, Vector3& scale)
+        {
+            static const MMFloat4 signX = MMVectorSetInt(0x80000000, 0, 0, 0);
+            static const MMFloat4 maskW = MMVectorSetInt(0, 0, 0, 0xFFFFFFFF);
+            static const MMFloat4 minScale = MMVectorSplat(1e-6f);
+
+            MMFloat4 r0 = Internal::MMMatrix3Row(m.m_rows[0]);
+            MMFloat4 r1 = Internal::MMMatrix3Row(m.m_rows[1]);
+            MMFloat4 r2 = Internal::MMMatrix3Row(m.m_rows[2]);
+
+            //gather (xw, yw, zw, 0)
+            translation.m_vector = MMVectorShuffle<2, 3, 3, 0>(MMVectorMergeZW(m.m_rows[0], m.m_rows[1]),
+                                                              MMVectorAnd(m.m_rows[2], maskW));
+
+            //column lengths come out lane-wise from the sum of the squared rows
+            MMFloat4 lengthSqr = MMVectorMul(r0, r0);
+            lengthSqr = MMVectorAdd(lengthSqr, MMVectorMul(r1, r1));
+            lengthSqr = MMVectorAdd(lengthSqr, MMVectorMul(r2, r2));
+            MMFloat4 s = MMVectorSqrt(lengthSqr, MMPrecisionExact());
+
+            //move the sign of the determinant onto x
+            MMFloat4 det = Internal::MMVectorDot3V(r0, Internal::MMVectorCross3(r1, r2));
+            s = MMVectorXor(s, MMVectorAnd(det, signX));
+            scale.m_vector = s;
+
+            if (MMMaskAnyTrue(MMVectorCompareLess(MMVectorAbs(s), minScale), 7))
+            {
+                rotation = Quaternion();
+                return false;
+            }
+
+            //the w lane of s is zero, make it one so the reciprocal stays finite
+            MMFloat4 one = MMVectorSplat(1.0f);
+            MMFloat4 invScale = MMVectorReciprocal(MMVectorOr(s, MMVectorAnd(one, maskW)), MMPrecisionExact());
+
+            Matrix3 r;
+            r.m_rows[0] = MMVectorMul(r0, invScale);
+            r.m_rows[1] = MMVectorMul(r1, invScale);
+            r.m_rows[2] = MMVectorMul(r2, invScale);
+            rotation = MMQuaternionFromMatrix3(r);
+            return true;
+        }
+
+        /** Decomposes count matrices into separate translation, rotation and scale arrays
+        * Elements that fail to decompose get an identity rotation.
+        */
+        inline void _MM_CALLCONV MMMatrixDecomposeStream(Vector3* translation, Quaternion* rotation, Vector3* scale, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMMatrixDecomposeStream");
+
+            for (size_t i = 0; i < count; i++)
+                MMMatrixDecompose(in[i], translation[i], rotation[i], scale[i]);
+        }
+    }
+}
@@ -12,177 +12,434 @@
 **
 **/
 
+
 #pragma once
 
+#ifdef HT_MATH_SSE
+#include <ht_mathmmsse.inl>
+#else
+#include <ht_mathmmscalar.inl>
+#endif
+
 namespace Hatchit {
 
     namespace Math {
 
-        inline __m128 _MM_CALLCONV MMVectorZero()
+        inline float _MM_CALLCONV MMVectorGetY(MMFloat4 v)
         {
-            return _mm_setzero_ps();
+            // place y into all locations
+            return MMVectorGetX(MMVectorSplatY(v));
+        }
+
+        inline float _MM_CALLCONV MMVectorGetZ(MMFloat4 v)
+        {
+            //place z into all locations
+            return MMVectorGetX(MMVectorSplatZ(v));
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSet(float x, float y, float z, float w)
+        inline float _MM_CALLCONV MMVectorGetW(MMFloat4 v)
         {
-            return _mm_set_ps(w, z, y, x);
+            //place w into all locations
+            return MMVectorGetX(MMVectorSplatW(v));
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetInt(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+        inline void _MM_CALLCONV MMVectorGetXRaw(float* x, MMFloat4 v)
         {
-            __m128i v = _mm_set_epi32(w, z, y, x);
+            MMVectorStoreScalar(x, v);
+        }
 
-            return _mm_castsi128_ps(v);
+        inline void _MM_CALLCONV MMVectorGetYRaw(float* y, MMFloat4 v)
+        {
+            MMVectorStoreScalar(y, MMVectorSplatY(v));
         }
 
-        inline float _MM_CALLCONV MMVectorGetX(__m128 v)
+        inline void _MM_CALLCONV MMVectorGetZRaw(float* z, MMFloat4 v)
         {
-            //extract the lowest bit value (x)
-            return _mm_cvtss_f32(v);
+            MMVectorStoreScalar(z, MMVectorSplatZ(v));
         }
 
-        inline float _MM_CALLCONV MMVectorGetY(__m128 v)
+        inline void _MM_CALLCONV MMVectorGetWRaw(float* w, MMFloat4 v)
         {
-            // place y into all locations
-            __m128 temp = _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+            MMVectorStoreScalar(w, MMVectorSplatW(v));
+        }
 
-            return _mm_cvtss_f32(temp);
+        inline MMFloat4 _MM_CALLCONV MMVectorSetX(MMFloat4 v, float x)
+        {
+            //move Y, Z, W values from v next to the new X
+            return MMVectorMoveX(v, MMVectorSplat(x));
         }
 
-        inline float _MM_CALLCONV MMVectorGetZ(__m128 v)
+        inline MMFloat4 _MM_CALLCONV MMVectorSetY(MMFloat4 v, float y)
         {
-            //place z into all locations
-            __m128 temp = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+            //swap Y and X. RESULT: (yOrig, xOrig, zOrig, wOrig)
+            MMFloat4 result = MMVectorShuffle<1, 0, 2, 3>(v, v);
 
-            return _mm_cvtss_f32(temp);
+            result = MMVectorMoveX(result, MMVectorSplat(y)); //RESULT: (y, xOrig, zOrig, wOrig)
+            //swap Y and X back. RESULT: (xOrig, y, zOrig, wOrig)
+            return MMVectorShuffle<1, 0, 2, 3>(result, result);
         }
 
-        inline float _MM_CALLCONV MMVectorGetW(__m128 v)
+        inline MMFloat4 _MM_CALLCONV MMVectorSetZ(MMFloat4 v, float z)
         {
-            //place w into all locations
-            __m128 temp = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+            MMFloat4 result = MMVectorShuffle<2, 1, 0, 3>(v, v);
+
+            result = MMVectorMoveX(result, MMVectorSplat(z));
+            return MMVectorShuffle<2, 1, 0, 3>(result, result);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSetW(MMFloat4 v, float w)
+        {
+            MMFloat4 result = MMVectorShuffle<3, 1, 2, 0>(v, v);
 
-            return _mm_cvtss_f32(temp);
+            result = MMVectorMoveX(result, MMVectorSplat(w));
+            return MMVectorShuffle<3, 1, 2, 0>(result, result);
         }
 
-        inline void _MM_CALLCONV MMVectorGetXRaw(float* x, __m128 v)
+        inline MMFloat4 _MM_CALLCONV MMVectorSetXRaw(MMFloat4 v, const float* x)
         {
-            _mm_store_ss(x, v);
+            return MMVectorMoveX(v, MMVectorLoadScalar(x));
         }
 
-        inline void _MM_CALLCONV MMVectorGetYRaw(float* y, __m128 v)
+        inline MMFloat4 _MM_CALLCONV MMVectorSetYRaw(MMFloat4 v, const float* y)
         {
-            _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1));
+            MMFloat4 result = MMVectorShuffle<1, 0, 2, 3>(v, v);
 
-            _mm_store_ss(y, v);
+            result = MMVectorMoveX(result, MMVectorLoadScalar(y));
+            return MMVectorShuffle<1, 0, 2, 3>(result, result);
         }
 
-        inline void _MM_CALLCONV MMVectorGetZRaw(float* z, __m128 v)
+        inline MMFloat4 _MM_CALLCONV MMVectorSetZRaw(MMFloat4 v, const float* z)
         {
-            _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2));
+            MMFloat4 result = MMVectorShuffle<2, 1, 0, 3>(v, v);
 
-            _mm_store_ss(z, v);
+            result = MMVectorMoveX(result, MMVectorLoadScalar(z));
+            return MMVectorShuffle<2, 1, 0, 3>(result, result);
         }
 
-        inline void _MM_CALLCONV MMVectorGetWRaw(float* w, __m128 v)
+        inline MMFloat4 _MM_CALLCONV MMVectorSetWRaw(MMFloat4 v, const float* w)
         {
-            _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+            MMFloat4 result = MMVectorShuffle<3, 1, 2, 0>(v, v);
 
-            _mm_store_ss(w, v);
+            result = MMVectorMoveX(result, MMVectorLoadScalar(w));
+            return MMVectorShuffle<3, 1, 2, 0>(result, result);
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetX(__m128 v, float x)
+        inline MMFloat4 _MM_CALLCONV MMVectorSplatX(MMFloat4 v)
         {
-            //set X value, rest default to 0
-            __m128 result = _mm_set_ss(x);
+            return MMVectorShuffle<0, 0, 0, 0>(v, v);
+        }
 
-            //move Y, Z, W values to result
-            result = _mm_move_ss(v, result);
+        inline MMFloat4 _MM_CALLCONV MMVectorSplatY(MMFloat4 v)
+        {
+            return MMVectorShuffle<1, 1, 1, 1>(v, v);
+        }
 
-            return result;
+        inline MMFloat4 _MM_CALLCONV MMVectorSplatZ(MMFloat4 v)
+        {
+            return MMVectorShuffle<2, 2, 2, 2>(v, v);
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetY(__m128 v, float y)
+        inline MMFloat4 _MM_CALLCONV MMVectorSplatW(MMFloat4 v)
         {
-            //swap Y and X. RESULT: (yOrig, xOrig, zOrig, wOrig)
-            __m128 result = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 2, 0, 1));
-            __m128 temp = _mm_set_ss(y); // RESULT: (y, 0, 0, 0)
+            return MMVectorShuffle<3, 3, 3, 3>(v, v);
+        }
 
-            result = _mm_move_ss(result, temp); //RESULT: (y, xOrig, zOrig, wOrig)
-            //swap Y and X back. RESULT: (xOrig, y, zOrig, wOrig)
-            result = _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 2, 0, 1));
+        namespace Internal
+        {
+            //Swizzles default to a single shuffle, the patterns below have a cheaper (or shorter) form
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMSwizzleHelper
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v) { return MMVectorShuffle<X, Y, Z, W>(v, v); }
+            };
+
+            template <> struct MMSwizzleHelper<0, 1, 2, 3>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v) { return v; }
+            };
+
+            template <> struct MMSwizzleHelper<0, 0, 1, 1>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v) { return MMVectorMergeXY(v, v); }
+            };
+
+            template <> struct MMSwizzleHelper<2, 2, 3, 3>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v) { return MMVectorMergeZW(v, v); }
+            };
+
+            template <> struct MMSwizzleHelper<0, 1, 0, 1>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v) { return MMVectorMoveLH(v, v); }
+            };
+
+            template <> struct MMSwizzleHelper<2, 3, 2, 3>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v) { return MMVectorMoveHL(v, v); }
+            };
+
+            /** Classifies a permute by where its lanes come from
+            * 0: only v, 1: only u, 2: low half v/high half u, 3: low half u/high half v,
+            * 4: every lane stays in place (pure blend), 5: anything else
+            */
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteKind
+            {
+                static const uint32_t value =
+                    (X < 4 && Y < 4 && Z < 4 && W < 4) ? 0 :
+                    (X > 3 && Y > 3 && Z > 3 && W > 3) ? 1 :
+                    (X < 4 && Y < 4 && Z > 3 && W > 3) ? 2 :
+                    (X > 3 && Y > 3 && Z < 4 && W < 4) ? 3 :
+                    ((X & 3) == 0 && (Y & 3) == 1 && (Z & 3) == 2 && (W & 3) == 3) ? 4 : 5;
+            };
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W, uint32_t Kind = MMPermuteKind<X, Y, Z, W>::value>
+            struct MMPermuteHelper;
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteHelper<X, Y, Z, W, 0>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4) { return MMSwizzleHelper<X, Y, Z, W>::Apply(v); }
+            };
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteHelper<X, Y, Z, W, 1>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4, MMFloat4 u) { return MMSwizzleHelper<X - 4, Y - 4, Z - 4, W - 4>::Apply(u); }
+            };
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteHelper<X, Y, Z, W, 2>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorShuffle<X, Y, Z - 4, W - 4>(v, u); }
+            };
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteHelper<X, Y, Z, W, 3>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorShuffle<X - 4, Y - 4, Z, W>(u, v); }
+            };
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteHelper<X, Y, Z, W, 4>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorBlend<(X >> 2), (Y >> 2), (Z >> 2), (W >> 2)>(v, u); }
+            };
+
+            template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+            struct MMPermuteHelper<X, Y, Z, W, 5>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u)
+                {
+                    return MMVectorBlend<(X >> 2), (Y >> 2), (Z >> 2), (W >> 2)>(MMSwizzleHelper<(X & 3), (Y & 3), (Z & 3), (W & 3)>::Apply(v),
+                                                                                 MMSwizzleHelper<(X & 3), (Y & 3), (Z & 3), (W & 3)>::Apply(u));
+                }
+            };
+
+            template <> struct MMPermuteHelper<0, 1, 4, 5, 2>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorMoveLH(v, u); }
+            };
+
+            template <> struct MMPermuteHelper<6, 7, 2, 3, 3>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorMoveHL(v, u); }
+            };
+
+            template <> struct MMPermuteHelper<0, 4, 1, 5, 5>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorMergeXY(v, u); }
+            };
+
+            template <> struct MMPermuteHelper<2, 6, 3, 7, 5>
+            {
+                static MMFloat4 _MM_CALLCONV Apply(MMFloat4 v, MMFloat4 u) { return MMVectorMergeZW(v, u); }
+            };
+        }
 
-            return result;
+        /** Rearranges the lanes of v as (v[X], v[Y], v[Z], v[W])
+        * Resolved at compile time to a single shuffle, unpack or move
+        * (or nothing at all for the identity swizzle).
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline MMFloat4 _MM_CALLCONV MMVectorSwizzle(MMFloat4 v)
+        {
+            static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Swizzle indices must be in the range [0, 3]");
+            return Internal::MMSwizzleHelper<X, Y, Z, W>::Apply(v);
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetZ(__m128 v, float z)
+        /** Builds a vector from any lanes of v (indices 0-3) and u (indices 4-7)
+        * Resolved at compile time to a shuffle, unpack, move or blend where the
+        * pattern allows it, and to two swizzles plus a blend otherwise.
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline MMFloat4 _MM_CALLCONV MMVectorPermute(MMFloat4 v, MMFloat4 u)
         {
-            __m128 result = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2));
-            __m128 temp = _mm_set_ss(z);
+            static_assert(X < 8 && Y < 8 && Z < 8 && W < 8, "Permute indices must be in the range [0, 7]");
+            return Internal::MMPermuteHelper<X, Y, Z, W>::Apply(v, u);
+        }
 
-            result = _mm_move_ss(result, temp);
-            result = _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 1, 2));
+        //Transposes the 4x4 matrix held in r0..r3 in place (same sequence as _MM_TRANSPOSE4_PS)
+        inline void _MM_CALLCONV MMVectorTranspose4(MMFloat4& r0, MMFloat4& r1, MMFloat4& r2, MMFloat4& r3)
+        {
+            MMFloat4 temp0 = MMVectorMergeXY(r0, r1);
+            MMFloat4 temp1 = MMVectorMergeXY(r2, r3);
+            MMFloat4 temp2 = MMVectorMergeZW(r0, r1);
+            MMFloat4 temp3 = MMVectorMergeZW(r2, r3);
+
+            r0 = MMVectorMoveLH(temp0, temp1);
+            r1 = MMVectorMoveHL(temp1, temp0);
+            r2 = MMVectorMoveLH(temp2, temp3);
+            r3 = MMVectorMoveHL(temp3, temp2);
+        }
 
-            return result;
+        inline bool _MM_CALLCONV MMVectorEqual(MMFloat4 v, MMFloat4 u)
+        {
+            return MMMaskToBits(MMVectorCompareEqual(v, u)) == 15;
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetW(__m128 v, float w)
+        //1 / v, correctly rounded
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocal(MMFloat4 v, MMPrecisionExact)
         {
-            __m128 result = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 2, 1, 3));
-            __m128 temp = _mm_set_ss(w);
+            return MMVectorDiv(MMVectorSplat(1.0f), v);
+        }
 
-            result = _mm_move_ss(result, temp);
-            result = _mm_shuffle_ps(result, result, _MM_SHUFFLE(0, 2, 1, 3));
+        /** 1 / v from rcpps refined with one Newton-Raphson step, x1 = x0 * (2 - v * x0)
+        * Relative error is below 2^-22 (~2.4e-7) for normal inputs.
+        * NOTE: 0 and infinity produce NaN instead of infinity and 0.
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocal(MMFloat4 v, MMPrecisionFast)
+        {
+            MMFloat4 est = MMVectorReciprocalEst(v);
+            return MMVectorMul(est, MMVectorSub(MMVectorSplat(2.0f), MMVectorMul(v, est)));
+        }
 
-            return result;
+        //1 / sqrt(v), correctly rounded sqrt followed by a correctly rounded division
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrt(MMFloat4 v, MMPrecisionExact)
+        {
+            return MMVectorDiv(MMVectorSplat(1.0f), MMVectorSqrt(v));
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetXRaw(__m128 v, const float* x)
+        /** 1 / sqrt(v) from rsqrtps refined with one Newton-Raphson step, y1 = 0.5 * y0 * (3 - v * y0 * y0)
+        * Relative error is below 2^-21 (~4.8e-7) for normal inputs.
+        * NOTE: 0 and infinity produce NaN instead of infinity and 0.
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrt(MMFloat4 v, MMPrecisionFast)
         {
-            __m128 result = _mm_load_ss(x);
+            MMFloat4 est = MMVectorReciprocalSqrtEst(v);
+            MMFloat4 estSq = MMVectorMul(est, est);
+            MMFloat4 halfEst = MMVectorMul(MMVectorSplat(0.5f), est);
+            return MMVectorMul(halfEst, MMVectorSub(MMVectorSplat(3.0f), MMVectorMul(v, estSq)));
+        }
 
-            result = _mm_move_ss(v, result);
+        //v / u, correctly rounded
+        inline MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u, MMPrecisionExact)
+        {
+            return MMVectorDiv(v, u);
+        }
 
-            return result;
+        /** v * (1 / u) with the fast reciprocal
+        * Relative error is below 2^-21 (~4.8e-7) for normal inputs.
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u, MMPrecisionFast)
+        {
+            return MMVectorMul(v, MMVectorReciprocal(u, MMPrecisionFast()));
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetYRaw(__m128 v, const float* y)
+        //sqrt(v), correctly rounded
+        inline MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v, MMPrecisionExact)
         {
-            __m128 result = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 2, 0, 1));
-            __m128 temp = _mm_load_ss(y);
+            return MMVectorSqrt(v);
+        }
 
-            result = _mm_move_ss(result, temp);
-            result = _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 2, 0, 1));
+        /** v * (1 / sqrt(v)) with the fast reciprocal sqrt, zero lanes stay zero
+        * Relative error is below 2^-21 (~4.8e-7) for normal inputs.
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v, MMPrecisionFast)
+        {
+            MMFloat4 root = MMVectorMul(v, MMVectorReciprocalSqrt(v, MMPrecisionFast()));
+            return MMVectorSelect(MMVectorCompareEqual(v, MMVectorZero()), v, root);
+        }
 
-            return result;
+        namespace Internal
+        {
+            //v / sqrt(lengthSq), the shared tail of every Normalize
+            inline MMFloat4 _MM_CALLCONV MMVectorDivSqrt(MMFloat4 v, MMFloat4 lengthSq, MMPrecisionExact)
+            {
+                return MMVectorDiv(v, MMVectorSqrt(lengthSq));
+            }
+
+            //v * rsqrt(lengthSq), one refined estimate instead of a sqrt and a reciprocal
+            inline MMFloat4 _MM_CALLCONV MMVectorDivSqrt(MMFloat4 v, MMFloat4 lengthSq, MMPrecisionFast)
+            {
+                return MMVectorMul(v, MMVectorReciprocalSqrt(lengthSq, MMPrecisionFast()));
+            }
+
+            //Cross product of the xyz lanes, the w lane is v.w * u.w - v.w * u.w
+            inline MMFloat4 _MM_CALLCONV MMVectorCross3(MMFloat4 v, MMFloat4 u)
+            {
+                MMFloat4 a = MMVectorMul(MMVectorSwizzle<1, 2, 0, 3>(v), MMVectorSwizzle<2, 0, 1, 3>(u));
+                MMFloat4 b = MMVectorMul(MMVectorSwizzle<2, 0, 1, 3>(v), MMVectorSwizzle<1, 2, 0, 3>(u));
+                return MMVectorSub(a, b);
+            }
+
+            //Dot product of the xyz lanes splatted to every lane
+            inline MMFloat4 _MM_CALLCONV MMVectorDot3V(MMFloat4 v, MMFloat4 u)
+            {
+                MMFloat4 sq = MMVectorMul(v, u);
+                MMFloat4 temp = MMVectorAdd(sq, MMVectorSwizzle<2, 0, 1, 3>(sq));
+                temp = MMVectorAdd(temp, MMVectorSwizzle<1, 2, 0, 3>(sq));
+                return MMVectorSplatX(temp);
+            }
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetZRaw(__m128 v, const float* z)
+        //Clears the sign bit of every lane
+        inline MMFloat4 _MM_CALLCONV MMVectorAbs(MMFloat4 v)
         {
-            __m128 result = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 0, 1, 2));
-            __m128 temp = _mm_load_ss(z);
+            return MMVectorAndNot(MMVectorSplat(-0.0f), v);
+        }
 
-            result = _mm_move_ss(result, temp);
-            result = _mm_shuffle_ps(result, result, _MM_SHUFFLE(3, 0, 1, 2));
+        /** Clamps every lane of v into [min, max]
+        * \param min Lower bound per lane, must not exceed max
+        * \param max Upper bound per lane
+        * \return The clamped vector
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorClamp(MMFloat4 v, MMFloat4 min, MMFloat4 max)
+        {
+            return MMVectorMin(MMVectorMax(v, min), max);
+        }
 
-            return result;
+        /** Compares two vectors within a tolerance
+        * \param epsilon Per-lane tolerance, lanes match where |v - u| <= epsilon
+        * \return Mask of the lanes that are near equal
+        */
+        inline MMMask4 _MM_CALLCONV MMVectorNearEqual(MMFloat4 v, MMFloat4 u, MMFloat4 epsilon)
+        {
+            return MMVectorCompareLessEqual(MMVectorAbs(MMVectorSub(v, u)), epsilon);
         }
 
-        inline __m128 _MM_CALLCONV MMVectorSetWRaw(__m128 v, const float* w)
+        //Sets each lane of the mask that holds a NaN
+        inline MMMask4 _MM_CALLCONV MMVectorIsNaN(MMFloat4 v)
         {
-            __m128 result = _mm_shuffle_ps(v, v, _MM_SHUFFLE(0, 2, 1, 3));
-            __m128 temp = _mm_load_ss(w);
+            return MMVectorCompareNotEqual(v, v);
+        }
 
-            result = _mm_move_ss(result, temp);
-            result = _mm_shuffle_ps(result, result, _MM_SHUFFLE(0, 2, 1, 3));
+        //Sets each lane of the mask that holds positive or negative infinity
+        inline MMMask4 _MM_CALLCONV MMVectorIsInf(MMFloat4 v)
+        {
+            return MMVectorCompareEqual(MMVectorAbs(v), MMVectorSetInt(0x7F800000, 0x7F800000, 0x7F800000, 0x7F800000));
+        }
 
-            return result;
+        //Returns true if every lane selected by laneBits is set in the mask
+        inline bool _MM_CALLCONV MMMaskAllTrue(MMMask4 m, int laneBits)
+        {
+            return (MMMaskToBits(m) & laneBits) == laneBits;
         }
 
-        inline bool _MM_CALLCONV MMVectorEqual(__m128 v, __m128 u)
+        //Returns true if any lane selected by laneBits is set in the mask
+        inline bool _MM_CALLCONV MMMaskAnyTrue(MMMask4 m, int laneBits)
         {
-            __m128 compMask = _mm_cmpeq_ps(v, u);
-            return _mm_movemask_ps(compMask) == 15;
+            return (MMMaskToBits(m) & laneBits) != 0;
         }
     }
 }
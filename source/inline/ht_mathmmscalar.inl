@@ -0,0 +1,337 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cmath>
+
+/**
+* Scalar reference backend for the MM intrinsic layer.
+*
+* Mirrors ht_mathmmsse.inl lane for lane using plain float arithmetic.
+* The estimate functions return exact results here, so comparisons against
+* SSE builds should allow for the ~12 bit precision of rcpps/rsqrtps.
+*/
+
+namespace Hatchit {
+
+    namespace Math {
+
+        inline MMFloat4 _MM_CALLCONV MMVectorZero()
+        {
+            MMFloat4 result;
+            result.f[0] = result.f[1] = result.f[2] = result.f[3] = 0.0f;
+            return result;
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSet(float x, float y, float z, float w)
+        {
+            MMFloat4 result;
+            result.f[0] = x;
+            result.f[1] = y;
+            result.f[2] = z;
+            result.f[3] = w;
+            return result;
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSetInt(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+        {
+            MMFloat4 result;
+            result.u[0] = x;
+            result.u[1] = y;
+            result.u[2] = z;
+            result.u[3] = w;
+            return result;
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSplat(float s)
+        {
+            return MMVectorSet(s, s, s, s);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoad(const float* p)
+        {
+            return MMVectorSet(p[0], p[1], p[2], p[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadUnaligned(const float* p)
+        {
+            return MMVectorSet(p[0], p[1], p[2], p[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadScalar(const float* p)
+        {
+            return MMVectorSet(p[0], 0.0f, 0.0f, 0.0f);
+        }
+
+        inline void _MM_CALLCONV MMVectorStore(float* p, MMFloat4 v)
+        {
+            for (int i = 0; i < 4; i++)
+                p[i] = v.f[i];
+        }
+
+        inline void _MM_CALLCONV MMVectorStoreUnaligned(float* p, MMFloat4 v)
+        {
+            for (int i = 0; i < 4; i++)
+                p[i] = v.f[i];
+        }
+
+        inline void _MM_CALLCONV MMVectorStoreScalar(float* p, MMFloat4 v)
+        {
+            p[0] = v.f[0];
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadFloat3(const Float3* p)
+        {
+            return MMVectorSet(p->x, p->y, p->z, 0.0f);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadFloat3A(const Float3A* p)
+        {
+            return MMVectorSet(p->x, p->y, p->z, 0.0f);
+        }
+
+        inline void _MM_CALLCONV MMVectorStoreFloat3(Float3* p, MMFloat4 v)
+        {
+            p->x = v.f[0];
+            p->y = v.f[1];
+            p->z = v.f[2];
+        }
+
+        inline float _MM_CALLCONV MMVectorGetX(MMFloat4 v)
+        {
+            return v.f[0];
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorAdd(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[0] + u.f[0], v.f[1] + u.f[1], v.f[2] + u.f[2], v.f[3] + u.f[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSub(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[0] - u.f[0], v.f[1] - u.f[1], v.f[2] - u.f[2], v.f[3] - u.f[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorMul(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[0] * u.f[0], v.f[1] * u.f[1], v.f[2] * u.f[2], v.f[3] * u.f[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[0] / u.f[0], v.f[1] / u.f[1], v.f[2] / u.f[2], v.f[3] / u.f[3]);
+        }
+
+        //Same operand order as minps: returns u whenever the comparison is false (NaN)
+        inline MMFloat4 _MM_CALLCONV MMVectorMin(MMFloat4 v, MMFloat4 u)
+        {
+            MMFloat4 result;
+            for (int i = 0; i < 4; i++)
+                result.f[i] = (v.f[i] < u.f[i]) ? v.f[i] : u.f[i];
+            return result;
+        }
+
+        //Same operand order as maxps: returns u whenever the comparison is false (NaN)
+        inline MMFloat4 _MM_CALLCONV MMVectorMax(MMFloat4 v, MMFloat4 u)
+        {
+            MMFloat4 result;
+            for (int i = 0; i < 4; i++)
+                result.f[i] = (v.f[i] > u.f[i]) ? v.f[i] : u.f[i];
+            return result;
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v)
+        {
+            return MMVectorSet(sqrtf(v.f[0]), sqrtf(v.f[1]), sqrtf(v.f[2]), sqrtf(v.f[3]));
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorFloor(MMFloat4 v)
+        {
+            return MMVectorSet(std::floor(v.f[0]), std::floor(v.f[1]), std::floor(v.f[2]), std::floor(v.f[3]));
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorCeil(MMFloat4 v)
+        {
+            return MMVectorSet(std::ceil(v.f[0]), std::ceil(v.f[1]), std::ceil(v.f[2]), std::ceil(v.f[3]));
+        }
+
+        //Uses the current rounding mode, which is ties to even unless changed, to match roundps
+        inline MMFloat4 _MM_CALLCONV MMVectorRound(MMFloat4 v)
+        {
+            return MMVectorSet(std::nearbyint(v.f[0]), std::nearbyint(v.f[1]), std::nearbyint(v.f[2]), std::nearbyint(v.f[3]));
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocalEst(MMFloat4 v)
+        {
+            return MMVectorSet(1.0f / v.f[0], 1.0f / v.f[1], 1.0f / v.f[2], 1.0f / v.f[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrtEst(MMFloat4 v)
+        {
+            return MMVectorSet(1.0f / sqrtf(v.f[0]), 1.0f / sqrtf(v.f[1]), 1.0f / sqrtf(v.f[2]), 1.0f / sqrtf(v.f[3]));
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorAnd(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSetInt(v.u[0] & u.u[0], v.u[1] & u.u[1], v.u[2] & u.u[2], v.u[3] & u.u[3]);
+        }
+
+        //Computes (~v) & u, matching _mm_andnot_ps
+        inline MMFloat4 _MM_CALLCONV MMVectorAndNot(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSetInt(~v.u[0] & u.u[0], ~v.u[1] & u.u[1], ~v.u[2] & u.u[2], ~v.u[3] & u.u[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorOr(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSetInt(v.u[0] | u.u[0], v.u[1] | u.u[1], v.u[2] | u.u[2], v.u[3] | u.u[3]);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorXor(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSetInt(v.u[0] ^ u.u[0], v.u[1] ^ u.u[1], v.u[2] ^ u.u[2], v.u[3] ^ u.u[3]);
+        }
+
+        /** Builds (v[X], v[Y], u[Z], u[W])
+        * Indices are given in x, y, z, w order, the reverse of _MM_SHUFFLE
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline MMFloat4 _MM_CALLCONV MMVectorShuffle(MMFloat4 v, MMFloat4 u)
+        {
+            static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Shuffle indices must be in the range [0, 3]");
+            return MMVectorSet(v.f[X], v.f[Y], u.f[Z], u.f[W]);
+        }
+
+        //Picks each lane from v (selector 0) or u (selector 1)
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline MMFloat4 _MM_CALLCONV MMVectorBlend(MMFloat4 v, MMFloat4 u)
+        {
+            static_assert(X < 2 && Y < 2 && Z < 2 && W < 2, "Blend selectors must be 0 or 1");
+            return MMVectorSet(X ? u.f[0] : v.f[0], Y ? u.f[1] : v.f[1], Z ? u.f[2] : v.f[2], W ? u.f[3] : v.f[3]);
+        }
+
+        //Returns (u.x, v.y, v.z, v.w)
+        inline MMFloat4 _MM_CALLCONV MMVectorMoveX(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(u.f[0], v.f[1], v.f[2], v.f[3]);
+        }
+
+        //Returns (v.x, v.y, u.x, u.y)
+        inline MMFloat4 _MM_CALLCONV MMVectorMoveLH(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[0], v.f[1], u.f[0], u.f[1]);
+        }
+
+        //Returns (u.z, u.w, v.z, v.w)
+        inline MMFloat4 _MM_CALLCONV MMVectorMoveHL(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(u.f[2], u.f[3], v.f[2], v.f[3]);
+        }
+
+        //Returns (v.x, u.x, v.y, u.y)
+        inline MMFloat4 _MM_CALLCONV MMVectorMergeXY(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[0], u.f[0], v.f[1], u.f[1]);
+        }
+
+        //Returns (v.z, u.z, v.w, u.w)
+        inline MMFloat4 _MM_CALLCONV MMVectorMergeZW(MMFloat4 v, MMFloat4 u)
+        {
+            return MMVectorSet(v.f[2], u.f[2], v.f[3], u.f[3]);
+        }
+
+        inline MMMask4 _MM_CALLCONV MMVectorCompareEqual(MMFloat4 v, MMFloat4 u)
+        {
+            MMMask4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (v.f[i] == u.f[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        //Sets each lane of the mask where v != u (NaN lanes compare not equal)
+        inline MMMask4 _MM_CALLCONV MMVectorCompareNotEqual(MMFloat4 v, MMFloat4 u)
+        {
+            MMMask4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (v.f[i] != u.f[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        //Sets each lane of the mask where v < u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareLess(MMFloat4 v, MMFloat4 u)
+        {
+            MMMask4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (v.f[i] < u.f[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        //Sets each lane of the mask where v <= u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareLessEqual(MMFloat4 v, MMFloat4 u)
+        {
+            MMMask4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (v.f[i] <= u.f[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        //Sets each lane of the mask where v > u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareGreater(MMFloat4 v, MMFloat4 u)
+        {
+            MMMask4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (v.f[i] > u.f[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        //Sets each lane of the mask where v >= u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareGreaterEqual(MMFloat4 v, MMFloat4 u)
+        {
+            MMMask4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (v.f[i] >= u.f[i]) ? 0xFFFFFFFFu : 0u;
+            return result;
+        }
+
+        /** Branchless per-lane select
+        * \param mask Lanes taken from v where set, from u where clear
+        * \return The blended vector
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorSelect(MMMask4 mask, MMFloat4 v, MMFloat4 u)
+        {
+            MMFloat4 result;
+            for (int i = 0; i < 4; i++)
+                result.u[i] = (mask.u[i] & v.u[i]) | (~mask.u[i] & u.u[i]);
+            return result;
+        }
+
+        //Packs the sign bit of each mask lane into the low four bits of an int
+        inline int _MM_CALLCONV MMMaskToBits(MMMask4 m)
+        {
+            return static_cast<int>((m.u[0] >> 31) | ((m.u[1] >> 31) << 1) | ((m.u[2] >> 31) << 2) | ((m.u[3] >> 31) << 3));
+        }
+
+        //There is no MXCSR to read, denormal control is a no-op on this backend
+        inline uint32_t _MM_CALLCONV MMGetControlStatus()
+        {
+            return 0;
+        }
+
+        inline void _MM_CALLCONV MMSetControlStatus(uint32_t)
+        {
+        }
+    }
+}
@@ -0,0 +1,359 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+/**
+* SSE backend for the MM intrinsic layer.
+*
+* Every function in here maps onto a single SSE instruction (or a
+* short, fixed sequence of them). Anything that can be expressed in terms
+* of these primitives lives in ht_mathmm.inl and is shared by all backends.
+*/
+
+namespace Hatchit {
+
+    namespace Math {
+
+        inline MMFloat4 _MM_CALLCONV MMVectorZero()
+        {
+            return _mm_setzero_ps();
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSet(float x, float y, float z, float w)
+        {
+            return _mm_set_ps(w, z, y, x);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSetInt(uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+        {
+            __m128i v = _mm_set_epi32(w, z, y, x);
+
+            return _mm_castsi128_ps(v);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSplat(float s)
+        {
+            return _mm_set1_ps(s);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoad(const float* p)
+        {
+            return _mm_load_ps(p);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadUnaligned(const float* p)
+        {
+            return _mm_loadu_ps(p);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadScalar(const float* p)
+        {
+            return _mm_load_ss(p);
+        }
+
+        inline void _MM_CALLCONV MMVectorStore(float* p, MMFloat4 v)
+        {
+            _mm_store_ps(p, v);
+        }
+
+        inline void _MM_CALLCONV MMVectorStoreUnaligned(float* p, MMFloat4 v)
+        {
+            _mm_storeu_ps(p, v);
+        }
+
+        inline void _MM_CALLCONV MMVectorStoreScalar(float* p, MMFloat4 v)
+        {
+            _mm_store_ss(p, v);
+        }
+
+        /** Loads a packed Float3 as (x, y, z, 0) without touching the bytes after it
+        * movsd reads x and y, movss reads z, movlhps joins them. Only the twelve bytes
+        * of the Float3 are read, so a Float3 at the very end of a page is safe.
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadFloat3(const Float3* p)
+        {
+            __m128 xy = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p->m_data)));
+            __m128 z = _mm_load_ss(&p->z);
+            return _mm_movelh_ps(xy, z);
+        }
+
+        //Loads a 16 byte aligned Float3A with one movaps, w is cleared
+        inline MMFloat4 _MM_CALLCONV MMVectorLoadFloat3A(const Float3A* p)
+        {
+            __m128 v = _mm_load_ps(p->m_data);
+            return _mm_and_ps(v, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1)));
+        }
+
+        //Writes x, y and z of v to a packed Float3, the bytes after it are left untouched
+        inline void _MM_CALLCONV MMVectorStoreFloat3(Float3* p, MMFloat4 v)
+        {
+            _mm_store_sd(reinterpret_cast<double*>(p->m_data), _mm_castps_pd(v));
+            _mm_store_ss(&p->z, _mm_movehl_ps(v, v));
+        }
+
+        inline float _MM_CALLCONV MMVectorGetX(MMFloat4 v)
+        {
+            //extract the lowest bit value (x)
+            return _mm_cvtss_f32(v);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorAdd(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_add_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSub(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_sub_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorMul(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_mul_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorDiv(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_div_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorMin(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_min_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorMax(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_max_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorSqrt(MMFloat4 v)
+        {
+            return _mm_sqrt_ps(v);
+        }
+
+#if !defined(__SSE4_1__) && !defined(__AVX__)
+        namespace Internal
+        {
+            /** Rounds every lane to the nearest integer, ties to even, using the 2^23 trick
+            * Adding and subtracting 2^23 pushes the fraction bits out of the mantissa.
+            * Lanes with a magnitude of 2^23 or more (and NaNs) are already integral and
+            * are passed through untouched.
+            */
+            inline MMFloat4 _MM_CALLCONV MMVectorRoundMagic(MMFloat4 v)
+            {
+                const __m128 signMask = _mm_set1_ps(-0.0f);
+                const __m128 magic = _mm_set1_ps(8388608.0f);
+
+                __m128 sign = _mm_and_ps(v, signMask);
+                __m128 absV = _mm_andnot_ps(signMask, v);
+                __m128 rounded = _mm_sub_ps(_mm_add_ps(absV, magic), magic);
+                rounded = _mm_or_ps(rounded, sign);
+
+                __m128 inRange = _mm_cmplt_ps(absV, magic);
+                return _mm_or_ps(_mm_and_ps(inRange, rounded), _mm_andnot_ps(inRange, v));
+            }
+        }
+#endif
+
+        //Rounds every lane toward negative infinity
+        inline MMFloat4 _MM_CALLCONV MMVectorFloor(MMFloat4 v)
+        {
+#if defined(__SSE4_1__) || defined(__AVX__)
+            return _mm_round_ps(v, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+#else
+            __m128 rounded = Internal::MMVectorRoundMagic(v);
+            __m128 tooLarge = _mm_cmpgt_ps(rounded, v);
+            return _mm_sub_ps(rounded, _mm_and_ps(tooLarge, _mm_set1_ps(1.0f)));
+#endif
+        }
+
+        //Rounds every lane toward positive infinity
+        inline MMFloat4 _MM_CALLCONV MMVectorCeil(MMFloat4 v)
+        {
+#if defined(__SSE4_1__) || defined(__AVX__)
+            return _mm_round_ps(v, _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC);
+#else
+            __m128 rounded = Internal::MMVectorRoundMagic(v);
+            __m128 tooSmall = _mm_cmplt_ps(rounded, v);
+            return _mm_add_ps(rounded, _mm_and_ps(tooSmall, _mm_set1_ps(1.0f)));
+#endif
+        }
+
+        //Rounds every lane to the nearest integer, halfway cases go to the even neighbour
+        inline MMFloat4 _MM_CALLCONV MMVectorRound(MMFloat4 v)
+        {
+#if defined(__SSE4_1__) || defined(__AVX__)
+            return _mm_round_ps(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#else
+            return Internal::MMVectorRoundMagic(v);
+#endif
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocalEst(MMFloat4 v)
+        {
+            return _mm_rcp_ps(v);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorReciprocalSqrtEst(MMFloat4 v)
+        {
+            return _mm_rsqrt_ps(v);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorAnd(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_and_ps(v, u);
+        }
+
+        //Computes (~v) & u, matching _mm_andnot_ps
+        inline MMFloat4 _MM_CALLCONV MMVectorAndNot(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_andnot_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorOr(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_or_ps(v, u);
+        }
+
+        inline MMFloat4 _MM_CALLCONV MMVectorXor(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_xor_ps(v, u);
+        }
+
+        /** Builds (v[X], v[Y], u[Z], u[W])
+        * Indices are given in x, y, z, w order, the reverse of _MM_SHUFFLE
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline MMFloat4 _MM_CALLCONV MMVectorShuffle(MMFloat4 v, MMFloat4 u)
+        {
+            static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "Shuffle indices must be in the range [0, 3]");
+            return _mm_shuffle_ps(v, u, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        /** Picks each lane from v (selector 0) or u (selector 1)
+        * Compiles to blendps when SSE4.1 is enabled, otherwise to a constant
+        * mask and three logic ops.
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline MMFloat4 _MM_CALLCONV MMVectorBlend(MMFloat4 v, MMFloat4 u)
+        {
+            static_assert(X < 2 && Y < 2 && Z < 2 && W < 2, "Blend selectors must be 0 or 1");
+#if defined(__SSE4_1__) || defined(__AVX__)
+            return _mm_blend_ps(v, u, X | (Y << 1) | (Z << 2) | (W << 3));
+#else
+            const __m128 mask = _mm_castsi128_ps(_mm_set_epi32(W ? -1 : 0, Z ? -1 : 0, Y ? -1 : 0, X ? -1 : 0));
+            return _mm_or_ps(_mm_andnot_ps(mask, v), _mm_and_ps(mask, u));
+#endif
+        }
+
+        //Returns (u.x, v.y, v.z, v.w)
+        inline MMFloat4 _MM_CALLCONV MMVectorMoveX(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_move_ss(v, u);
+        }
+
+        //Returns (v.x, v.y, u.x, u.y)
+        inline MMFloat4 _MM_CALLCONV MMVectorMoveLH(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_movelh_ps(v, u);
+        }
+
+        //Returns (u.z, u.w, v.z, v.w)
+        inline MMFloat4 _MM_CALLCONV MMVectorMoveHL(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_movehl_ps(v, u);
+        }
+
+        //Returns (v.x, u.x, v.y, u.y)
+        inline MMFloat4 _MM_CALLCONV MMVectorMergeXY(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_unpacklo_ps(v, u);
+        }
+
+        //Returns (v.z, u.z, v.w, u.w)
+        inline MMFloat4 _MM_CALLCONV MMVectorMergeZW(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_unpackhi_ps(v, u);
+        }
+
+        inline MMMask4 _MM_CALLCONV MMVectorCompareEqual(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_cmpeq_ps(v, u);
+        }
+
+        //Sets each lane of the mask where v != u (NaN lanes compare not equal)
+        inline MMMask4 _MM_CALLCONV MMVectorCompareNotEqual(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_cmpneq_ps(v, u);
+        }
+
+        //Sets each lane of the mask where v < u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareLess(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_cmplt_ps(v, u);
+        }
+
+        //Sets each lane of the mask where v <= u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareLessEqual(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_cmple_ps(v, u);
+        }
+
+        //Sets each lane of the mask where v > u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareGreater(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_cmpgt_ps(v, u);
+        }
+
+        //Sets each lane of the mask where v >= u
+        inline MMMask4 _MM_CALLCONV MMVectorCompareGreaterEqual(MMFloat4 v, MMFloat4 u)
+        {
+            return _mm_cmpge_ps(v, u);
+        }
+
+        /** Branchless per-lane select
+        * \param mask Lanes taken from v where set, from u where clear
+        * \return The blended vector
+        */
+        inline MMFloat4 _MM_CALLCONV MMVectorSelect(MMMask4 mask, MMFloat4 v, MMFloat4 u)
+        {
+#if defined(__SSE4_1__) || defined(__AVX__)
+            return _mm_blendv_ps(u, v, mask);
+#else
+            return _mm_or_ps(_mm_and_ps(mask, v), _mm_andnot_ps(mask, u));
+#endif
+        }
+
+        //Packs the sign bit of each mask lane into the low four bits of an int
+        inline int _MM_CALLCONV MMMaskToBits(MMMask4 m)
+        {
+            return _mm_movemask_ps(m);
+        }
+
+        //Reads the calling thread's MXCSR register
+        inline uint32_t _MM_CALLCONV MMGetControlStatus()
+        {
+            return _mm_getcsr();
+        }
+
+        //Writes the calling thread's MXCSR register
+        inline void _MM_CALLCONV MMSetControlStatus(uint32_t csr)
+        {
+            _mm_setcsr(csr);
+        }
+    }
+}
@@ -33,7 +33,7 @@ namespace Hatchit {
         inline Quaternion::Quaternion(float x, float y, float z, float w) : m_quaternion(MMVectorSet(x, y, z, w)) {}
 
         //Create a Quaternion from a rotation based on axis and angle
-        inline Quaternion::Quaternion(const Vector3& axis, float angle) : m_quaternion(MMVectorSetW(static_cast<__m128>(axis * sinf(angle / 2)), cosf(angle / 2))) {}
+        inline Quaternion::Quaternion(const Vector3& axis, float angle) : m_quaternion(MMVectorSetW(static_cast<MMFloat4>(axis * sinf(angle / 2)), cosf(angle / 2))) {}
 
         //Create a Quaternion from rotation on x, y, and z axis
         inline Quaternion::Quaternion(float roll, float pitch, float yaw) : m_quaternion()
@@ -46,22 +46,22 @@ namespace Hatchit {
             float sinPitch = sinf(pitch * 0.5f);
             float sinYaw = sinf(yaw * 0.5f);
 
-            __m128 vecA = MMVectorSet(sinPitch, sinPitch, cosPitch, cosPitch);
-            __m128 vecB = MMVectorSet(sinYaw, cosYaw, sinYaw, cosYaw);
-            __m128 vecC = _mm_set1_ps(cosRoll);
+            MMFloat4 vecA = MMVectorSet(sinPitch, sinPitch, cosPitch, cosPitch);
+            MMFloat4 vecB = MMVectorSet(sinYaw, cosYaw, sinYaw, cosYaw);
+            MMFloat4 vecC = MMVectorSplat(cosRoll);
 
-            __m128 vecD = MMVectorSet(cosPitch, cosPitch, -sinPitch, -sinPitch);
-            __m128 vecE = MMVectorSet(cosYaw, sinYaw, cosYaw, sinYaw);
-            __m128 vecF = _mm_set1_ps(sinRoll);
+            MMFloat4 vecD = MMVectorSet(cosPitch, cosPitch, -sinPitch, -sinPitch);
+            MMFloat4 vecE = MMVectorSet(cosYaw, sinYaw, cosYaw, sinYaw);
+            MMFloat4 vecF = MMVectorSplat(sinRoll);
 
-            vecA = _mm_mul_ps(vecA, _mm_mul_ps(vecB, vecC));
-            vecD = _mm_mul_ps(vecD, _mm_mul_ps(vecE, vecF));
+            vecA = MMVectorMul(vecA, MMVectorMul(vecB, vecC));
+            vecD = MMVectorMul(vecD, MMVectorMul(vecE, vecF));
 
-            m_quaternion = _mm_add_ps(vecA, vecD);
+            m_quaternion = MMVectorAdd(vecA, vecD);
         }
 
-        //Create a Quaternion from existing __m128 data
-        inline Quaternion::Quaternion(__m128 quatData) : m_quaternion(std::move(quatData)) {}
+        //Create a Quaternion from existing MMFloat4 data
+        inline Quaternion::Quaternion(MMFloat4 quatData) : m_quaternion(std::move(quatData)) {}
 
         //Allocate a 16 byte aligned Quaternion
         inline void* Quaternion::operator new(size_t size)
@@ -111,7 +111,7 @@ namespace Hatchit {
         */
         inline Quaternion Quaternion::operator+(const Quaternion& p_rhs) const
         {
-            return Quaternion(_mm_add_ps(m_quaternion, p_rhs.m_quaternion));
+            return Quaternion(MMVectorAdd(m_quaternion, p_rhs.m_quaternion));
         }
 
         /** Subtracts the components of this Quaternion with another given Quaternion
@@ -120,7 +120,7 @@ namespace Hatchit {
         */
         inline Quaternion Quaternion::operator-(const Quaternion& p_rhs) const
         {
-            return Quaternion(_mm_sub_ps(m_quaternion, p_rhs.m_quaternion));
+            return Quaternion(MMVectorSub(m_quaternion, p_rhs.m_quaternion));
         }
 
         /** Multiplies the quaternion with another Quaternion using the Hamilton Product
@@ -129,23 +129,23 @@ namespace Hatchit {
         */
         inline Quaternion Quaternion::operator*(const Quaternion& p_rhs) const
         {
-            static const __m128 maskX = MMVectorSet(1.f, -1.f, 1.f, -1.f);
-            static const __m128 maskY = MMVectorSet(1.f, 1.f, -1.f, -1.f);
-            static const __m128 maskZ = MMVectorSet(-1.f, 1.f, 1.f, -1.f);
-            __m128 splatX = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 splatY = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(1, 1, 1, 1));
-            __m128 splatZ = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(2, 2, 2, 2));
-            __m128 splatW = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(3, 3, 3, 3));
-
-            splatX = _mm_mul_ps(_mm_mul_ps(splatX, maskX), _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(0, 1, 2, 3)));
-            splatY = _mm_mul_ps(_mm_mul_ps(splatY, maskY), _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(1, 0, 3, 2)));
-            splatZ = _mm_mul_ps(_mm_mul_ps(splatZ, maskZ), _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(2, 3, 0, 1)));
-            splatW = _mm_mul_ps(splatW, _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(3, 2, 1, 0)));
-
-            splatX = _mm_add_ps(splatX, splatY);
-            splatZ = _mm_add_ps(splatZ, splatW);
-
-            return Quaternion(_mm_add_ps(splatX, splatZ));
+            static const MMFloat4 maskX = MMVectorSet(1.f, -1.f, 1.f, -1.f);
+            static const MMFloat4 maskY = MMVectorSet(1.f, 1.f, -1.f, -1.f);
+            static const MMFloat4 maskZ = MMVectorSet(-1.f, 1.f, 1.f, -1.f);
+            MMFloat4 splatX = MMVectorSwizzle<0, 0, 0, 0>(m_quaternion);
+            MMFloat4 splatY = MMVectorSwizzle<1, 1, 1, 1>(m_quaternion);
+            MMFloat4 splatZ = MMVectorSwizzle<2, 2, 2, 2>(m_quaternion);
+            MMFloat4 splatW = MMVectorSwizzle<3, 3, 3, 3>(m_quaternion);
+
+            splatX = MMVectorMul(MMVectorMul(splatX, maskX), MMVectorSwizzle<3, 2, 1, 0>(p_rhs.m_quaternion));
+            splatY = MMVectorMul(MMVectorMul(splatY, maskY), MMVectorSwizzle<2, 3, 0, 1>(p_rhs.m_quaternion));
+            splatZ = MMVectorMul(MMVectorMul(splatZ, maskZ), MMVectorSwizzle<1, 0, 3, 2>(p_rhs.m_quaternion));
+            splatW = MMVectorMul(splatW, MMVectorSwizzle<0, 1, 2, 3>(p_rhs.m_quaternion));
+
+            splatX = MMVectorAdd(splatX, splatY);
+            splatZ = MMVectorAdd(splatZ, splatW);
+
+            return Quaternion(MMVectorAdd(splatX, splatZ));
         }
 
         /** Adds the components of the other quaternion into this quaternion
@@ -154,7 +154,7 @@ namespace Hatchit {
         */
         inline Quaternion& Quaternion::operator+=(const Quaternion& p_rhs)
         {
-            m_quaternion = _mm_add_ps(m_quaternion, p_rhs.m_quaternion);
+            m_quaternion = MMVectorAdd(m_quaternion, p_rhs.m_quaternion);
             return *this;
         }
 
@@ -164,7 +164,7 @@ namespace Hatchit {
         */
         inline Quaternion& Quaternion::operator-=(const Quaternion& p_rhs)
         {
-            m_quaternion = _mm_sub_ps(m_quaternion, p_rhs.m_quaternion);
+            m_quaternion = MMVectorSub(m_quaternion, p_rhs.m_quaternion);
             return *this;
         }
 
@@ -175,30 +175,30 @@ namespace Hatchit {
         */
         inline Quaternion& Quaternion::operator*=(const Quaternion& p_rhs)
         {
-            static const __m128 maskX = MMVectorSet(1.f, -1.f, 1.f, -1.f);
-            static const __m128 maskY = MMVectorSet(1.f, 1.f, -1.f, -1.f);
-            static const __m128 maskZ = MMVectorSet(-1.f, 1.f, 1.f, -1.f);
-            __m128 splatX = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(0, 0, 0, 0));
-            __m128 splatY = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(1, 1, 1, 1));
-            __m128 splatZ = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(2, 2, 2, 2));
-            __m128 splatW = _mm_shuffle_ps(m_quaternion, m_quaternion, _MM_SHUFFLE(3, 3, 3, 3));
-
-            splatX = _mm_mul_ps(_mm_mul_ps(splatX, maskX), _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(0, 1, 2, 3)));
-            splatY = _mm_mul_ps(_mm_mul_ps(splatY, maskY), _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(1, 0, 3, 2)));
-            splatZ = _mm_mul_ps(_mm_mul_ps(splatZ, maskZ), _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(2, 3, 0, 1)));
-            splatW = _mm_mul_ps(splatW, _mm_shuffle_ps(p_rhs.m_quaternion, p_rhs.m_quaternion, _MM_SHUFFLE(3, 2, 1, 0)));
-
-            splatX = _mm_add_ps(splatX, splatY);
-            splatZ = _mm_add_ps(splatZ, splatW);
-
-            m_quaternion = _mm_add_ps(splatX, splatZ);
+            static const MMFloat4 maskX = MMVectorSet(1.f, -1.f, 1.f, -1.f);
+            static const MMFloat4 maskY = MMVectorSet(1.f, 1.f, -1.f, -1.f);
+            static const MMFloat4 maskZ = MMVectorSet(-1.f, 1.f, 1.f, -1.f);
+            MMFloat4 splatX = MMVectorSwizzle<0, 0, 0, 0>(m_quaternion);
+            MMFloat4 splatY = MMVectorSwizzle<1, 1, 1, 1>(m_quaternion);
+            MMFloat4 splatZ = MMVectorSwizzle<2, 2, 2, 2>(m_quaternion);
+            MMFloat4 splatW = MMVectorSwizzle<3, 3, 3, 3>(m_quaternion);
+
+            splatX = MMVectorMul(MMVectorMul(splatX, maskX), MMVectorSwizzle<3, 2, 1, 0>(p_rhs.m_quaternion));
+            splatY = MMVectorMul(MMVectorMul(splatY, maskY), MMVectorSwizzle<2, 3, 0, 1>(p_rhs.m_quaternion));
+            splatZ = MMVectorMul(MMVectorMul(splatZ, maskZ), MMVectorSwizzle<1, 0, 3, 2>(p_rhs.m_quaternion));
+            splatW = MMVectorMul(splatW, MMVectorSwizzle<0, 1, 2, 3>(p_rhs.m_quaternion));
+
+            splatX = MMVectorAdd(splatX, splatY);
+            splatZ = MMVectorAdd(splatZ, splatW);
+
+            m_quaternion = MMVectorAdd(splatX, splatZ);
             return *this;
         }
 
-        /** Returns copy of internal __m128 structure
-        * \return Copy of internal __m128 structure.
+        /** Returns copy of internal MMFloat4 structure
+        * \return Copy of internal MMFloat4 structure.
         */
-        inline Quaternion::operator __m128() const
+        inline Quaternion::operator MMFloat4() const
         {
             return m_quaternion;
         }
@@ -209,45 +209,64 @@ namespace Hatchit {
         * \param r The second quaternion
         * \return result of the dot product.
         */
-        inline float _MM_CALLCONV MMQuaternionDot(const Quaternion& q, const Quaternion& r)
+        inline float _MM_CALLCONV MMQuaternionDot(FQuaternion q, FQuaternion r)
+        {
+            return MMVectorGetX(MMQuaternionDotV(q, r));
+        }
+
+        /** Performs dot product of two quaternions without leaving the register file
+        * \return result of the dot product splatted into every lane
+        */
+        inline MMFloat4 _MM_CALLCONV MMQuaternionDotV(FQuaternion q, FQuaternion r)
         {
-            __m128 dotProd = _mm_mul_ps(q.m_quaternion, r.m_quaternion);
-            dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(2, 3, 0, 1)));
-            dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(0, 1, 2, 3)));
-            return MMVectorGetX(dotProd);
+            MMFloat4 dotProd = MMVectorMul(q.m_quaternion, r.m_quaternion);
+            dotProd = MMVectorAdd(dotProd, MMVectorSwizzle<1, 0, 3, 2>(dotProd));
+            return MMVectorAdd(dotProd, MMVectorSwizzle<3, 2, 1, 0>(dotProd));
         }
 
-		inline Quaternion _MM_CALLCONV MMQuaternionNormalize(const Quaternion& q)
+		inline Quaternion _MM_CALLCONV MMQuaternionNormalize(FQuaternion q)
+		{
+			return MMQuaternionNormalize(q, MMPrecisionDefault());
+		}
+
+		//Normalizes q with an explicit precision, within 2^-21 relative error of unit length for MMPrecisionFast
+		template <typename Precision>
+		inline Quaternion _MM_CALLCONV MMQuaternionNormalize(FQuaternion q, Precision)
 		{
 			assert(MMQuaternionMagnitudeSqr(q) > 0.f);
-			__m128 dotProd = _mm_mul_ps(q.m_quaternion, q.m_quaternion);
-			dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(2, 3, 0, 1)));
-			dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(0, 1, 2, 3)));
-			dotProd = _mm_sqrt_ps(dotProd);
-			return Quaternion(_mm_div_ps(q.m_quaternion, dotProd));
+			return Quaternion(Internal::MMVectorDivSqrt(q.m_quaternion, MMQuaternionDotV(q, q), Precision()));
 		}
 
         /** Creates a copy of given quaternion with estimated unit length
         * \param q Quaternion to normalize
         * \return Normalized(estimated) Quaternion
         */
-        inline Quaternion _MM_CALLCONV MMQuaternionNormalizeEst(const Quaternion& q)
+        inline Quaternion _MM_CALLCONV MMQuaternionNormalizeEst(FQuaternion q)
         {
 			assert(MMQuaternionMagnitudeSqr(q) > 0.f);
-            __m128 dotProd = _mm_mul_ps(q.m_quaternion, q.m_quaternion);
-            dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(2, 3, 0, 1)));
-            dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(0, 1, 2, 3)));
-            dotProd = _mm_rsqrt_ps(dotProd);
-            return Quaternion(_mm_mul_ps(q.m_quaternion, dotProd));
+            return Quaternion(MMVectorMul(q.m_quaternion, MMVectorReciprocalSqrtEst(MMQuaternionMagnitudeSqrV(q))));
         }
 
         /** Calculates the magnitude (length) of the given quaternion
         * \param q Quaternion to calculate Magnitude from
         * \return magnitude (length) of quaternion
         */
-        inline float _MM_CALLCONV MMQuaternionMagnitude(const Quaternion& q)
+        inline float _MM_CALLCONV MMQuaternionMagnitude(FQuaternion q)
+        {
+            return MMVectorGetX(MMQuaternionMagnitudeV(q));
+        }
+
+        //Magnitude splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMQuaternionMagnitudeV(FQuaternion q)
+        {
+            return MMQuaternionMagnitudeV(q, MMPrecisionDefault());
+        }
+
+        //Magnitude splatted into every lane, computed with an explicit precision
+        template <typename Precision>
+        inline MMFloat4 _MM_CALLCONV MMQuaternionMagnitudeV(FQuaternion q, Precision)
         {
-            return sqrtf(MMQuaternionMagnitudeSqr(q));
+            return MMVectorSqrt(MMQuaternionDotV(q, q), Precision());
         }
 
         /** Calculates the square magnitude (square length) of the given quaternion
@@ -256,19 +275,25 @@ namespace Hatchit {
         * \param q Quaternion to calculate square magnitude from
         * \return Square of magnitude (length) of quaternion
         */
-        inline float _MM_CALLCONV MMQuaternionMagnitudeSqr(const Quaternion& q)
+        inline float _MM_CALLCONV MMQuaternionMagnitudeSqr(FQuaternion q)
         {
-            return MMQuaternionDot(q, q);
+            return MMVectorGetX(MMQuaternionDotV(q, q));
+        }
+
+        //Squared magnitude splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMQuaternionMagnitudeSqrV(FQuaternion q)
+        {
+            return MMQuaternionDotV(q, q);
         }
 
         /** Calculates the conjugate of the given Quaternion
         * \param q Quaternion to get conjugate from
         * \return Conjugate of Quaternion.
         */
-        inline Quaternion _MM_CALLCONV MMQuaternionConjugate(const Quaternion& q)
+        inline Quaternion _MM_CALLCONV MMQuaternionConjugate(FQuaternion q)
         {
-            static const __m128 signMask = MMVectorSet(-1.f, -1.f, -1.f, 1.f);
-            return Quaternion(_mm_mul_ps(q.m_quaternion, signMask));
+            static const MMFloat4 signMask = MMVectorSet(-1.f, -1.f, -1.f, 1.f);
+            return Quaternion(MMVectorMul(q.m_quaternion, signMask));
         }
 
         /** Stores values of Quaternion into Float4 type
@@ -278,5 +303,202 @@ namespace Hatchit {
         {
             return Float4(m_data);
         }
+
+        /** Compares two Quaternions component-wise within a tolerance
+        * \param epsilon Largest absolute difference still treated as equal
+        * \return Mask of the components that are near equal
+        */
+        inline MMMask4 _MM_CALLCONV MMQuaternionNearEqual(FQuaternion v, FQuaternion u, float epsilon)
+        {
+            return MMVectorNearEqual(v.m_quaternion, u.m_quaternion, MMVectorSplat(epsilon));
+        }
+
+        //Sets each mask lane whose component is NaN
+        inline MMMask4 _MM_CALLCONV MMQuaternionIsNaN(FQuaternion v)
+        {
+            return MMVectorIsNaN(v.m_quaternion);
+        }
+
+        //Sets each mask lane whose component is infinite
+        inline MMMask4 _MM_CALLCONV MMQuaternionIsInf(FQuaternion v)
+        {
+            return MMVectorIsInf(v.m_quaternion);
+        }
+
+        //Returns true if the mask is set for all four components
+        inline bool _MM_CALLCONV MMQuaternionAllTrue(MMMask4 mask)
+        {
+            return MMMaskAllTrue(mask, 15);
+        }
+
+        //Returns true if the mask is set for any of the four components
+        inline bool _MM_CALLCONV MMQuaternionAnyTrue(MMMask4 mask)
+        {
+            return MMMaskAnyTrue(mask, 15);
+        }
+
+        /** Branchless component-wise select between two Quaternions
+        * \param mask Components taken from v where set, from u where clear
+        * \return The selected Quaternion
+        */
+        inline Quaternion _MM_CALLCONV MMQuaternionSelect(MMMask4 mask, FQuaternion v, FQuaternion u)
+        {
+            return Quaternion(MMVectorSelect(mask, v.m_quaternion, u.m_quaternion));
+        }
+
+        namespace Internal
+        {
+            /** Rotation of the upper 3x3 of rows as an (x, y, z, w) quaternion
+            * All four of Shepperd's candidates are built side by side and the one
+            * dividing by the largest of 4w^2, 4x^2, 4y^2 and 4z^2 is picked with masks,
+            * so mixed input costs the same as uniform input. Only xyz lanes are read.
+            */
+            inline MMFloat4 _MM_CALLCONV MMQuaternionFromRows(const MMFloat4* rows)
+            {
+                static const MMFloat4 signX = MMVectorSetInt(0, 0x80000000, 0x80000000, 0);
+                static const MMFloat4 signY = MMVectorSetInt(0x80000000, 0, 0x80000000, 0);
+                static const MMFloat4 signZ = MMVectorSetInt(0x80000000, 0x80000000, 0, 0);
+                static const MMFloat4 maskX = MMVectorSetInt(0xFFFFFFFF, 0, 0, 0);
+                static const MMFloat4 maskY = MMVectorSetInt(0, 0xFFFFFFFF, 0, 0);
+                static const MMFloat4 maskZ = MMVectorSetInt(0, 0, 0xFFFFFFFF, 0);
+                static const MMFloat4 maskW = MMVectorSetInt(0, 0, 0, 0xFFFFFFFF);
+
+                //(4x^2, 4y^2, 4z^2, 4w^2) from the signed diagonal
+                MMFloat4 q2 = MMVectorAdd(MMVectorSplat(1.0f), MMVectorXor(MMVectorSplatX(rows[0]), signX));
+                q2 = MMVectorAdd(q2, MMVectorXor(MMVectorSplatY(rows[1]), signY));
+                q2 = MMVectorAdd(q2, MMVectorXor(MMVectorSplatZ(rows[2]), signZ));
+
+                //u = (zy, xz, yx), v = (yz, zx, xy)
+                MMFloat4 u = MMVectorShuffle<0, 2, 0, 0>(MMVectorShuffle<1, 1, 2, 2>(rows[2], rows[0]), rows[1]);
+                MMFloat4 v = MMVectorShuffle<0, 2, 1, 1>(MMVectorShuffle<2, 2, 0, 0>(rows[1], rows[2]), rows[0]);
+
+                //sum = (4yz, 4xz, 4xy, -), diff = (4wx, 4wy, 4wz, -)
+                MMFloat4 sum = MMVectorAdd(u, v);
+                MMFloat4 diff = MMVectorSub(u, v);
+
+                MMFloat4 e = MMVectorShuffle<2, 1, 0, 0>(sum, diff);
+                MMFloat4 candX = MMVectorSelect(maskX, q2, MMVectorShuffle<0, 0, 1, 2>(e, e));
+                MMFloat4 f = MMVectorShuffle<2, 0, 1, 1>(sum, diff);
+                MMFloat4 candY = MMVectorSelect(maskY, q2, MMVectorShuffle<0, 0, 1, 2>(f, f));
+                MMFloat4 candZ = MMVectorSelect(maskZ, q2, MMVectorShuffle<1, 0, 2, 2>(sum, diff));
+                MMFloat4 candW = MMVectorSelect(maskW, q2, diff);
+
+                MMFloat4 largest = MMVectorMax(q2, MMVectorSwizzle<1, 0, 3, 2>(q2));
+                largest = MMVectorMax(largest, MMVectorSwizzle<2, 3, 0, 1>(largest));
+                MMMask4 isLargest = MMVectorCompareEqual(q2, largest);
+
+                MMFloat4 result = candZ;
+                result = MMVectorSelect(MMVectorSplatY(isLargest), candY, result);
+                result = MMVectorSelect(MMVectorSplatX(isLargest), candX, result);
+                result = MMVectorSelect(MMVectorSplatW(isLargest), candW, result);
+
+                //each candidate is the quaternion scaled by 4 * its pivot component
+                Quaternion q(result);
+                return MMVectorDivSqrt(result, MMQuaternionDotV(q, q), MMPrecisionDefault());
+            }
+        }
+
+        //Rotation of the upper 3x3 of m, which must be free of scale and shear
+        inline Quaternion _MM_CALLCONV MMQuaternionFromMatrix(FMatrix4 m)
+        {
+            return Quaternion(Internal::MMQuaternionFromRows(m.m_rows));
+        }
+
+        //Rotation of the 3x3 part of a, which must be free of scale and shear
+        inline Quaternion _MM_CALLCONV MMQuaternionFromAffine(FAffineTransform a)
+        {
+            return Quaternion(Internal::MMQuaternionFromRows(a.m_rows));
+        }
+
+        //Rotation of an orthonormal 3x3 matrix
+        inline Quaternion _MM_CALLCONV MMQuaternionFromMatrix3(FMatrix3 m)
+        {
+            return Quaternion(Internal::MMQuaternionFromRows(m.m_rows));
+        }
+
+        /** Writes MMQuaternionFromMatrix(in[i]) to out[i] for count elements
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMQuaternionFromMatrixStream(Quaternion* out, const Matrix4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMQuaternionFromMatrixStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_quaternion = Internal::MMQuaternionFromRows(in[i].m_rows);
+        }
+
+        /** Writes MMQuaternionFromAffine(in[i]) to out[i] for count elements
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMQuaternionFromAffineStream(Quaternion* out, const AffineTransform* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMQuaternionFromAffineStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_quaternion = Internal::MMQuaternionFromRows(in[i].m_rows);
+        }
+
+        /** Writes MMQuaternionFromMatrix3(in[i]) to out[i] for count elements
+        * out may alias in
+        */
+        inline void _MM_CALLCONV MMQuaternionFromMatrix3Stream(Quaternion* out, const Matrix3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMQuaternionFromMatrix3Stream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_quaternion = Internal::MMQuaternionFromRows(in[i].m_rows);
+        }
+
+        /** Renormalizes the quaternions whose length drifted, in place
+        * wideLaneCount squared norms are checked at once and only elements with
+        * |dot(q, q) - 1| > tolerance are written, so blocks that are still unit
+        * length leave their cache lines clean.
+        * \param q Quaternions to repair, none may be zero
+        * \param tolerance Allowed error of the squared norm
+        * \return The number of quaternions rewritten
+        */
+        inline size_t _MM_CALLCONV MMQuaternionRenormalizeStream(Quaternion* q, size_t count, float tolerance)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMQuaternionRenormalizeStream");
+
+            const MMFloatW one = MMWideSplat(1.0f);
+            const MMFloatW wideTolerance = MMWideSplat(tolerance);
+            const MMFloatW signBit = MMWideSplat(-0.0f);
+            Quaternion normalized[wideLaneCount];
+            size_t rewritten = 0;
+
+            size_t i = 0;
+            for (; i + wideLaneCount <= count; i += wideLaneCount)
+            {
+                QuaternionWide block = MMQuaternionWideLoadAoS(q + i);
+                MMFloatW lengthSq = MMQuaternionWideDot(block, block);
+                MMFloatW error = MMWideAndNot(signBit, MMWideSub(lengthSq, one));
+                int bits = MMWideMaskToBits(MMWideCompareGreater(error, wideTolerance));
+                if (!bits)
+                    continue;
+
+                MMFloatW invLength = MMWideReciprocalSqrt(lengthSq, MMPrecisionExact());
+                MMQuaternionWideStoreAoS(normalized, QuaternionWide(MMWideMul(block.x, invLength), MMWideMul(block.y, invLength),
+                                                                    MMWideMul(block.z, invLength), MMWideMul(block.w, invLength)));
+                for (size_t lane = 0; lane < wideLaneCount; lane++)
+                {
+                    if (bits & (1 << lane))
+                    {
+                        q[i + lane] = normalized[lane];
+                        rewritten++;
+                    }
+                }
+            }
+
+            for (; i < count; i++)
+            {
+                if (std::fabs(MMQuaternionDot(q[i], q[i]) - 1.0f) > tolerance)
+                {
+                    q[i] = MMQuaternionNormalize(q[i], MMPrecisionExact());
+                    rewritten++;
+                }
+            }
+            return rewritten;
+        }
     }
 }
\ No newline at end of file
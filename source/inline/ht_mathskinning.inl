@@ -0,0 +1,138 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+namespace Hatchit {
+
+    namespace Math {
+
+        namespace Internal
+        {
+            //Weighted sum of the four bone rows, weights holds one weight per lane
+            inline void _MM_CALLCONV MMSkinBlendRows(const AffineTransform* palette, const uint32_t* indices, MMFloat4 weights, MMFloat4* rows)
+            {
+                const MMFloat4* b0 = palette[indices[0]].m_rows;
+                const MMFloat4* b1 = palette[indices[1]].m_rows;
+                const MMFloat4* b2 = palette[indices[2]].m_rows;
+                const MMFloat4* b3 = palette[indices[3]].m_rows;
+                MMFloat4 w0 = MMVectorSplatX(weights);
+                MMFloat4 w1 = MMVectorSplatY(weights);
+                MMFloat4 w2 = MMVectorSplatZ(weights);
+                MMFloat4 w3 = MMVectorSplatW(weights);
+
+                for (int r = 0; r < 3; r++)
+                {
+                    MMFloat4 row = MMVectorMul(b0[r], w0);
+                    row = MMVectorAdd(row, MMVectorMul(b1[r], w1));
+                    row = MMVectorAdd(row, MMVectorMul(b2[r], w2));
+                    rows[r] = MMVectorAdd(row, MMVectorMul(b3[r], w3));
+                }
+            }
+
+            //Skins [begin, end), the renormalize choice is made once per call instead of per vertex
+            template <bool Renormalize>
+            inline void _MM_CALLCONV MMSkinRange(Vector3* outPositions, Vector3* outNormals, const AffineTransform* palette,
+                                                 const Vector3* positions, const Vector3* normals,
+                                                 const uint32_t* indices, const float* weights, size_t begin, size_t end)
+            {
+                const MMFloat4 zero = MMVectorZero();
+                MMFloat4 rows[3];
+                MMFloat4 columns[4];
+
+                for (size_t i = begin; i < end; i++)
+                {
+                    MMSkinBlendRows(palette, indices + i * 4, MMVectorLoadUnaligned(weights + i * 4), rows);
+                    MMAffineColumns(rows, columns);
+
+                    //read the normal before the position is written in case the caller aliased them
+                    MMFloat4 normal = normals ? normals[i].m_vector : zero;
+                    outPositions[i].m_vector = MMAffineTransformColumns(columns, positions[i].m_vector, columns[3]);
+                    if (!normals)
+                        continue;
+
+                    normal = MMAffineTransformColumns(columns, normal, zero);
+                    if (Renormalize)
+                        normal = MMVectorDivSqrt(normal, MMVectorDot3V(normal, normal), MMPrecisionDefault());
+                    outNormals[i].m_vector = normal;
+                }
+            }
+
+            inline void _MM_CALLCONV MMSkinRange(Vector3* outPositions, Vector3* outNormals, const AffineTransform* palette,
+                                                 const Vector3* positions, const Vector3* normals,
+                                                 const uint32_t* indices, const float* weights, size_t begin, size_t end, bool renormalize)
+            {
+                if (renormalize)
+                    MMSkinRange<true>(outPositions, outNormals, palette, positions, normals, indices, weights, begin, end);
+                else
+                    MMSkinRange<false>(outPositions, outNormals, palette, positions, normals, indices, weights, begin, end);
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM Skinning Operations
+        /////////////////////////////////////////////////////////
+
+        /** Linear blend skinning of count vertices with four influences each
+        * The four bone transforms of a vertex are blended into one transform, which then
+        * moves the position and the normal. Normals go through the blended rotation and
+        * scale only, which is exact for rigid and uniformly scaled bones.
+        * \param outPositions Receives the skinned positions, w is zero
+        * \param outNormals Receives the skinned normals, ignored when normals is nullptr
+        * \param palette Bone transforms, see MMAffineFromMatrix4Stream for Matrix4 palettes
+        * \param positions Bind pose positions
+        * \param normals Bind pose normals or nullptr to skin positions only
+        * \param indices Four palette indices per vertex, vertex i uses indices[4 * i] to indices[4 * i + 3]
+        * \param weights Four weights per vertex laid out like indices, unused slots need a zero weight
+        * \param renormalize Rescales the skinned normals to unit length
+        * NOTE: outputs may alias their inputs
+        */
+        inline void _MM_CALLCONV MMSkinStream(Vector3* outPositions, Vector3* outNormals, const AffineTransform* palette,
+                                              const Vector3* positions, const Vector3* normals,
+                                              const uint32_t* indices, const float* weights, size_t count, bool renormalize)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMSkinStream");
+
+            Internal::MMSkinRange(outPositions, outNormals, palette, positions, normals, indices, weights, 0, count, renormalize);
+        }
+
+        /** Splits MMSkinStream over the pool in contiguous chunks
+        * Every vertex is written by exactly one task, results match the single threaded call.
+        * \param grainSize Minimum number of vertices per task
+        */
+        inline void _MM_CALLCONV MMSkinStream(MMWorkerPool& pool, Vector3* outPositions, Vector3* outNormals, const AffineTransform* palette,
+                                              const Vector3* positions, const Vector3* normals,
+                                              const uint32_t* indices, const float* weights, size_t count, bool renormalize,
+                                              size_t grainSize)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMSkinStream");
+
+            const size_t maxTasks = pool.ThreadCount() * 4;
+            grainSize = std::max<size_t>(grainSize, 1);
+            size_t tasks = std::min((count + grainSize - 1) / grainSize, maxTasks);
+            if (tasks <= 1)
+            {
+                Internal::MMSkinRange(outPositions, outNormals, palette, positions, normals, indices, weights, 0, count, renormalize);
+                return;
+            }
+
+            pool.ParallelFor(tasks, [=](size_t task) {
+                size_t first = count * task / tasks;
+                size_t last = count * (task + 1) / tasks;
+                Internal::MMSkinRange(outPositions, outNormals, palette, positions, normals, indices, weights, first, last, renormalize);
+            });
+        }
+    }
+}
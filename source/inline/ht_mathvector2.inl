@@ -28,25 +28,22 @@ namespace Hatchit {
         //////////////////////////////////////////////////////////////////////
 
         //Create a Vector2 with both elements being 0
-        inline Vector2::Vector2() : m_vector(_mm_setzero_ps()) {}
+        inline Vector2::Vector2() : m_vector(MMVectorZero()) {}
 
         //Create a Vector2 with rawArray for data
         inline Vector2::Vector2(const float rawArray[]) : m_vector(MMVectorSet(rawArray[0], rawArray[1], 0.0f, 0.0f)) {}
 
 		//Create a Vector2 with both elements being x
-		inline Vector2::Vector2(float x) : m_vector(_mm_set_ps1(x)) {}
+		inline Vector2::Vector2(float x) : m_vector(MMVectorSplat(x)) {}
 
         //Create a Vector2 with the elements described by x and y
         inline Vector2::Vector2(float x, float y) : m_vector(MMVectorSet(x, y, 0.0f, 0.0f)) {}
 
-        //Create a Vector2 with the elements of another Vector2
-        inline Vector2::Vector2(const Vector2& other) : m_vector(other.m_vector) {}
+        //Create a Vector2 object using the data from an MMFloat4 vector
+        inline Vector2::Vector2(const MMFloat4& vector) : m_vector(vector) {}
 
-        //Create a Vector2 object using the data from an __m128 vector
-        inline Vector2::Vector2(const __m128& vector) : m_vector(vector) {}
-
-        //Create a Vector2 object using the data from an __m128 vector
-        inline Vector2::Vector2(__m128&& vector) : m_vector(vector) {}
+        //Create a Vector2 object using the data from an MMFloat4 vector
+        inline Vector2::Vector2(MMFloat4&& vector) : m_vector(vector) {}
 
         //Allocate a 16 byte aligned data chunk for a Vector2
         inline void* Vector2::operator new(size_t size)
@@ -72,10 +69,10 @@ namespace Hatchit {
             return aligned_free(p);
         }
 
-        /** Casts a Vector2 object to a __m128
-        * This operator casts a Vector2 to an intrinsic __m128
+        /** Casts a Vector2 object to a MMFloat4
+        * This operator casts a Vector2 to an intrinsic MMFloat4
         */
-        inline Vector2::operator __m128() const
+        inline Vector2::operator MMFloat4() const
         {
             return m_vector;
         }
@@ -87,7 +84,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator+(float s) const
         {
-            return Vector2(_mm_add_ps(m_vector, MMVectorSet(s, s, 0.0f, 0.0f)));
+            return Vector2(MMVectorAdd(m_vector, MMVectorSet(s, s, 0.0f, 0.0f)));
         }
         /** Subtracts all elements in Vector2 by a given scalar
         * This operator returns a new Vector2
@@ -96,7 +93,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator-(float s) const
         {
-            return Vector2(_mm_sub_ps(m_vector, MMVectorSet(s, s, 0.0f, 0.0f)));
+            return Vector2(MMVectorSub(m_vector, MMVectorSet(s, s, 0.0f, 0.0f)));
         }
         /** Multiplies all elements in Vector2 by a given scalar
         * This operator returns a new Vector2
@@ -105,7 +102,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator*(float s) const
         {
-            return Vector2(_mm_mul_ps(m_vector, _mm_set_ps1(s)));
+            return Vector2(MMVectorMul(m_vector, MMVectorSplat(s)));
         }
         /** Divides all elements in Vector2 by a given scalar
         * This operator returns a new Vector2
@@ -114,7 +111,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator/(float s) const
         {
-            return Vector2(_mm_div_ps(m_vector, _mm_set_ps1(s)));
+            return Vector2(MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault()));
         }
 
         /** Adds all elements in this Vector2 by a given scalar
@@ -124,7 +121,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator+=(float s)
         {
-            m_vector = _mm_add_ps(m_vector, MMVectorSet(s, s, 0.0f, 0.0f));
+            m_vector = MMVectorAdd(m_vector, MMVectorSet(s, s, 0.0f, 0.0f));
             return *this;
         }
         /** Subtracts all elements in this Vector2 by a given scalar
@@ -134,7 +131,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator-=(float s)
         {
-            m_vector = _mm_sub_ps(m_vector, MMVectorSet(s, s, 0.0f, 0.0f));
+            m_vector = MMVectorSub(m_vector, MMVectorSet(s, s, 0.0f, 0.0f));
             return *this;
         }
         /** Multiplies all elements in this Vector2 by a given scalar
@@ -144,7 +141,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator*=(float s)
         {
-            m_vector = _mm_mul_ps(m_vector, _mm_set1_ps(s));
+            m_vector = MMVectorMul(m_vector, MMVectorSplat(s));
             return *this;
         }
         /** Divides all elements in this Vector2 by a given scalar
@@ -154,7 +151,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator/=(float s)
         {
-            m_vector = _mm_div_ps(m_vector, _mm_set1_ps(s));
+            m_vector = MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault());
             return *this;
         }
         /** Adds all of the elements from a given Vector2 to this one
@@ -163,7 +160,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator+(const Vector2& u) const
         {
-            return Vector2(_mm_add_ps(m_vector, u.m_vector));
+            return Vector2(MMVectorAdd(m_vector, u.m_vector));
         }
         /** Subtracts all of the elements from a given Vector2 to this one
         * \param u The other Vector2
@@ -171,7 +168,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator-(const Vector2& u) const
         {
-            return Vector2(_mm_sub_ps(m_vector, u.m_vector));
+            return Vector2(MMVectorSub(m_vector, u.m_vector));
         }
         /** Multiplies all of the elements from a given Vector2 to this one
         * \param u The other Vector2
@@ -179,7 +176,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator*(const Vector2& u) const
         {
-            return Vector2(_mm_mul_ps(m_vector, u.m_vector));
+            return Vector2(MMVectorMul(m_vector, u.m_vector));
         }
         /** Divides all of the elements from a given Vector2 to this one
         * \param u The other Vector2
@@ -187,7 +184,7 @@ namespace Hatchit {
         */
         inline Vector2 Vector2::operator/(const Vector2& u) const
         {
-            return Vector2(_mm_div_ps(m_vector, u.m_vector));
+            return Vector2(MMVectorDiv(m_vector, u.m_vector, MMPrecisionDefault()));
         }
 
         /** Adds all of the elements from a given Vector2 to this one
@@ -196,7 +193,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator+=(const Vector2& u)
         {
-            m_vector = _mm_add_ps(m_vector, u.m_vector);
+            m_vector = MMVectorAdd(m_vector, u.m_vector);
             return *this;
         }
         /** Subtracts all of the elements from a given Vector2 to this one
@@ -205,7 +202,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator-=(const Vector2& u)
         {
-            m_vector = _mm_sub_ps(m_vector, u.m_vector);
+            m_vector = MMVectorSub(m_vector, u.m_vector);
             return *this;
         }
         /** Multiplies all of the elements from a given Vector2 to this one
@@ -214,7 +211,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator*=(const Vector2& u)
         {
-            m_vector = _mm_mul_ps(m_vector, u.m_vector);
+            m_vector = MMVectorMul(m_vector, u.m_vector);
             return *this;
         }
         /** Divides all of the elements from a given Vector2 to this one
@@ -223,7 +220,7 @@ namespace Hatchit {
         */
         inline Vector2& Vector2::operator/=(const Vector2& u)
         {
-            m_vector = _mm_div_ps(m_vector, u.m_vector);
+            m_vector = MMVectorDiv(m_vector, u.m_vector, MMPrecisionDefault());
             return *this;
         }
 
@@ -233,7 +230,7 @@ namespace Hatchit {
 		*/
 		inline bool Vector2::operator==(const Vector2& u) const
 		{
-			return _mm_movemask_ps(_mm_cmpeq_ps(m_vector, u.m_vector)) == 15;
+			return MMVectorEqual(m_vector, u.m_vector);
 		}
 		/** Compares the values of this Vector2 to another given Vector2
 		* \param u The other Vector2
@@ -341,10 +338,18 @@ namespace Hatchit {
         * \param u The second Vector2
         * \return The Dot product of v and u as a float
         */
-        inline float _MM_CALLCONV MMVector2Dot(const Vector2& v, const Vector2& u)
+        inline float _MM_CALLCONV MMVector2Dot(FVector2 v, FVector2 u)
+        {
+            return MMVectorGetX(MMVector2DotV(v, u));
+        }
+
+        /** Calculates the dot product of two Vector2s without leaving the register file
+        * \return The dot product splatted into every lane
+        */
+        inline MMFloat4 _MM_CALLCONV MMVector2DotV(FVector2 v, FVector2 u)
         {
-            __m128 vecMul = _mm_mul_ps(static_cast<__m128>(v), static_cast<__m128>(u));
-            return MMVectorGetX(_mm_add_ps(vecMul, _mm_shuffle_ps(vecMul, vecMul, _MM_SHUFFLE(3, 2, 0, 1))));
+            MMFloat4 vecMul = MMVectorMul(v.m_vector, u.m_vector);
+            return MMVectorSplatX(MMVectorAdd(vecMul, MMVectorSwizzle<1, 0, 2, 3>(vecMul)));
         }
 
         /** Calculates the angle between two vectors
@@ -354,13 +359,10 @@ namespace Hatchit {
         *
         * \return The angle between v and u as a float
         */
-        inline float _MM_CALLCONV MMVector2Angle(const Vector2& v, const Vector2& u)
+        inline float _MM_CALLCONV MMVector2Angle(FVector2 v, FVector2 u)
         {
-            float dot = MMVector2Dot(v, u);
-            float vMag = MMVector2Magnitude(v);
-            float uMag = MMVector2Magnitude(u);
-
-            return acosf(dot / (vMag * uMag));
+            MMFloat4 magProduct = MMVectorMul(MMVector2MagnitudeV(v), MMVector2MagnitudeV(u));
+            return acosf(MMVectorGetX(MMVectorDiv(MMVector2DotV(v, u), magProduct)));
         }
 
         /** Calculates the distance between two vectors
@@ -370,9 +372,15 @@ namespace Hatchit {
         *
         * \return The distance between v and u as a float
         */
-        inline float _MM_CALLCONV MMVector2Distance(const Vector2& v, const Vector2& u)
+        inline float _MM_CALLCONV MMVector2Distance(FVector2 v, FVector2 u)
         {
-            return MMVector2Magnitude(v - u);
+            return MMVectorGetX(MMVector2DistanceV(v, u));
+        }
+
+        //Distance between v and u splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMVector2DistanceV(FVector2 v, FVector2 u)
+        {
+            return MMVector2MagnitudeV(v - u);
         }
 
 
@@ -382,31 +390,56 @@ namespace Hatchit {
 		* This function is faster than MMVector2Magnitude, use for
 		* magnitude comparison
 		*/
-		inline float _MM_CALLCONV MMVector2MagnitudeSqr(const Vector2& v)
+		inline float _MM_CALLCONV MMVector2MagnitudeSqr(FVector2 v)
 		{
-			return MMVector2Dot(v, v);
+			return MMVectorGetX(MMVector2DotV(v, v));
+		}
+
+		//Squared magnitude splatted into every lane
+		inline MMFloat4 _MM_CALLCONV MMVector2MagnitudeSqrV(FVector2 v)
+		{
+			return MMVector2DotV(v, v);
 		}
 
 		/** Calculates the magnitude of the Vector2
 		* \return The magnitude as a float
 		*/
-		inline float _MM_CALLCONV MMVector2Magnitude(const Vector2& v)
+		inline float _MM_CALLCONV MMVector2Magnitude(FVector2 v)
+		{
+			return MMVectorGetX(MMVector2MagnitudeV(v));
+		}
+
+		//Magnitude splatted into every lane
+		inline MMFloat4 _MM_CALLCONV MMVector2MagnitudeV(FVector2 v)
 		{
-			return sqrtf(MMVector2MagnitudeSqr(v));
+			return MMVector2MagnitudeV(v, MMPrecisionDefault());
+		}
+
+		//Magnitude splatted into every lane, computed with an explicit precision
+		template <typename Precision>
+		inline MMFloat4 _MM_CALLCONV MMVector2MagnitudeV(FVector2 v, Precision)
+		{
+			return MMVectorSqrt(MMVector2DotV(v, v), Precision());
 		}
 
         /** Normalizes a Vector2
         * \param v The Vector2 to normalize
         * \return A normalized version of v
-        * NOTE:
-        * This function is only partially intrinsic
         */
-        inline Vector2 _MM_CALLCONV MMVector2Normalized(const Vector2& v)
+        inline Vector2 _MM_CALLCONV MMVector2Normalized(FVector2 v)
+        {
+            return MMVector2Normalized(v, MMPrecisionDefault());
+        }
+
+        /** Normalizes a Vector2 with an explicit precision
+        * \param v The Vector2 to normalize
+        * \return A normalized version of v, within 2^-21 relative error of unit length for MMPrecisionFast
+        */
+        template <typename Precision>
+        inline Vector2 _MM_CALLCONV MMVector2Normalized(FVector2 v, Precision)
         {
             assert(MMVector2MagnitudeSqr(v) > 0);
-            __m128 vecMul = _mm_mul_ps(static_cast<__m128>(v), static_cast<__m128>(v));
-            __m128 vecSum = _mm_add_ps(vecMul, _mm_shuffle_ps(vecMul, vecMul, _MM_SHUFFLE(3, 2, 0, 1)));
-            return Vector2(_mm_div_ps(static_cast<__m128>(v), _mm_sqrt_ps(vecSum)));
+            return Vector2(Internal::MMVectorDivSqrt(v.m_vector, MMVector2DotV(v, v), Precision()));
         }
 
 		/** An insertion operator for a Vector2 to interface with an ostream
@@ -426,5 +459,212 @@ namespace Hatchit {
         {
             return Float2(m_data);
         }
+
+        //Returns (y, x)
+        inline Vector2 Vector2::yx() const
+        {
+            return Swizzle<1, 0>(*this);
+        }
+
+        /** Rearranges the components of a Vector2 at compile time
+        * \param v The Vector2 to rearrange
+        * \return (v[X], v[Y]) built with a single shuffle
+        */
+        template <uint32_t X, uint32_t Y>
+        inline Vector2 _MM_CALLCONV Swizzle(FVector2 v)
+        {
+            static_assert(X < 2 && Y < 2, "Vector2 swizzle indices must be in the range [0, 1]");
+            return Vector2(MMVectorSwizzle<X, Y, 2, 3>(v.m_vector));
+        }
+
+        /** Builds a Vector2 from components of v (indices 0-1) and u (indices 4-5)
+        * \return The permuted Vector2, resolved to a shuffle, move or blend at compile time
+        */
+        template <uint32_t X, uint32_t Y>
+        inline Vector2 _MM_CALLCONV Permute(FVector2 v, FVector2 u)
+        {
+            static_assert((X & 3) < 2 && (Y & 3) < 2 && X < 8 && Y < 8, "Vector2 permute indices must be 0-1 or 4-5");
+            return Vector2(MMVectorPermute<X, Y, 2, 3>(v.m_vector, u.m_vector));
+        }
+
+        //Sets each mask lane where the component of v is less than the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector2Less(FVector2 v, FVector2 u)
+        {
+            return MMVectorCompareLess(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is less than or equal to the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector2LessEqual(FVector2 v, FVector2 u)
+        {
+            return MMVectorCompareLessEqual(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is greater than the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector2Greater(FVector2 v, FVector2 u)
+        {
+            return MMVectorCompareGreater(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is greater than or equal to the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector2GreaterEqual(FVector2 v, FVector2 u)
+        {
+            return MMVectorCompareGreaterEqual(v.m_vector, u.m_vector);
+        }
+
+        /** Compares two Vector2s component-wise within a tolerance
+        * \param epsilon Largest absolute difference still treated as equal
+        * \return Mask of the components that are near equal
+        */
+        inline MMMask4 _MM_CALLCONV MMVector2NearEqual(FVector2 v, FVector2 u, float epsilon)
+        {
+            return MMVectorNearEqual(v.m_vector, u.m_vector, MMVectorSplat(epsilon));
+        }
+
+        //Sets each mask lane whose component is NaN
+        inline MMMask4 _MM_CALLCONV MMVector2IsNaN(FVector2 v)
+        {
+            return MMVectorIsNaN(v.m_vector);
+        }
+
+        //Sets each mask lane whose component is infinite
+        inline MMMask4 _MM_CALLCONV MMVector2IsInf(FVector2 v)
+        {
+            return MMVectorIsInf(v.m_vector);
+        }
+
+        //Returns true if the mask is set for all x and y components
+        inline bool _MM_CALLCONV MMVector2AllTrue(MMMask4 mask)
+        {
+            return MMMaskAllTrue(mask, 3);
+        }
+
+        //Returns true if the mask is set for any of the x and y components
+        inline bool _MM_CALLCONV MMVector2AnyTrue(MMMask4 mask)
+        {
+            return MMMaskAnyTrue(mask, 3);
+        }
+
+        /** Branchless component-wise select between two Vector2s
+        * \param mask Components taken from v where set, from u where clear
+        * \return The selected Vector2
+        */
+        inline Vector2 _MM_CALLCONV MMVector2Select(MMMask4 mask, FVector2 v, FVector2 u)
+        {
+            return Vector2(MMVectorSelect(mask, v.m_vector, u.m_vector));
+        }
+
+        //Returns the component-wise smaller of two Vector2s
+        inline Vector2 _MM_CALLCONV MMVector2Min(FVector2 v, FVector2 u)
+        {
+            return Vector2(MMVectorMin(v.m_vector, u.m_vector));
+        }
+
+        //Returns the component-wise larger of two Vector2s
+        inline Vector2 _MM_CALLCONV MMVector2Max(FVector2 v, FVector2 u)
+        {
+            return Vector2(MMVectorMax(v.m_vector, u.m_vector));
+        }
+
+        //Returns the absolute value of each component
+        inline Vector2 _MM_CALLCONV MMVector2Abs(FVector2 v)
+        {
+            return Vector2(MMVectorAbs(v.m_vector));
+        }
+
+        //Returns the each component rounded toward negative infinity
+        inline Vector2 _MM_CALLCONV MMVector2Floor(FVector2 v)
+        {
+            return Vector2(MMVectorFloor(v.m_vector));
+        }
+
+        //Returns the each component rounded toward positive infinity
+        inline Vector2 _MM_CALLCONV MMVector2Ceil(FVector2 v)
+        {
+            return Vector2(MMVectorCeil(v.m_vector));
+        }
+
+        //Returns the each component rounded to the nearest integer, ties to even
+        inline Vector2 _MM_CALLCONV MMVector2Round(FVector2 v)
+        {
+            return Vector2(MMVectorRound(v.m_vector));
+        }
+
+        /** Clamps each component of a Vector2
+        * \param min, max Component-wise bounds, min must not exceed max
+        * \return The clamped Vector2
+        */
+        inline Vector2 _MM_CALLCONV MMVector2Clamp(FVector2 v, FVector2 min, FVector2 max)
+        {
+            return Vector2(MMVectorClamp(v.m_vector, min.m_vector, max.m_vector));
+        }
+
+        /** Writes MMVector2Min(v[i], u[i]) to out[i] for count elements
+        * out may alias v or u
+        */
+        inline void _MM_CALLCONV MMVector2MinStream(Vector2* out, const Vector2* v, const Vector2* u, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2MinStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorMin(v[i].m_vector, u[i].m_vector);
+        }
+
+        /** Writes MMVector2Max(v[i], u[i]) to out[i] for count elements
+        * out may alias v or u
+        */
+        inline void _MM_CALLCONV MMVector2MaxStream(Vector2* out, const Vector2* v, const Vector2* u, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2MaxStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorMax(v[i].m_vector, u[i].m_vector);
+        }
+
+        //Writes MMVector2Abs(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector2AbsStream(Vector2* out, const Vector2* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2AbsStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorAbs(in[i].m_vector);
+        }
+
+        //Writes MMVector2Floor(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector2FloorStream(Vector2* out, const Vector2* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2FloorStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorFloor(in[i].m_vector);
+        }
+
+        //Writes MMVector2Ceil(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector2CeilStream(Vector2* out, const Vector2* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2CeilStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorCeil(in[i].m_vector);
+        }
+
+        //Writes MMVector2Round(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector2RoundStream(Vector2* out, const Vector2* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2RoundStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorRound(in[i].m_vector);
+        }
+
+        //Clamps count elements of in between the same bounds, out may alias in
+        inline void _MM_CALLCONV MMVector2ClampStream(Vector2* out, const Vector2* in, size_t count, FVector2 min, FVector2 max)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector2ClampStream");
+
+            const MMFloat4 lo = min.m_vector;
+            const MMFloat4 hi = max.m_vector;
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorClamp(in[i].m_vector, lo, hi);
+        }
     }
 }
@@ -0,0 +1,437 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include "ht_math.h"
+
+#include <cassert>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        //////////////////////////////////////////////////////////////////////
+        // MMVECTOR2X2 Implementation
+        //////////////////////////////////////////////////////////////////////
+
+        //Create a Vector2x2 with every element being 0
+        inline Vector2x2::Vector2x2() : m_vector(MMVectorZero()) {}
+
+        //Create a Vector2x2 with every element being xy
+        inline Vector2x2::Vector2x2(float xy) : m_vector(MMVectorSplat(xy)) {}
+
+        //Create a Vector2x2 from the elements of both vectors
+        inline Vector2x2::Vector2x2(float x0, float y0, float x1, float y1) : m_vector(MMVectorSet(x0, y0, x1, y1)) {}
+
+        //Create a Vector2x2 by packing two Vector2s side by side
+        inline Vector2x2::Vector2x2(const Vector2& first, const Vector2& second) : m_vector(MMVectorMoveLH(first.m_vector, second.m_vector)) {}
+
+        //Create a copy of an existing Vector2x2
+        inline Vector2x2::Vector2x2(const Vector2x2& other) : m_vector(other.m_vector) {}
+
+        //Create a Vector2x2 from two consecutive Float2s (pair does not need to be aligned)
+        inline Vector2x2::Vector2x2(const Float2* pair) : m_vector(MMVectorLoadUnaligned(pair[0].m_data)) {}
+
+        //Create a Vector2x2 object using the data from an MMFloat4 vector
+        inline Vector2x2::Vector2x2(MMFloat4 vector) : m_vector(vector) {}
+
+        //Allocate a 16 byte aligned data chunk for a Vector2x2
+        inline void* Vector2x2::operator new(size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        //Delete the 16 byte aligned data chunk for a Vector2x2
+        inline void Vector2x2::operator delete(void* p)
+        {
+            return aligned_free(p);
+        }
+
+        //Allocate a 16 byte aligned data chunk for an array of Vector2x2
+        inline void* Vector2x2::operator new[](size_t size)
+        {
+            return aligned_malloc(size, vectorAlignment);
+        }
+
+        //Delete a 16 byte aligned data chunk for an array of Vector2x2
+        inline void Vector2x2::operator delete[](void* p)
+        {
+            return aligned_free(p);
+        }
+
+        /** Casts a Vector2x2 object to an MMFloat4
+        * This operator casts a Vector2x2 to an intrinsic MMFloat4
+        */
+        inline Vector2x2::operator MMFloat4() const
+        {
+            return m_vector;
+        }
+
+        /** Adds all elements in both vectors by a given scalar
+        * \param s The scalar to add this Vector2x2 by
+        * \return A Vector2x2 after all the elements have been added by s
+        */
+        inline Vector2x2 Vector2x2::operator+(float s) const
+        {
+            return Vector2x2(MMVectorAdd(m_vector, MMVectorSplat(s)));
+        }
+        /** Subtracts all elements in both vectors by a given scalar
+        * \param s The scalar to subtract this Vector2x2 by
+        * \return A Vector2x2 after all the elements have been subtracted by s
+        */
+        inline Vector2x2 Vector2x2::operator-(float s) const
+        {
+            return Vector2x2(MMVectorSub(m_vector, MMVectorSplat(s)));
+        }
+        /** Multiplies all elements in both vectors by a given scalar
+        * \param s The scalar to multiply this Vector2x2 by
+        * \return A Vector2x2 after all the elements have been multiplied by s
+        */
+        inline Vector2x2 Vector2x2::operator*(float s) const
+        {
+            return Vector2x2(MMVectorMul(m_vector, MMVectorSplat(s)));
+        }
+        /** Divides all elements in both vectors by a given scalar
+        * \param s The scalar to divide this Vector2x2 by
+        * \return A Vector2x2 after all the elements have been divided by s
+        */
+        inline Vector2x2 Vector2x2::operator/(float s) const
+        {
+            return Vector2x2(MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault()));
+        }
+
+        /** Adds all elements in this Vector2x2 by a given scalar
+        * \param s The scalar to add this Vector2x2 by
+        * \return This Vector2x2 after all the elements have been added by s
+        */
+        inline Vector2x2& Vector2x2::operator+=(float s)
+        {
+            m_vector = MMVectorAdd(m_vector, MMVectorSplat(s));
+            return *this;
+        }
+        /** Subtracts all elements in this Vector2x2 by a given scalar
+        * \param s The scalar to subtract this Vector2x2 by
+        * \return This Vector2x2 after all the elements have been subtracted by s
+        */
+        inline Vector2x2& Vector2x2::operator-=(float s)
+        {
+            m_vector = MMVectorSub(m_vector, MMVectorSplat(s));
+            return *this;
+        }
+        /** Multiplies all elements in this Vector2x2 by a given scalar
+        * \param s The scalar to multiply this Vector2x2 by
+        * \return This Vector2x2 after all the elements have been multiplied by s
+        */
+        inline Vector2x2& Vector2x2::operator*=(float s)
+        {
+            m_vector = MMVectorMul(m_vector, MMVectorSplat(s));
+            return *this;
+        }
+        /** Divides all elements in this Vector2x2 by a given scalar
+        * \param s The scalar to divide this Vector2x2 by
+        * \return This Vector2x2 after all the elements have been divided by s
+        */
+        inline Vector2x2& Vector2x2::operator/=(float s)
+        {
+            m_vector = MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault());
+            return *this;
+        }
+
+        /** Adds all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return A new Vector2x2 with the sums of all the pairs of elements
+        */
+        inline Vector2x2 Vector2x2::operator+(const Vector2x2& u) const
+        {
+            return Vector2x2(MMVectorAdd(m_vector, u.m_vector));
+        }
+        /** Subtracts all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return A new Vector2x2 with the differences of all the pairs of elements
+        */
+        inline Vector2x2 Vector2x2::operator-(const Vector2x2& u) const
+        {
+            return Vector2x2(MMVectorSub(m_vector, u.m_vector));
+        }
+        /** Multiplies all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return A new Vector2x2 with the products of all the pairs of elements
+        */
+        inline Vector2x2 Vector2x2::operator*(const Vector2x2& u) const
+        {
+            return Vector2x2(MMVectorMul(m_vector, u.m_vector));
+        }
+        /** Divides all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return A new Vector2x2 with the quocient of all the pairs of elements
+        */
+        inline Vector2x2 Vector2x2::operator/(const Vector2x2& u) const
+        {
+            return Vector2x2(MMVectorDiv(m_vector, u.m_vector, MMPrecisionDefault()));
+        }
+
+        /** Adds all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return This Vector2x2 with the sums of all the pairs of elements
+        */
+        inline Vector2x2& Vector2x2::operator+=(const Vector2x2& u)
+        {
+            m_vector = MMVectorAdd(m_vector, u.m_vector);
+            return *this;
+        }
+        /** Subtracts all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return This Vector2x2 with the differences of all the pairs of elements
+        */
+        inline Vector2x2& Vector2x2::operator-=(const Vector2x2& u)
+        {
+            m_vector = MMVectorSub(m_vector, u.m_vector);
+            return *this;
+        }
+        /** Multiplies all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return This Vector2x2 with the products of all the pairs of elements
+        */
+        inline Vector2x2& Vector2x2::operator*=(const Vector2x2& u)
+        {
+            m_vector = MMVectorMul(m_vector, u.m_vector);
+            return *this;
+        }
+        /** Divides all of the elements from a given Vector2x2 to this one
+        * \param u The other Vector2x2
+        * \return This Vector2x2 with the quocient of all the pairs of elements
+        */
+        inline Vector2x2& Vector2x2::operator/=(const Vector2x2& u)
+        {
+            m_vector = MMVectorDiv(m_vector, u.m_vector, MMPrecisionDefault());
+            return *this;
+        }
+
+        /** Compares the values of this Vector2x2 to another given Vector2x2
+        * \param u The other Vector2x2
+        * \return True if both packed vectors match the other Vector2x2
+        */
+        inline bool Vector2x2::operator==(const Vector2x2& u) const
+        {
+            return MMVectorEqual(m_vector, u.m_vector);
+        }
+        /** Compares the values of this Vector2x2 to another given Vector2x2
+        * \param u The other Vector2x2
+        * \return True if either packed vector differs from the other Vector2x2
+        */
+        inline bool Vector2x2::operator!=(const Vector2x2& u) const
+        {
+            return !operator==(u);
+        }
+
+        /** Fetches an element of this Vector2x2 at the index i
+        * \param i The index of the element to fetch, ordered x0, y0, x1, y1
+        * \return A float reference that is stored in this Vector2x2 at the index i
+        */
+        inline const float& Vector2x2::operator[](size_t i) const
+        {
+            assert(i < 4);
+            return m_data[i];
+        }
+        /** Fetches an element of this Vector2x2 at the index i
+        * \param i The index of the element to fetch, ordered x0, y0, x1, y1
+        * \return A float reference that is stored in this Vector2x2 at the index i
+        */
+        inline float& Vector2x2::operator[](size_t i)
+        {
+            assert(i < 4);
+            return m_data[i];
+        }
+
+        /** Calculates the dot products of both packed vector pairs
+        * \return Both dot products as a Vector2 (first in x, second in y)
+        */
+        inline Vector2 Vector2x2::Dot(const Vector2x2& v, const Vector2x2& u)
+        {
+            return MMVector2x2Dot(v, u);
+        }
+
+        /** Calculates the distances between both packed vector pairs
+        * \return Both distances as a Vector2 (first in x, second in y)
+        */
+        inline Vector2 Vector2x2::Distance(const Vector2x2& v, const Vector2x2& u)
+        {
+            return MMVector2x2Distance(v, u);
+        }
+
+        /** Calculates the squared magnitudes of both packed vectors
+        * \return Both squared magnitudes as a Vector2
+        */
+        inline Vector2 Vector2x2::MagnitudeSquared() const
+        {
+            return MMVector2x2MagnitudeSqr(*this);
+        }
+
+        /** Calculates the magnitudes of both packed vectors
+        * \return Both magnitudes as a Vector2
+        */
+        inline Vector2 Vector2x2::Magnitude() const
+        {
+            return MMVector2x2Magnitude(*this);
+        }
+
+        /** Calculates a copy with both packed vectors normalized
+        * \return the copy
+        */
+        inline Vector2x2 Vector2x2::Normalized() const
+        {
+            return MMVector2x2Normalized(*this);
+        }
+
+        /** Normalizes both packed vectors in place
+        * \return the same Vector2x2
+        */
+        inline Vector2x2 Vector2x2::Normalize()
+        {
+            *this = MMVector2x2Normalized(*this);
+            return *this;
+        }
+
+        //Returns the first packed vector as a Vector2
+        inline Vector2 Vector2x2::First() const
+        {
+            return Vector2(MMVectorMoveLH(m_vector, MMVectorZero()));
+        }
+
+        //Returns the second packed vector as a Vector2
+        inline Vector2 Vector2x2::Second() const
+        {
+            return Vector2(MMVectorMoveHL(MMVectorZero(), m_vector));
+        }
+
+        /** Stores both packed vectors into two consecutive Float2s
+        * \param pair Destination for the two Float2s, does not need to be aligned
+        */
+        inline void Vector2x2::Store(Float2* pair) const
+        {
+            MMVectorStoreUnaligned(pair[0].m_data, m_vector);
+        }
+
+        //Sums each x/y pair so that both lanes of a vector hold its total: (a, a, b, b)
+        inline MMFloat4 _MM_CALLCONV MMVector2x2PairSum(MMFloat4 v)
+        {
+            return MMVectorAdd(v, MMVectorSwizzle<1, 0, 3, 2>(v));
+        }
+
+        //Gathers lane 0 and lane 2 into a Vector2 with zeroed upper lanes
+        inline Vector2 _MM_CALLCONV MMVector2x2GatherPair(MMFloat4 v)
+        {
+            return Vector2(MMVectorShuffle<0, 2, 0, 0>(v, MMVectorZero()));
+        }
+
+        /** Executes the Dot product on both packed vector pairs
+        * \param v The first Vector2x2
+        * \param u The second Vector2x2
+        * \return Both dot products as a Vector2 (first in x, second in y)
+        */
+        inline Vector2 _MM_CALLCONV MMVector2x2Dot(FVector2x2 v, FVector2x2 u)
+        {
+            return MMVector2x2GatherPair(MMVector2x2PairSum(MMVectorMul(v.m_vector, u.m_vector)));
+        }
+
+        /** Calculates the distances between both packed vector pairs
+        * \return Both distances as a Vector2 (first in x, second in y)
+        */
+        inline Vector2 _MM_CALLCONV MMVector2x2Distance(FVector2x2 v, FVector2x2 u)
+        {
+            return MMVector2x2Magnitude(v - u);
+        }
+
+        /** Calculates the squared magnitudes of both packed vectors
+        * \return Both squared magnitudes as a Vector2
+        */
+        inline Vector2 _MM_CALLCONV MMVector2x2MagnitudeSqr(FVector2x2 v)
+        {
+            return MMVector2x2Dot(v, v);
+        }
+
+        /** Calculates the magnitudes of both packed vectors
+        * \return Both magnitudes as a Vector2
+        */
+        inline Vector2 _MM_CALLCONV MMVector2x2Magnitude(FVector2x2 v)
+        {
+            MMFloat4 sum = MMVector2x2PairSum(MMVectorMul(v.m_vector, v.m_vector));
+            return MMVector2x2GatherPair(MMVectorSqrt(sum, MMPrecisionDefault()));
+        }
+
+        /** Normalizes both packed vectors
+        * \param v The Vector2x2 to normalize
+        * \return A copy of v with both vectors normalized
+        */
+        inline Vector2x2 _MM_CALLCONV MMVector2x2Normalized(FVector2x2 v)
+        {
+            return MMVector2x2Normalized(v, MMPrecisionDefault());
+        }
+
+        /** Normalizes both packed vectors with an explicit precision
+        * \param v The Vector2x2 to normalize
+        * \return A copy of v with both vectors normalized
+        */
+        template <typename Precision>
+        inline Vector2x2 _MM_CALLCONV MMVector2x2Normalized(FVector2x2 v, Precision)
+        {
+            MMFloat4 sum = MMVector2x2PairSum(MMVectorMul(v.m_vector, v.m_vector));
+            assert((MMMaskToBits(MMVectorCompareEqual(sum, MMVectorZero())) & 5) == 0);
+            return Vector2x2(Internal::MMVectorDivSqrt(v.m_vector, sum, Precision()));
+        }
+
+        /** Loads a packed array of Float2 into Vector2x2s
+        * \param dst Destination with room for (count + 1) / 2 Vector2x2s
+        * \param src Source array of count Float2s
+        * \param count Number of Float2s in src. If odd, the second vector of
+        * the last Vector2x2 is zeroed.
+        */
+        inline void _MM_CALLCONV MMVector2x2LoadArray(Vector2x2* dst, const Float2* src, size_t count)
+        {
+            size_t pairs = count / 2;
+            for (size_t i = 0; i < pairs; i++)
+                dst[i] = Vector2x2(src + i * 2);
+
+            if (count & 1)
+                dst[pairs] = Vector2x2(src[count - 1].x, src[count - 1].y, 0.0f, 0.0f);
+        }
+
+        /** Stores Vector2x2s back into a packed array of Float2
+        * \param dst Destination array of count Float2s
+        * \param src Source array of (count + 1) / 2 Vector2x2s
+        * \param count Number of Float2s to write
+        */
+        inline void _MM_CALLCONV MMVector2x2StoreArray(Float2* dst, const Vector2x2* src, size_t count)
+        {
+            size_t pairs = count / 2;
+            for (size_t i = 0; i < pairs; i++)
+                src[i].Store(dst + i * 2);
+
+            if (count & 1)
+                dst[count - 1] = Float2(src[pairs].x0, src[pairs].y0);
+        }
+
+        /** An insertion operator for a Vector2x2 to interface with an ostream
+        * \param output the ostream to output to
+        * \param v the Vector2x2 to interface with the ostream
+        */
+        inline std::ostream& operator<<(std::ostream& output, const Vector2x2& v)
+        {
+            output << v.x0 << " " << v.y0 << " " << v.x1 << " " << v.y1;
+            return output;
+        }
+    }
+}
@@ -26,22 +26,25 @@ namespace Hatchit {
         //////////////////////////////////////////////////////////////////////
 
         //Create a Vector3 with all 3 elements being 0
-        inline Vector3::Vector3() : m_vector(_mm_setzero_ps()) {}
+        inline Vector3::Vector3() : m_vector(MMVectorZero()) {}
 
         //Create a Vector3 populated with rawArray data
         inline Vector3::Vector3(const float rawArray[]) : m_vector(MMVectorSet(rawArray[0], rawArray[1], rawArray[2], 0.0f)) {}
 
 		//Create a Vector3 with the same value in all elements
-		inline Vector3::Vector3(float xyz) : m_vector(_mm_set_ps1(xyz)) {}
+		inline Vector3::Vector3(float xyz) : m_vector(MMVectorSplat(xyz)) {}
 
 		//Create a Vector3 using x and y from a Vector2, and z from a float
-		inline Vector3::Vector3(const Vector2& xy, float z) : m_vector(MMVectorSetZRaw(static_cast<__m128>(xy), &z)) {}
+		inline Vector3::Vector3(const Vector2& xy, float z) : m_vector(MMVectorSetZRaw(static_cast<MMFloat4>(xy), &z)) {}
 
         //Create a Vector3 with the elements x, y and z
         inline Vector3::Vector3(float x, float y, float z) : m_vector(MMVectorSet(x, y, z, 0.0f)) {}
 
-        //Create a copy of an existing Vector3
-        inline Vector3::Vector3(const Vector3& other) : m_vector(other.m_vector) {}
+        //Create a Vector3 from packed storage, reads exactly twelve bytes
+        inline Vector3::Vector3(const Float3& packed) : m_vector(MMVectorLoadFloat3(&packed)) {}
+
+        //Create a Vector3 from 16 byte aligned storage with a single load
+        inline Vector3::Vector3(const Float3A& packed) : m_vector(MMVectorLoadFloat3A(&packed)) {}
 
         //Allocate a 16byte aligned array of Vector3
         inline void* Vector3::operator new(size_t _size)
@@ -55,10 +58,10 @@ namespace Hatchit {
             aligned_free(p);
         }
 
-		/** Casts a Vector3 object to a __m128
-		* This operator casts a Vector3 to an instrinsic __m128
+		/** Casts a Vector3 object to a MMFloat4
+		* This operator casts a Vector3 to an instrinsic MMFloat4
 		*/
-		inline Vector3::operator const __m128(void) const
+		inline Vector3::operator const MMFloat4(void) const
 		{
 			return m_vector;
 		}
@@ -72,7 +75,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator+(float s) const
 		{
 			Vector3 result;
-			result.m_vector = _mm_add_ps(m_vector, MMVectorSet(s, s, s, 0.0f));
+			result.m_vector = MMVectorAdd(m_vector, MMVectorSet(s, s, s, 0.0f));
 			return result;
 		}
 		/** Subtracts all elements in this Vector3 by a given scalar
@@ -83,7 +86,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator-(float s) const
 		{
 			Vector3 vec;
-			vec.m_vector = _mm_sub_ps(m_vector, MMVectorSet(s, s, s, 0.0f));
+			vec.m_vector = MMVectorSub(m_vector, MMVectorSet(s, s, s, 0.0f));
 			return vec;
 		}
 		/** Multiplies all elements in this Vector3 by a given scalar
@@ -94,7 +97,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator*(float s) const
 		{
 			Vector3 result;
-			result.m_vector = _mm_mul_ps(m_vector, _mm_set_ps1(s));
+			result.m_vector = MMVectorMul(m_vector, MMVectorSplat(s));
 			return result;
 		}
 		/** Divides all elements in this Vector3 by a given scalar
@@ -106,7 +109,7 @@ namespace Hatchit {
 		{
 			assert(s != 0.0f);
 			Vector3 result;
-			result.m_vector = _mm_div_ps(m_vector, _mm_set_ps1(s));
+			result.m_vector = MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault());
 			return result;
 		}
 		/** Adds all elements in this Vector3 by a given scalar
@@ -116,7 +119,7 @@ namespace Hatchit {
 		*/
 		inline Vector3 Vector3::operator+=(float s)
 		{
-			m_vector = _mm_add_ps(m_vector, MMVectorSet(s, s, s, 0.0f));
+			m_vector = MMVectorAdd(m_vector, MMVectorSet(s, s, s, 0.0f));
 			return (*this);
 		}
 		/** Subtracts all elements in this Vector3 by a given scalar
@@ -126,7 +129,7 @@ namespace Hatchit {
 		*/
 		inline Vector3 Vector3::operator-=(float s)
 		{
-			m_vector = _mm_sub_ps(m_vector, MMVectorSet(s, s, s, 0.0f));
+			m_vector = MMVectorSub(m_vector, MMVectorSet(s, s, s, 0.0f));
 			return (*this);
 		}
         /** Multiplies all elements in this Vector3 by a given scalar
@@ -136,7 +139,7 @@ namespace Hatchit {
         */
         inline Vector3 Vector3::operator*=(float s)
         {
-            m_vector = _mm_mul_ps(m_vector, _mm_set_ps1(s));
+            m_vector = MMVectorMul(m_vector, MMVectorSplat(s));
             return (*this);
         }
         /** Divides all elements in this Vector3 by a given scalar
@@ -146,7 +149,7 @@ namespace Hatchit {
         */
         inline Vector3 Vector3::operator/=(float s)
         {
-            m_vector = _mm_div_ps(m_vector, _mm_set_ps1(s));
+            m_vector = MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault());
             return (*this);
         }
 
@@ -158,7 +161,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator+(const Vector3& u) const
 		{
 			Vector3 vec;
-			vec.m_vector = _mm_add_ps(m_vector, u.m_vector);
+			vec.m_vector = MMVectorAdd(m_vector, u.m_vector);
 			return vec;
 		}
 		/** Subtracts all of the elements from this vector by a given vector
@@ -168,7 +171,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator-(const Vector3& u) const
 		{
 			Vector3 vec;
-			vec.m_vector = _mm_sub_ps(m_vector, u.m_vector);
+			vec.m_vector = MMVectorSub(m_vector, u.m_vector);
 			return vec;
 		}
 		/** Executes memberwise multiplication on two vectors
@@ -178,7 +181,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator*(const Vector3& u) const
 		{
 			Vector3 v;
-			v.m_vector = _mm_mul_ps(this->m_vector, u.m_vector);
+			v.m_vector = MMVectorMul(this->m_vector, u.m_vector);
 			return v;
 		}
 		/** Executes memberwise division on two vectors
@@ -188,7 +191,7 @@ namespace Hatchit {
 		inline Vector3 Vector3::operator/(const Vector3 & u) const
 		{
 			Vector3 v;
-			v.m_vector = _mm_div_ps(this->m_vector, u.m_vector);
+			v.m_vector = MMVectorDiv(this->m_vector, u.m_vector, MMPrecisionDefault());
 			return v;
 		}
         /** Adds all of the elements from a given vector to this one
@@ -197,7 +200,7 @@ namespace Hatchit {
         */
         inline Vector3 Vector3::operator+=(const Vector3& u)
         {
-            m_vector = _mm_add_ps(m_vector, u.m_vector);
+            m_vector = MMVectorAdd(m_vector, u.m_vector);
             return (*this);
         }
         /** Subtracts all of the elements from this vector by a given one
@@ -206,7 +209,7 @@ namespace Hatchit {
         */
         inline Vector3 Vector3::operator-=(const Vector3& u)
         {
-            m_vector = _mm_sub_ps(m_vector, u.m_vector);
+            m_vector = MMVectorSub(m_vector, u.m_vector);
             return (*this);
         }
 		/** memberwise multiplication that stores the result in the first operand
@@ -215,7 +218,7 @@ namespace Hatchit {
 		*/
 		inline Vector3 Vector3::operator*=(const Vector3 & u)
 		{
-			m_vector = _mm_mul_ps(m_vector, u.m_vector);
+			m_vector = MMVectorMul(m_vector, u.m_vector);
 			return (*this);
 		}
 		/** memberwise division that stores the result in the first operand
@@ -224,7 +227,7 @@ namespace Hatchit {
 		*/
 		inline Vector3 Vector3::operator/=(const Vector3 & u)
 		{
-			m_vector = _mm_div_ps(m_vector, u.m_vector);
+			m_vector = MMVectorDiv(m_vector, u.m_vector, MMPrecisionDefault());
 			return (*this);
 		}
 
@@ -234,7 +237,7 @@ namespace Hatchit {
 		*/
 		inline bool Vector3::operator==(const Vector3& u) const
 		{
-			return _mm_movemask_ps(_mm_cmpeq_ps(m_vector, u.m_vector)) == 15;
+			return MMVectorEqual(m_vector, u.m_vector);
 		}
 		/** Compares the values of this Vector3 to another given Vector3
 		* \param u The other Vector3
@@ -242,7 +245,7 @@ namespace Hatchit {
 		*/
 		inline bool Vector3::operator!=(const Vector3& u) const
 		{
-			return _mm_movemask_ps(_mm_cmpeq_ps(m_vector, u.m_vector)) != 15;
+			return !MMVectorEqual(m_vector, u.m_vector);
 		}
 
         /** Fetches an element of this Vector at the index i by reference
@@ -271,7 +274,7 @@ namespace Hatchit {
 		inline Vector3::operator Vector2() const
 		{
 			_MM_ALIGN16 float vecArray[4];
-			_mm_store_ps(&vecArray[0], m_vector);
+			MMVectorStore(&vecArray[0], m_vector);
 			return Vector2(vecArray[0], vecArray[1]);
 		}
 
@@ -303,11 +306,7 @@ namespace Hatchit {
         */
         inline float Vector3::Angle(const Vector3& v, const Vector3& u)
         {
-            float dot = MMVector3Dot(v, u);
-            float vMag = MMVector3Magnitude(v);
-            float uMag = MMVector3Magnitude(u);
-
-            return acosf(dot / (vMag * uMag));
+            return MMVector3Angle(v, u);
         }
 
         /** Calculates the distance between two vectors
@@ -319,7 +318,7 @@ namespace Hatchit {
         */
         inline float Vector3::Distance(const Vector3& v, const Vector3& u)
         {
-            return MMVector3Magnitude(v - u);
+            return MMVector3Distance(v, u);
         }
 
 		/** Calculates the magnitude squared of this vector
@@ -360,19 +359,19 @@ namespace Hatchit {
 		* \param u The second Vector3
 		* \return The cross product of v and u as a Vector3
 		*/
-		inline Vector3 _MM_CALLCONV MMVector3Cross(const Vector3& v, const Vector3& u)
+		inline Vector3 _MM_CALLCONV MMVector3Cross(FVector3 v, FVector3 u)
 		{
 			Vector3 output;
 
-			__m128 x00 = _mm_shuffle_ps(v.m_vector, v.m_vector, _MM_SHUFFLE(3, 0, 2, 1));
-			__m128 x10 = _mm_shuffle_ps(u.m_vector, u.m_vector, _MM_SHUFFLE(3, 1, 0, 2));
-			__m128 x01 = _mm_shuffle_ps(v.m_vector, v.m_vector, _MM_SHUFFLE(3, 1, 0, 2));
-			__m128 x11 = _mm_shuffle_ps(u.m_vector, u.m_vector, _MM_SHUFFLE(3, 0, 2, 1));
+			MMFloat4 x00 = MMVectorSwizzle<1, 2, 0, 3>(v.m_vector);
+			MMFloat4 x10 = MMVectorSwizzle<2, 0, 1, 3>(u.m_vector);
+			MMFloat4 x01 = MMVectorSwizzle<2, 0, 1, 3>(v.m_vector);
+			MMFloat4 x11 = MMVectorSwizzle<1, 2, 0, 3>(u.m_vector);
 
-			x00 = _mm_mul_ps(x00, x10);
-			x11 = _mm_mul_ps(x01, x11);
+			x00 = MMVectorMul(x00, x10);
+			x11 = MMVectorMul(x01, x11);
 
-			__m128 val = _mm_sub_ps(x00, x11);
+			MMFloat4 val = MMVectorSub(x00, x11);
 
 			output.m_vector = val;
 			return output;
@@ -384,14 +383,22 @@ namespace Hatchit {
         * \param u The second Vector3
         * \return The Dot product of v and u as a float
         */
-        inline float _MM_CALLCONV MMVector3Dot(const Vector3& v, const Vector3& u)
+        inline float _MM_CALLCONV MMVector3Dot(FVector3 v, FVector3 u)
+        {
+            return MMVectorGetX(MMVector3DotV(v, u));
+        }
+
+        /** Executes the Dot product on two Vector3s without leaving the register file
+        * \return The Dot product of v and u splatted into every lane
+        */
+        inline MMFloat4 _MM_CALLCONV MMVector3DotV(FVector3 v, FVector3 u)
         {
-            __m128 temp;
-            __m128 sq = _mm_mul_ps(v.m_vector, u.m_vector);
-            temp = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(3, 1, 0, 2)));
-            temp = _mm_add_ps(temp, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(3, 0, 2, 1)));
+            MMFloat4 temp;
+            MMFloat4 sq = MMVectorMul(v.m_vector, u.m_vector);
+            temp = MMVectorAdd(sq, MMVectorSwizzle<2, 0, 1, 3>(sq));
+            temp = MMVectorAdd(temp, MMVectorSwizzle<1, 2, 0, 3>(sq));
 
-            return Hatchit::Math::MMVectorGetX(temp);
+            return MMVectorSplatX(temp);
         }
 
         /** Calculates the angle between two vectors
@@ -401,13 +408,10 @@ namespace Hatchit {
         *
         * \return The angle between v and u as a float
         */
-        inline float _MM_CALLCONV MMVector3Angle(const Vector3& v, const Vector3& u)
+        inline float _MM_CALLCONV MMVector3Angle(FVector3 v, FVector3 u)
         {
-            float dot = MMVector3Dot(v, u);
-            float vMag = MMVector3Magnitude(v);
-            float uMag = MMVector3Magnitude(u);
-
-            return acosf(dot / (vMag * uMag));
+            MMFloat4 magProduct = MMVectorMul(MMVector3MagnitudeV(v), MMVector3MagnitudeV(u));
+            return acosf(MMVectorGetX(MMVectorDiv(MMVector3DotV(v, u), magProduct)));
         }
 
         /** Calculates the distance between two vectors
@@ -417,42 +421,72 @@ namespace Hatchit {
         *
         * \return The distance between v and u as a float
         */
-        inline float _MM_CALLCONV MMVector3Distance(const Vector3& v, const Vector3& u)
+        inline float _MM_CALLCONV MMVector3Distance(FVector3 v, FVector3 u)
+        {
+            return MMVectorGetX(MMVector3DistanceV(v, u));
+        }
+
+        //Distance between v and u splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMVector3DistanceV(FVector3 v, FVector3 u)
         {
-            return MMVector3Magnitude(v - u);
+            return MMVector3MagnitudeV(v - u);
         }
 
 
 		/** Returns the magnitude of the vector
 		* \return The magnitude as a float
 		*/
-		inline float _MM_CALLCONV MMVector3MagnitudeSqr(const Vector3& v)
+		inline float _MM_CALLCONV MMVector3MagnitudeSqr(FVector3 v)
 		{
-			return MMVector3Dot(v, v);
+			return MMVectorGetX(MMVector3DotV(v, v));
+		}
+
+		//Squared magnitude splatted into every lane
+		inline MMFloat4 _MM_CALLCONV MMVector3MagnitudeSqrV(FVector3 v)
+		{
+			return MMVector3DotV(v, v);
 		}
 
 		/** Returns the magnitude of the vector
 		* \return The magnitude as a float
 		*/
-		inline float _MM_CALLCONV MMVector3Magnitude(const Vector3& v)
+		inline float _MM_CALLCONV MMVector3Magnitude(FVector3 v)
+		{
+			return MMVectorGetX(MMVector3MagnitudeV(v));
+		}
+
+		//Magnitude splatted into every lane
+		inline MMFloat4 _MM_CALLCONV MMVector3MagnitudeV(FVector3 v)
+		{
+			return MMVector3MagnitudeV(v, MMPrecisionDefault());
+		}
+
+		//Magnitude splatted into every lane, computed with an explicit precision
+		template <typename Precision>
+		inline MMFloat4 _MM_CALLCONV MMVector3MagnitudeV(FVector3 v, Precision)
 		{
-			return sqrtf(MMVector3Dot(v, v));
+			return MMVectorSqrt(MMVector3DotV(v, v), Precision());
 		}
 
         /** Normalizes a Vector3
         * \param v The Vector3 to normalize
         * \return A normalized version of v
         */
-        inline Vector3 _MM_CALLCONV MMVector3Normalized(const Vector3& v)
+        inline Vector3 _MM_CALLCONV MMVector3Normalized(FVector3 v)
+        {
+            return MMVector3Normalized(v, MMPrecisionDefault());
+        }
+
+        /** Normalizes a Vector3 with an explicit precision
+        * \param v The Vector3 to normalize
+        * \return A normalized version of v, within 2^-21 relative error of unit length for MMPrecisionFast
+        */
+        template <typename Precision>
+        inline Vector3 _MM_CALLCONV MMVector3Normalized(FVector3 v, Precision)
         {
             assert(MMVector3MagnitudeSqr(v) > 0.0f);
             Vector3 normalizedVec;
-
-            __m128 vecMul = _mm_mul_ps(v.m_vector, v.m_vector);
-            __m128 addedVec = _mm_add_ps(vecMul, _mm_shuffle_ps(vecMul, vecMul, _MM_SHUFFLE(3, 1, 0, 2)));
-            addedVec = _mm_add_ps(addedVec, _mm_shuffle_ps(vecMul, vecMul, _MM_SHUFFLE(3, 0, 2, 1)));
-            normalizedVec.m_vector = _mm_div_ps(v.m_vector, _mm_sqrt_ps(addedVec));
-
+            normalizedVec.m_vector = Internal::MMVectorDivSqrt(v.m_vector, MMVector3DotV(v, v), Precision());
             return normalizedVec;
         }
 
@@ -473,5 +507,325 @@ namespace Hatchit {
         {
             return Float3(m_data);
         }
+
+        /** Writes x, y and z into packed storage
+        * \param dst Destination Float3, the four bytes after it are not written
+        */
+        inline void Vector3::Store(Float3* dst) const
+        {
+            MMVectorStoreFloat3(dst, m_vector);
+        }
+
+        /** Expands an array of packed Float3 into Vector3s
+        * Groups of four are read with three 16 byte loads that stay inside the
+        * source array and are then split with shuffles. The tail goes through the
+        * twelve byte load, so nothing past src + count is ever touched.
+        * \param dst Destination array of count Vector3s, w is cleared
+        * \param src Source array of count Float3s, no alignment requirement
+        */
+        inline void _MM_CALLCONV MMVector3LoadArray(Vector3* dst, const Float3* src, size_t count)
+        {
+            const MMFloat4 xyzMask = MMVectorSetInt(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0);
+            size_t i = 0;
+
+            for (; i + 4 <= count; i += 4)
+            {
+                const float* p = src[i].m_data;
+                MMFloat4 a = MMVectorLoadUnaligned(p);          //x0 y0 z0 x1
+                MMFloat4 b = MMVectorLoadUnaligned(p + 4);      //y1 z1 x2 y2
+                MMFloat4 c = MMVectorLoadUnaligned(p + 8);      //z2 x3 y3 z3
+
+                MMFloat4 x1y1 = MMVectorShuffle<3, 3, 0, 0>(a, b);
+
+                dst[i + 0].m_vector = MMVectorAnd(a, xyzMask);
+                dst[i + 1].m_vector = MMVectorAnd(MMVectorShuffle<0, 2, 1, 1>(x1y1, b), xyzMask);
+                dst[i + 2].m_vector = MMVectorAnd(MMVectorShuffle<2, 3, 0, 0>(b, c), xyzMask);
+                dst[i + 3].m_vector = MMVectorAnd(MMVectorSwizzle<1, 2, 3, 3>(c), xyzMask);
+            }
+
+            for (; i < count; i++)
+                dst[i].m_vector = MMVectorLoadFloat3(src + i);
+        }
+
+        /** Packs an array of Vector3s into Float3 storage
+        * Groups of four are merged with shuffles into three 16 byte stores, the
+        * tail uses the twelve byte store.
+        * \param dst Destination array of count Float3s, no alignment requirement
+        * \param src Source array of count Vector3s
+        */
+        inline void _MM_CALLCONV MMVector3StoreArray(Float3* dst, const Vector3* src, size_t count)
+        {
+            size_t i = 0;
+
+            for (; i + 4 <= count; i += 4)
+            {
+                MMFloat4 v0 = src[i + 0].m_vector;
+                MMFloat4 v1 = src[i + 1].m_vector;
+                MMFloat4 v2 = src[i + 2].m_vector;
+                MMFloat4 v3 = src[i + 3].m_vector;
+
+                MMFloat4 z0x1 = MMVectorShuffle<2, 2, 0, 0>(v0, v1);
+                MMFloat4 z2x3 = MMVectorShuffle<2, 2, 0, 0>(v2, v3);
+
+                float* p = dst[i].m_data;
+                MMVectorStoreUnaligned(p, MMVectorShuffle<0, 1, 0, 2>(v0, z0x1));
+                MMVectorStoreUnaligned(p + 4, MMVectorShuffle<1, 2, 0, 1>(v1, v2));
+                MMVectorStoreUnaligned(p + 8, MMVectorShuffle<0, 2, 1, 2>(z2x3, v3));
+            }
+
+            for (; i < count; i++)
+                MMVectorStoreFloat3(dst + i, src[i].m_vector);
+        }
+
+        //Returns (x, z, y)
+        inline Vector3 Vector3::xzy() const
+        {
+            return Swizzle<0, 2, 1>(*this);
+        }
+
+        //Returns (y, x, z)
+        inline Vector3 Vector3::yxz() const
+        {
+            return Swizzle<1, 0, 2>(*this);
+        }
+
+        //Returns (y, z, x)
+        inline Vector3 Vector3::yzx() const
+        {
+            return Swizzle<1, 2, 0>(*this);
+        }
+
+        //Returns (z, x, y)
+        inline Vector3 Vector3::zxy() const
+        {
+            return Swizzle<2, 0, 1>(*this);
+        }
+
+        //Returns (z, y, x)
+        inline Vector3 Vector3::zyx() const
+        {
+            return Swizzle<2, 1, 0>(*this);
+        }
+
+        /** Rearranges the components of a Vector3 at compile time
+        * \param v The Vector3 to rearrange
+        * \return (v[X], v[Y], v[Z]) built with a single shuffle
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z>
+        inline Vector3 _MM_CALLCONV Swizzle(FVector3 v)
+        {
+            static_assert(X < 3 && Y < 3 && Z < 3, "Vector3 swizzle indices must be in the range [0, 2]");
+            Vector3 result;
+            result.m_vector = MMVectorSwizzle<X, Y, Z, 3>(v.m_vector);
+            return result;
+        }
+
+        /** Builds a Vector3 from components of v (indices 0-2) and u (indices 4-6)
+        * \return The permuted Vector3, resolved to a shuffle, move or blend at compile time
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z>
+        inline Vector3 _MM_CALLCONV Permute(FVector3 v, FVector3 u)
+        {
+            static_assert((X & 3) < 3 && (Y & 3) < 3 && (Z & 3) < 3 && X < 8 && Y < 8 && Z < 8, "Vector3 permute indices must be 0-2 or 4-6");
+            Vector3 result;
+            result.m_vector = MMVectorPermute<X, Y, Z, 3>(v.m_vector, u.m_vector);
+            return result;
+        }
+
+        //Sets each mask lane where the component of v is less than the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector3Less(FVector3 v, FVector3 u)
+        {
+            return MMVectorCompareLess(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is less than or equal to the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector3LessEqual(FVector3 v, FVector3 u)
+        {
+            return MMVectorCompareLessEqual(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is greater than the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector3Greater(FVector3 v, FVector3 u)
+        {
+            return MMVectorCompareGreater(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is greater than or equal to the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector3GreaterEqual(FVector3 v, FVector3 u)
+        {
+            return MMVectorCompareGreaterEqual(v.m_vector, u.m_vector);
+        }
+
+        /** Compares two Vector3s component-wise within a tolerance
+        * \param epsilon Largest absolute difference still treated as equal
+        * \return Mask of the components that are near equal
+        */
+        inline MMMask4 _MM_CALLCONV MMVector3NearEqual(FVector3 v, FVector3 u, float epsilon)
+        {
+            return MMVectorNearEqual(v.m_vector, u.m_vector, MMVectorSplat(epsilon));
+        }
+
+        //Sets each mask lane whose component is NaN
+        inline MMMask4 _MM_CALLCONV MMVector3IsNaN(FVector3 v)
+        {
+            return MMVectorIsNaN(v.m_vector);
+        }
+
+        //Sets each mask lane whose component is infinite
+        inline MMMask4 _MM_CALLCONV MMVector3IsInf(FVector3 v)
+        {
+            return MMVectorIsInf(v.m_vector);
+        }
+
+        //Returns true if the mask is set for all x, y and z components
+        inline bool _MM_CALLCONV MMVector3AllTrue(MMMask4 mask)
+        {
+            return MMMaskAllTrue(mask, 7);
+        }
+
+        //Returns true if the mask is set for any of the x, y and z components
+        inline bool _MM_CALLCONV MMVector3AnyTrue(MMMask4 mask)
+        {
+            return MMMaskAnyTrue(mask, 7);
+        }
+
+        /** Branchless component-wise select between two Vector3s
+        * \param mask Components taken from v where set, from u where clear
+        * \return The selected Vector3
+        */
+        inline Vector3 _MM_CALLCONV MMVector3Select(MMMask4 mask, FVector3 v, FVector3 u)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorSelect(mask, v.m_vector, u.m_vector);
+            return result;
+        }
+
+        //Returns the component-wise smaller of two Vector3s
+        inline Vector3 _MM_CALLCONV MMVector3Min(FVector3 v, FVector3 u)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorMin(v.m_vector, u.m_vector);
+            return result;
+        }
+
+        //Returns the component-wise larger of two Vector3s
+        inline Vector3 _MM_CALLCONV MMVector3Max(FVector3 v, FVector3 u)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorMax(v.m_vector, u.m_vector);
+            return result;
+        }
+
+        //Returns the absolute value of each component
+        inline Vector3 _MM_CALLCONV MMVector3Abs(FVector3 v)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorAbs(v.m_vector);
+            return result;
+        }
+
+        //Returns the each component rounded toward negative infinity
+        inline Vector3 _MM_CALLCONV MMVector3Floor(FVector3 v)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorFloor(v.m_vector);
+            return result;
+        }
+
+        //Returns the each component rounded toward positive infinity
+        inline Vector3 _MM_CALLCONV MMVector3Ceil(FVector3 v)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorCeil(v.m_vector);
+            return result;
+        }
+
+        //Returns the each component rounded to the nearest integer, ties to even
+        inline Vector3 _MM_CALLCONV MMVector3Round(FVector3 v)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorRound(v.m_vector);
+            return result;
+        }
+
+        /** Clamps each component of a Vector3
+        * \param min, max Component-wise bounds, min must not exceed max
+        * \return The clamped Vector3
+        */
+        inline Vector3 _MM_CALLCONV MMVector3Clamp(FVector3 v, FVector3 min, FVector3 max)
+        {
+            Vector3 result;
+            result.m_vector = MMVectorClamp(v.m_vector, min.m_vector, max.m_vector);
+            return result;
+        }
+
+        /** Writes MMVector3Min(v[i], u[i]) to out[i] for count elements
+        * out may alias v or u
+        */
+        inline void _MM_CALLCONV MMVector3MinStream(Vector3* out, const Vector3* v, const Vector3* u, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3MinStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorMin(v[i].m_vector, u[i].m_vector);
+        }
+
+        /** Writes MMVector3Max(v[i], u[i]) to out[i] for count elements
+        * out may alias v or u
+        */
+        inline void _MM_CALLCONV MMVector3MaxStream(Vector3* out, const Vector3* v, const Vector3* u, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3MaxStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorMax(v[i].m_vector, u[i].m_vector);
+        }
+
+        //Writes MMVector3Abs(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector3AbsStream(Vector3* out, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3AbsStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorAbs(in[i].m_vector);
+        }
+
+        //Writes MMVector3Floor(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector3FloorStream(Vector3* out, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3FloorStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorFloor(in[i].m_vector);
+        }
+
+        //Writes MMVector3Ceil(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector3CeilStream(Vector3* out, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3CeilStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorCeil(in[i].m_vector);
+        }
+
+        //Writes MMVector3Round(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector3RoundStream(Vector3* out, const Vector3* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3RoundStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorRound(in[i].m_vector);
+        }
+
+        //Clamps count elements of in between the same bounds, out may alias in
+        inline void _MM_CALLCONV MMVector3ClampStream(Vector3* out, const Vector3* in, size_t count, FVector3 min, FVector3 max)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector3ClampStream");
+
+            const MMFloat4 lo = min.m_vector;
+            const MMFloat4 hi = max.m_vector;
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorClamp(in[i].m_vector, lo, hi);
+        }
     }
 }
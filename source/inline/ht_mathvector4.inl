@@ -23,64 +23,78 @@ namespace Hatchit
         /** Returns a normalized version of the vector
         * \return The normalized vector
         */
-        inline Vector4 _MM_CALLCONV MMVector4Normalize(const Vector4& v)
+        inline Vector4 _MM_CALLCONV MMVector4Normalize(FVector4 v)
         {
-            __m128 normalizedVec = _mm_mul_ps(v.m_vector, v.m_vector);
-            normalizedVec = _mm_add_ps(normalizedVec, _mm_shuffle_ps(normalizedVec, normalizedVec, _MM_SHUFFLE(2, 3, 0, 1)));
-            normalizedVec = _mm_add_ps(normalizedVec, _mm_shuffle_ps(normalizedVec, normalizedVec, _MM_SHUFFLE(0, 1, 2, 3)));
-            normalizedVec = _mm_sqrt_ps(normalizedVec);
-            Vector4 val;
-            val.m_vector = _mm_div_ps(v.m_vector, normalizedVec);
-
-            return val; 
+            return MMVector4Normalize(v, MMPrecisionDefault());
         }
 
-        inline Vector4 _MM_CALLCONV MMVector4NormalizeEst(const Vector4& v)
+        //Normalizes v with an explicit precision, within 2^-21 relative error of unit length for MMPrecisionFast
+        template <typename Precision>
+        inline Vector4 _MM_CALLCONV MMVector4Normalize(FVector4 v, Precision)
         {
-            __m128 normalizedVec = _mm_mul_ps(v.m_vector, v.m_vector);
-            normalizedVec = _mm_add_ps(normalizedVec, _mm_shuffle_ps(normalizedVec, normalizedVec, _MM_SHUFFLE(2, 3, 0, 1)));
-            normalizedVec = _mm_add_ps(normalizedVec, _mm_shuffle_ps(normalizedVec, normalizedVec, _MM_SHUFFLE(0, 1, 2, 3)));
-            normalizedVec = _mm_rsqrt_ps(normalizedVec);
-            Vector4 val;
-            val.m_vector = _mm_mul_ps(v.m_vector, normalizedVec);
+            return Vector4(Internal::MMVectorDivSqrt(v.m_vector, MMVector4DotV(v, v), Precision()));
+        }
 
-            return val;
+        inline Vector4 _MM_CALLCONV MMVector4NormalizeEst(FVector4 v)
+        {
+            return Vector4(MMVectorMul(v.m_vector, MMVectorReciprocalSqrtEst(MMVector4MagnitudeSqrV(v))));
         }
 
         
         /** Returns the magnitude of the vector
         * \return The magnitude as a float
         */
-        inline float _MM_CALLCONV MMVector4Magnitude(const Vector4& v)
+        inline float _MM_CALLCONV MMVector4Magnitude(FVector4 v)
         {
-            __m128 val = _mm_mul_ps(v.m_vector, v.m_vector);
-            val = _mm_add_ps(val, _mm_shuffle_ps(val, val, _MM_SHUFFLE(2, 3, 0, 1)));
-            val = _mm_add_ps(val, _mm_shuffle_ps(val, val, _MM_SHUFFLE(0, 1, 2, 3)));
-            val = _mm_sqrt_ps(val);
-
-            return MMVectorGetX(val);
+            return MMVectorGetX(MMVector4MagnitudeV(v));
         }
 
-        inline float _MM_CALLCONV MMVector4MagnitudeSqr(const Vector4& v)
+        inline float _MM_CALLCONV MMVector4MagnitudeSqr(FVector4 v)
         {
-            __m128 val = _mm_mul_ps(v.m_vector, v.m_vector);
-            val = _mm_add_ps(val, _mm_shuffle_ps(val, val, _MM_SHUFFLE(2, 3, 0, 1)));
-            val = _mm_add_ps(val, _mm_shuffle_ps(val, val, _MM_SHUFFLE(0, 1, 2, 3)));
-
-            return MMVectorGetX(val);
+            return MMVectorGetX(MMVector4DotV(v, v));
         }
 
         /** Returns the dot product of two vectors
         * \return The dot product as a float
         */
-        inline float _MM_CALLCONV MMVector4Dot(const Vector4& v, const Vector4& u)
+        inline float _MM_CALLCONV MMVector4Dot(FVector4 v, FVector4 u)
+        {
+            return MMVectorGetX(MMVector4DotV(v, u));
+        }
+
+        /** Returns the dot product of two vectors without leaving the register file
+        * \return The dot product splatted into every lane
+        */
+        inline MMFloat4 _MM_CALLCONV MMVector4DotV(FVector4 v, FVector4 u)
+        {
+            MMFloat4 dotProd = MMVectorMul(v.m_vector, u.m_vector);
+            dotProd = MMVectorAdd(dotProd, MMVectorSwizzle<1, 0, 3, 2>(dotProd));
+            return MMVectorAdd(dotProd, MMVectorSwizzle<3, 2, 1, 0>(dotProd));
+        }
+
+        //Squared magnitude splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMVector4MagnitudeSqrV(FVector4 v)
+        {
+            return MMVector4DotV(v, v);
+        }
+
+        //Magnitude splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMVector4MagnitudeV(FVector4 v)
+        {
+            return MMVector4MagnitudeV(v, MMPrecisionDefault());
+        }
+
+        //Magnitude splatted into every lane, computed with an explicit precision
+        template <typename Precision>
+        inline MMFloat4 _MM_CALLCONV MMVector4MagnitudeV(FVector4 v, Precision)
         {
-            __m128 dotProd = _mm_mul_ps(v.m_vector, u.m_vector);
-            dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(2, 3, 0, 1)));
-            dotProd = _mm_add_ps(dotProd, _mm_shuffle_ps(dotProd, dotProd, _MM_SHUFFLE(0, 1, 2, 3)));
-            float returnValue;
-            _mm_store_ss(&returnValue, dotProd);
-            return returnValue;
+            return MMVectorSqrt(MMVector4DotV(v, v), Precision());
+        }
+
+        //Distance between v and u splatted into every lane
+        inline MMFloat4 _MM_CALLCONV MMVector4DistanceV(FVector4 v, FVector4 u)
+        {
+            return MMVector4MagnitudeV(Vector4(MMVectorSub(v.m_vector, u.m_vector)));
         }
 
         /****************************************************
@@ -88,13 +102,13 @@ namespace Hatchit
         *****************************************************/
 
         //Create a Vector4 with all 4 elements being 0
-        inline Vector4::Vector4() : m_vector(_mm_setzero_ps()) {}
+        inline Vector4::Vector4() : m_vector(MMVectorZero()) {}
 
         //Create a Vector4 populated with rawArray data
         inline Vector4::Vector4(const float rawArray[]) : m_vector(MMVectorSet(rawArray[0], rawArray[1], rawArray[2], rawArray[3])) {}
 
 		//Create a Vector4 with the same value in all elements
-		inline Vector4::Vector4(float xyzw) : m_vector(_mm_set_ps1(xyzw)) {}
+		inline Vector4::Vector4(float xyzw) : m_vector(MMVectorSplat(xyzw)) {}
 
         //Create a Vector4 with the elements x, y and z
         inline Vector4::Vector4(float x, float y, float z, float w) : m_vector(MMVectorSet(x, y, z, w)) {}
@@ -103,13 +117,10 @@ namespace Hatchit
 		inline Vector4::Vector4(const Vector2 & xy, float z, float w) : m_vector(MMVectorSet(xy.x, xy.y, z, w)) {}
 
         //Create a Vector4 with the first three elements of a given Vector3 and a fourth given float w
-		inline Vector4::Vector4(const Vector3& v3, float w) : m_vector(MMVectorSetWRaw(static_cast<__m128>(v3), &w)) {}
-
-        //Create a copy of an existing Vector4
-        inline Vector4::Vector4(const Vector4& other) : m_vector(other.m_vector) {}
+		inline Vector4::Vector4(const Vector3& v3, float w) : m_vector(MMVectorSetWRaw(static_cast<MMFloat4>(v3), &w)) {}
 
         //Create a Vector4 with an intrinsic vector type.
-        inline Vector4::Vector4(__m128 v) : m_vector(std::move(v)) {}
+        inline Vector4::Vector4(MMFloat4 v) : m_vector(std::move(v)) {}
 
         //Allocate a 16byte aligned array of Vector4s
         inline void* Vector4::operator new(size_t _size)
@@ -123,8 +134,8 @@ namespace Hatchit
             aligned_free(p);
         }
 
-        //Cast Vector4's SSE intrinsic to __m128
-        inline Vector4::operator __m128(void) const
+        //Cast Vector4's SSE intrinsic to MMFloat4
+        inline Vector4::operator MMFloat4(void) const
         {
             return m_vector;
         }
@@ -136,7 +147,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator+(float s) const
         {
-            return Vector4(_mm_add_ps(m_vector, _mm_set1_ps(s)));
+            return Vector4(MMVectorAdd(m_vector, MMVectorSplat(s)));
         }
 
         /** Subtracts all elements in this Vector4 by a given scalar
@@ -146,7 +157,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator-(float s) const
         {
-            return Vector4(_mm_sub_ps(m_vector, _mm_set1_ps(s)));
+            return Vector4(MMVectorSub(m_vector, MMVectorSplat(s)));
         }
       
         /** Multiplies all elements in this Vector4 by a given scalar
@@ -156,7 +167,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator*(float s) const
         {
-            return Vector4(_mm_mul_ps(m_vector, _mm_set1_ps(s)));
+            return Vector4(MMVectorMul(m_vector, MMVectorSplat(s)));
         }
 
         /** Divides all elements in this Vector4 by a given scalar
@@ -166,7 +177,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator/(float s) const
         {
-            return Vector4(_mm_div_ps(m_vector, _mm_set1_ps(s)));
+            return Vector4(MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault()));
         }
 
         /** Adds all elements in this Vector4 by a given scalar
@@ -176,7 +187,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator+=(float s)
         {
-            m_vector = _mm_add_ps(m_vector, _mm_set1_ps(s));
+            m_vector = MMVectorAdd(m_vector, MMVectorSplat(s));
             return *this;
         }
 
@@ -187,7 +198,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator-=(float s)
         {
-            m_vector = _mm_sub_ps(m_vector, _mm_set1_ps(s));
+            m_vector = MMVectorSub(m_vector, MMVectorSplat(s));
             return *this;
         }
 
@@ -198,7 +209,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator*=(float s)
         {
-            m_vector = _mm_mul_ps(m_vector, _mm_set1_ps(s));
+            m_vector = MMVectorMul(m_vector, MMVectorSplat(s));
             return *this;
         }
 
@@ -209,7 +220,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator/=(float s)
         {
-            m_vector = _mm_div_ps(m_vector, _mm_set1_ps(s));
+            m_vector = MMVectorDiv(m_vector, MMVectorSplat(s), MMPrecisionDefault());
             return *this;
         }
 
@@ -241,7 +252,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator+(const Vector4& rhs) const
         {
-            return Vector4(_mm_add_ps(m_vector, rhs.m_vector));
+            return Vector4(MMVectorAdd(m_vector, rhs.m_vector));
         }
 
         /** Subtracts all of the elements from this vector by a given vector
@@ -250,7 +261,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator-(const Vector4& u) const
         {
-            return Vector4(_mm_sub_ps(m_vector, u.m_vector));
+            return Vector4(MMVectorSub(m_vector, u.m_vector));
         }
 
         /** Executes memberwise multiplication on this Vector4
@@ -259,7 +270,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator*(const Vector4& rhs) const
         {
-            return Vector4(_mm_mul_ps(m_vector, rhs.m_vector));
+            return Vector4(MMVectorMul(m_vector, rhs.m_vector));
         }
 
         /** Executes memberwise division on this Vector4
@@ -268,7 +279,7 @@ namespace Hatchit
         */
         inline Vector4 Vector4::operator/(const Vector4& rhs) const
         {
-            return Vector4(_mm_div_ps(m_vector, rhs.m_vector));
+            return Vector4(MMVectorDiv(m_vector, rhs.m_vector, MMPrecisionDefault()));
         }
 
         /** Adds all of the elements from a given vector to this one
@@ -277,7 +288,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator+=(const Vector4& rhs)
         {
-            m_vector = _mm_add_ps(m_vector, rhs.m_vector);
+            m_vector = MMVectorAdd(m_vector, rhs.m_vector);
             return *this;
         }
 
@@ -287,7 +298,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator-=(const Vector4& rhs)
         {
-            m_vector = _mm_sub_ps(m_vector, rhs.m_vector);
+            m_vector = MMVectorSub(m_vector, rhs.m_vector);
             return *this;
         }
 
@@ -298,7 +309,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator*=(const Vector4& rhs)
         {
-            m_vector = _mm_mul_ps(m_vector, rhs.m_vector);
+            m_vector = MMVectorMul(m_vector, rhs.m_vector);
             return *this;
         }
 
@@ -309,7 +320,7 @@ namespace Hatchit
         */
         inline Vector4& Vector4::operator/=(const Vector4& rhs)
         {
-            m_vector = _mm_div_ps(m_vector, rhs.m_vector);
+            m_vector = MMVectorDiv(m_vector, rhs.m_vector, MMPrecisionDefault());
             return *this;
         }
 
@@ -337,7 +348,7 @@ namespace Hatchit
         inline Vector4::operator Vector3() const
         {
             _MM_ALIGN16 float vecArray[4];
-            _mm_store_ps(&vecArray[0], m_vector);
+            MMVectorStore(&vecArray[0], m_vector);
             return Vector3(vecArray[0], vecArray[1], vecArray[2]);
         }
 
@@ -345,7 +356,7 @@ namespace Hatchit
         inline Vector4::operator Vector2() const
         {
             _MM_ALIGN16 float vecArray[4];
-            _mm_store_ps(&vecArray[0], m_vector);
+            MMVectorStore(&vecArray[0], m_vector);
             return Vector2(vecArray[0], vecArray[1]);
         }
 
@@ -392,5 +403,252 @@ namespace Hatchit
         {
             return Float4(m_data);
         }
+
+        //Returns (y, z, x, w)
+        inline Vector4 Vector4::yzxw() const
+        {
+            return Swizzle<1, 2, 0, 3>(*this);
+        }
+
+        //Returns (z, x, y, w)
+        inline Vector4 Vector4::zxyw() const
+        {
+            return Swizzle<2, 0, 1, 3>(*this);
+        }
+
+        //Returns (z, w, x, y)
+        inline Vector4 Vector4::zwxy() const
+        {
+            return Swizzle<2, 3, 0, 1>(*this);
+        }
+
+        //Returns (w, z, y, x)
+        inline Vector4 Vector4::wzyx() const
+        {
+            return Swizzle<3, 2, 1, 0>(*this);
+        }
+
+        //Returns x in every component
+        inline Vector4 Vector4::xxxx() const
+        {
+            return Swizzle<0, 0, 0, 0>(*this);
+        }
+
+        //Returns y in every component
+        inline Vector4 Vector4::yyyy() const
+        {
+            return Swizzle<1, 1, 1, 1>(*this);
+        }
+
+        //Returns z in every component
+        inline Vector4 Vector4::zzzz() const
+        {
+            return Swizzle<2, 2, 2, 2>(*this);
+        }
+
+        //Returns w in every component
+        inline Vector4 Vector4::wwww() const
+        {
+            return Swizzle<3, 3, 3, 3>(*this);
+        }
+
+        /** Rearranges the components of a Vector4 at compile time
+        * \param v The Vector4 to rearrange
+        * \return (v[X], v[Y], v[Z], v[W]) built with a single shuffle
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline Vector4 _MM_CALLCONV Swizzle(FVector4 v)
+        {
+            return Vector4(MMVectorSwizzle<X, Y, Z, W>(v.m_vector));
+        }
+
+        /** Builds a Vector4 from components of v (indices 0-3) and u (indices 4-7)
+        * \return The permuted Vector4, resolved to a shuffle, move or blend at compile time
+        */
+        template <uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+        inline Vector4 _MM_CALLCONV Permute(FVector4 v, FVector4 u)
+        {
+            return Vector4(MMVectorPermute<X, Y, Z, W>(v.m_vector, u.m_vector));
+        }
+
+        //Sets each mask lane where the component of v is less than the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector4Less(FVector4 v, FVector4 u)
+        {
+            return MMVectorCompareLess(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is less than or equal to the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector4LessEqual(FVector4 v, FVector4 u)
+        {
+            return MMVectorCompareLessEqual(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is greater than the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector4Greater(FVector4 v, FVector4 u)
+        {
+            return MMVectorCompareGreater(v.m_vector, u.m_vector);
+        }
+
+        //Sets each mask lane where the component of v is greater than or equal to the matching component of u
+        inline MMMask4 _MM_CALLCONV MMVector4GreaterEqual(FVector4 v, FVector4 u)
+        {
+            return MMVectorCompareGreaterEqual(v.m_vector, u.m_vector);
+        }
+
+        /** Compares two Vector4s component-wise within a tolerance
+        * \param epsilon Largest absolute difference still treated as equal
+        * \return Mask of the components that are near equal
+        */
+        inline MMMask4 _MM_CALLCONV MMVector4NearEqual(FVector4 v, FVector4 u, float epsilon)
+        {
+            return MMVectorNearEqual(v.m_vector, u.m_vector, MMVectorSplat(epsilon));
+        }
+
+        //Sets each mask lane whose component is NaN
+        inline MMMask4 _MM_CALLCONV MMVector4IsNaN(FVector4 v)
+        {
+            return MMVectorIsNaN(v.m_vector);
+        }
+
+        //Sets each mask lane whose component is infinite
+        inline MMMask4 _MM_CALLCONV MMVector4IsInf(FVector4 v)
+        {
+            return MMVectorIsInf(v.m_vector);
+        }
+
+        //Returns true if the mask is set for all four components
+        inline bool _MM_CALLCONV MMVector4AllTrue(MMMask4 mask)
+        {
+            return MMMaskAllTrue(mask, 15);
+        }
+
+        //Returns true if the mask is set for any of the four components
+        inline bool _MM_CALLCONV MMVector4AnyTrue(MMMask4 mask)
+        {
+            return MMMaskAnyTrue(mask, 15);
+        }
+
+        /** Branchless component-wise select between two Vector4s
+        * \param mask Components taken from v where set, from u where clear
+        * \return The selected Vector4
+        */
+        inline Vector4 _MM_CALLCONV MMVector4Select(MMMask4 mask, FVector4 v, FVector4 u)
+        {
+            return Vector4(MMVectorSelect(mask, v.m_vector, u.m_vector));
+        }
+
+        //Returns the component-wise smaller of two Vector4s
+        inline Vector4 _MM_CALLCONV MMVector4Min(FVector4 v, FVector4 u)
+        {
+            return Vector4(MMVectorMin(v.m_vector, u.m_vector));
+        }
+
+        //Returns the component-wise larger of two Vector4s
+        inline Vector4 _MM_CALLCONV MMVector4Max(FVector4 v, FVector4 u)
+        {
+            return Vector4(MMVectorMax(v.m_vector, u.m_vector));
+        }
+
+        //Returns the absolute value of each component
+        inline Vector4 _MM_CALLCONV MMVector4Abs(FVector4 v)
+        {
+            return Vector4(MMVectorAbs(v.m_vector));
+        }
+
+        //Returns the each component rounded toward negative infinity
+        inline Vector4 _MM_CALLCONV MMVector4Floor(FVector4 v)
+        {
+            return Vector4(MMVectorFloor(v.m_vector));
+        }
+
+        //Returns the each component rounded toward positive infinity
+        inline Vector4 _MM_CALLCONV MMVector4Ceil(FVector4 v)
+        {
+            return Vector4(MMVectorCeil(v.m_vector));
+        }
+
+        //Returns the each component rounded to the nearest integer, ties to even
+        inline Vector4 _MM_CALLCONV MMVector4Round(FVector4 v)
+        {
+            return Vector4(MMVectorRound(v.m_vector));
+        }
+
+        /** Clamps each component of a Vector4
+        * \param min, max Component-wise bounds, min must not exceed max
+        * \return The clamped Vector4
+        */
+        inline Vector4 _MM_CALLCONV MMVector4Clamp(FVector4 v, FVector4 min, FVector4 max)
+        {
+            return Vector4(MMVectorClamp(v.m_vector, min.m_vector, max.m_vector));
+        }
+
+        /** Writes MMVector4Min(v[i], u[i]) to out[i] for count elements
+        * out may alias v or u
+        */
+        inline void _MM_CALLCONV MMVector4MinStream(Vector4* out, const Vector4* v, const Vector4* u, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4MinStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorMin(v[i].m_vector, u[i].m_vector);
+        }
+
+        /** Writes MMVector4Max(v[i], u[i]) to out[i] for count elements
+        * out may alias v or u
+        */
+        inline void _MM_CALLCONV MMVector4MaxStream(Vector4* out, const Vector4* v, const Vector4* u, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4MaxStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorMax(v[i].m_vector, u[i].m_vector);
+        }
+
+        //Writes MMVector4Abs(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector4AbsStream(Vector4* out, const Vector4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4AbsStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorAbs(in[i].m_vector);
+        }
+
+        //Writes MMVector4Floor(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector4FloorStream(Vector4* out, const Vector4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4FloorStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorFloor(in[i].m_vector);
+        }
+
+        //Writes MMVector4Ceil(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector4CeilStream(Vector4* out, const Vector4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4CeilStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorCeil(in[i].m_vector);
+        }
+
+        //Writes MMVector4Round(in[i]) to out[i] for count elements, out may alias in
+        inline void _MM_CALLCONV MMVector4RoundStream(Vector4* out, const Vector4* in, size_t count)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4RoundStream");
+
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorRound(in[i].m_vector);
+        }
+
+        //Clamps count elements of in between the same bounds, out may alias in
+        inline void _MM_CALLCONV MMVector4ClampStream(Vector4* out, const Vector4* in, size_t count, FVector4 min, FVector4 max)
+        {
+            HT_MATH_DENORMAL_SAMPLE("MMVector4ClampStream");
+
+            const MMFloat4 lo = min.m_vector;
+            const MMFloat4 hi = max.m_vector;
+            for (size_t i = 0; i < count; i++)
+                out[i].m_vector = MMVectorClamp(in[i].m_vector, lo, hi);
+        }
     }
 }
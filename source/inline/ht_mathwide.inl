@@ -0,0 +1,1290 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <cassert>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        /////////////////////////////////////////////////////////
+        // MM Wide Register Primitives
+        /////////////////////////////////////////////////////////
+
+#ifdef HT_MATH_AVX
+
+        inline MMFloatW _MM_CALLCONV MMWideZero()
+        {
+            return _mm256_setzero_ps();
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSplat(float s)
+        {
+            return _mm256_set1_ps(s);
+        }
+
+        //p must be aligned to wideAlignment
+        inline MMFloatW _MM_CALLCONV MMWideLoad(const float* p)
+        {
+            return _mm256_load_ps(p);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideLoadUnaligned(const float* p)
+        {
+            return _mm256_loadu_ps(p);
+        }
+
+        //p must be aligned to wideAlignment
+        inline void _MM_CALLCONV MMWideStore(float* p, MMFloatW v)
+        {
+            _mm256_store_ps(p, v);
+        }
+
+        inline void _MM_CALLCONV MMWideStoreUnaligned(float* p, MMFloatW v)
+        {
+            _mm256_storeu_ps(p, v);
+        }
+
+        /** Transposes wideLaneCount rows into component registers
+        * \param rows wideLaneCount (x, y, z, w) rows, lane i of every output comes from rows[i]
+        */
+        inline void _MM_CALLCONV MMWideFromRows(const MMFloat4* rows, MMFloatW& x, MMFloatW& y, MMFloatW& z, MMFloatW& w)
+        {
+            //pair row i with row i + 4 so each 128 bit half holds an independent 4x4 block
+            __m256 r04 = _mm256_insertf128_ps(_mm256_castps128_ps256(rows[0]), rows[4], 1);
+            __m256 r15 = _mm256_insertf128_ps(_mm256_castps128_ps256(rows[1]), rows[5], 1);
+            __m256 r26 = _mm256_insertf128_ps(_mm256_castps128_ps256(rows[2]), rows[6], 1);
+            __m256 r37 = _mm256_insertf128_ps(_mm256_castps128_ps256(rows[3]), rows[7], 1);
+
+            __m256 xy01 = _mm256_unpacklo_ps(r04, r15);
+            __m256 xy23 = _mm256_unpacklo_ps(r26, r37);
+            __m256 zw01 = _mm256_unpackhi_ps(r04, r15);
+            __m256 zw23 = _mm256_unpackhi_ps(r26, r37);
+
+            x = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+            y = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+            z = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+            w = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        /** Transposes component registers back into wideLaneCount rows
+        * \param rows Receives wideLaneCount (x, y, z, w) rows, rows[i] comes from lane i
+        */
+        inline void _MM_CALLCONV MMWideToRows(MMFloat4* rows, MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w)
+        {
+            __m256 xy01 = _mm256_unpacklo_ps(x, y);
+            __m256 zw01 = _mm256_unpacklo_ps(z, w);
+            __m256 xy23 = _mm256_unpackhi_ps(x, y);
+            __m256 zw23 = _mm256_unpackhi_ps(z, w);
+
+            __m256 r04 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 r15 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2));
+            __m256 r26 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+            __m256 r37 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+
+            rows[0] = _mm256_castps256_ps128(r04);
+            rows[1] = _mm256_castps256_ps128(r15);
+            rows[2] = _mm256_castps256_ps128(r26);
+            rows[3] = _mm256_castps256_ps128(r37);
+            rows[4] = _mm256_extractf128_ps(r04, 1);
+            rows[5] = _mm256_extractf128_ps(r15, 1);
+            rows[6] = _mm256_extractf128_ps(r26, 1);
+            rows[7] = _mm256_extractf128_ps(r37, 1);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideAdd(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_add_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSub(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_sub_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideMul(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_mul_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_div_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideMin(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_min_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideMax(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_max_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v)
+        {
+            return _mm256_sqrt_ps(v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideReciprocalEst(MMFloatW v)
+        {
+            return _mm256_rcp_ps(v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideReciprocalSqrtEst(MMFloatW v)
+        {
+            return _mm256_rsqrt_ps(v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideAnd(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_and_ps(v, u);
+        }
+
+        //~v & u
+        inline MMFloatW _MM_CALLCONV MMWideAndNot(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_andnot_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideOr(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_or_ps(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideXor(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_xor_ps(v, u);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareEqual(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_cmp_ps(v, u, _CMP_EQ_OQ);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareLess(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_cmp_ps(v, u, _CMP_LT_OQ);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareLessEqual(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_cmp_ps(v, u, _CMP_LE_OQ);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareGreater(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_cmp_ps(v, u, _CMP_GT_OQ);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareGreaterEqual(MMFloatW v, MMFloatW u)
+        {
+            return _mm256_cmp_ps(v, u, _CMP_GE_OQ);
+        }
+
+        //Takes v in the lanes where mask is set and u elsewhere
+        inline MMFloatW _MM_CALLCONV MMWideSelect(MMMaskW mask, MMFloatW v, MMFloatW u)
+        {
+            return _mm256_blendv_ps(u, v, mask);
+        }
+
+        inline int _MM_CALLCONV MMWideMaskToBits(MMMaskW m)
+        {
+            return _mm256_movemask_ps(m);
+        }
+
+#else
+
+        //Without AVX the wide register is a single MMFloat4, so everything forwards to the MM layer
+
+        inline MMFloatW _MM_CALLCONV MMWideZero()
+        {
+            return MMVectorZero();
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSplat(float s)
+        {
+            return MMVectorSplat(s);
+        }
+
+        //p must be aligned to wideAlignment
+        inline MMFloatW _MM_CALLCONV MMWideLoad(const float* p)
+        {
+            return MMVectorLoad(p);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideLoadUnaligned(const float* p)
+        {
+            return MMVectorLoadUnaligned(p);
+        }
+
+        //p must be aligned to wideAlignment
+        inline void _MM_CALLCONV MMWideStore(float* p, MMFloatW v)
+        {
+            MMVectorStore(p, v);
+        }
+
+        inline void _MM_CALLCONV MMWideStoreUnaligned(float* p, MMFloatW v)
+        {
+            MMVectorStoreUnaligned(p, v);
+        }
+
+        /** Transposes wideLaneCount rows into component registers
+        * \param rows wideLaneCount (x, y, z, w) rows, lane i of every output comes from rows[i]
+        */
+        inline void _MM_CALLCONV MMWideFromRows(const MMFloat4* rows, MMFloatW& x, MMFloatW& y, MMFloatW& z, MMFloatW& w)
+        {
+            x = rows[0];
+            y = rows[1];
+            z = rows[2];
+            w = rows[3];
+            MMVectorTranspose4(x, y, z, w);
+        }
+
+        /** Transposes component registers back into wideLaneCount rows
+        * \param rows Receives wideLaneCount (x, y, z, w) rows, rows[i] comes from lane i
+        */
+        inline void _MM_CALLCONV MMWideToRows(MMFloat4* rows, MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w)
+        {
+            MMVectorTranspose4(x, y, z, w);
+            rows[0] = x;
+            rows[1] = y;
+            rows[2] = z;
+            rows[3] = w;
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideAdd(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorAdd(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSub(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorSub(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideMul(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorMul(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorDiv(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideMin(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorMin(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideMax(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorMax(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v)
+        {
+            return MMVectorSqrt(v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideReciprocalEst(MMFloatW v)
+        {
+            return MMVectorReciprocalEst(v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideReciprocalSqrtEst(MMFloatW v)
+        {
+            return MMVectorReciprocalSqrtEst(v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideAnd(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorAnd(v, u);
+        }
+
+        //~v & u
+        inline MMFloatW _MM_CALLCONV MMWideAndNot(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorAndNot(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideOr(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorOr(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideXor(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorXor(v, u);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareEqual(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorCompareEqual(v, u);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareLess(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorCompareLess(v, u);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareLessEqual(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorCompareLessEqual(v, u);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareGreater(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorCompareGreater(v, u);
+        }
+
+        inline MMMaskW _MM_CALLCONV MMWideCompareGreaterEqual(MMFloatW v, MMFloatW u)
+        {
+            return MMVectorCompareGreaterEqual(v, u);
+        }
+
+        //Takes v in the lanes where mask is set and u elsewhere
+        inline MMFloatW _MM_CALLCONV MMWideSelect(MMMaskW mask, MMFloatW v, MMFloatW u)
+        {
+            return MMVectorSelect(mask, v, u);
+        }
+
+        inline int _MM_CALLCONV MMWideMaskToBits(MMMaskW m)
+        {
+            return MMMaskToBits(m);
+        }
+
+#endif
+
+        inline float _MM_CALLCONV MMWideGetLane(MMFloatW v, size_t lane)
+        {
+            assert(lane < wideLaneCount);
+            float lanes[wideLaneCount];
+            MMWideStoreUnaligned(lanes, v);
+            return lanes[lane];
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSetLane(MMFloatW v, size_t lane, float s)
+        {
+            assert(lane < wideLaneCount);
+            float lanes[wideLaneCount];
+            MMWideStoreUnaligned(lanes, v);
+            lanes[lane] = s;
+            return MMWideLoadUnaligned(lanes);
+        }
+
+        inline bool _MM_CALLCONV MMWideMaskAllTrue(MMMaskW m)
+        {
+            return MMWideMaskToBits(m) == (1 << wideLaneCount) - 1;
+        }
+
+        inline bool _MM_CALLCONV MMWideMaskAnyTrue(MMMaskW m)
+        {
+            return MMWideMaskToBits(m) != 0;
+        }
+
+        //1 / v, correctly rounded
+        inline MMFloatW _MM_CALLCONV MMWideReciprocal(MMFloatW v, MMPrecisionExact)
+        {
+            return MMWideDiv(MMWideSplat(1.0f), v);
+        }
+
+        //1 / v from the estimate refined with one Newton-Raphson step, same bounds as MMVectorReciprocal
+        inline MMFloatW _MM_CALLCONV MMWideReciprocal(MMFloatW v, MMPrecisionFast)
+        {
+            MMFloatW est = MMWideReciprocalEst(v);
+            return MMWideMul(est, MMWideSub(MMWideSplat(2.0f), MMWideMul(v, est)));
+        }
+
+        //1 / sqrt(v), correctly rounded sqrt followed by a correctly rounded division
+        inline MMFloatW _MM_CALLCONV MMWideReciprocalSqrt(MMFloatW v, MMPrecisionExact)
+        {
+            return MMWideDiv(MMWideSplat(1.0f), MMWideSqrt(v));
+        }
+
+        //1 / sqrt(v) from the estimate refined with one Newton-Raphson step, same bounds as MMVectorReciprocalSqrt
+        inline MMFloatW _MM_CALLCONV MMWideReciprocalSqrt(MMFloatW v, MMPrecisionFast)
+        {
+            MMFloatW est = MMWideReciprocalSqrtEst(v);
+            MMFloatW estSq = MMWideMul(est, est);
+            MMFloatW halfEst = MMWideMul(MMWideSplat(0.5f), est);
+            return MMWideMul(halfEst, MMWideSub(MMWideSplat(3.0f), MMWideMul(v, estSq)));
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u, MMPrecisionExact)
+        {
+            return MMWideDiv(v, u);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideDiv(MMFloatW v, MMFloatW u, MMPrecisionFast)
+        {
+            return MMWideMul(v, MMWideReciprocal(u, MMPrecisionFast()));
+        }
+
+        inline MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v, MMPrecisionExact)
+        {
+            return MMWideSqrt(v);
+        }
+
+        //v * (1 / sqrt(v)) with the fast reciprocal sqrt, zero lanes stay zero
+        inline MMFloatW _MM_CALLCONV MMWideSqrt(MMFloatW v, MMPrecisionFast)
+        {
+            MMFloatW root = MMWideMul(v, MMWideReciprocalSqrt(v, MMPrecisionFast()));
+            return MMWideSelect(MMWideCompareEqual(v, MMWideZero()), v, root);
+        }
+
+        namespace Internal
+        {
+            //1 / sqrt(lengthSq), the shared scale of every wide Normalize
+            inline MMFloatW _MM_CALLCONV MMWideInvSqrt(MMFloatW lengthSq, MMPrecisionExact)
+            {
+                return MMWideDiv(MMWideSplat(1.0f), MMWideSqrt(lengthSq));
+            }
+
+            inline MMFloatW _MM_CALLCONV MMWideInvSqrt(MMFloatW lengthSq, MMPrecisionFast)
+            {
+                return MMWideReciprocalSqrt(lengthSq, MMPrecisionFast());
+            }
+
+            //a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w for a matrix row splatted across the lanes
+            inline MMFloatW _MM_CALLCONV MMWideDotSplat(float x, float y, float z, float w, MMFloatW vx, MMFloatW vy, MMFloatW vz, MMFloatW vw)
+            {
+                MMFloatW result = MMWideMul(MMWideSplat(x), vx);
+                result = MMWideAdd(result, MMWideMul(MMWideSplat(y), vy));
+                result = MMWideAdd(result, MMWideMul(MMWideSplat(z), vz));
+                return MMWideAdd(result, MMWideMul(MMWideSplat(w), vw));
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // Vector3Wide
+        /////////////////////////////////////////////////////////
+
+        //Creates wideLaneCount zero vectors
+        inline Vector3Wide::Vector3Wide() : x(MMWideZero()), y(MMWideZero()), z(MMWideZero()) {}
+
+        //Creates the vectors from component registers
+        inline Vector3Wide::Vector3Wide(MMFloatW x, MMFloatW y, MMFloatW z) : x(x), y(y), z(z) {}
+
+        //Broadcasts v to every lane
+        inline Vector3Wide::Vector3Wide(const Vector3& v) : x(MMWideSplat(v.x)), y(MMWideSplat(v.y)), z(MMWideSplat(v.z)) {}
+
+        inline void* Vector3Wide::operator new(size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void Vector3Wide::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* Vector3Wide::operator new[](size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void Vector3Wide::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline Vector3Wide Vector3Wide::operator-() const
+        {
+            MMFloatW sign = MMWideSplat(-0.0f);
+            return Vector3Wide(MMWideXor(x, sign), MMWideXor(y, sign), MMWideXor(z, sign));
+        }
+
+        inline Vector3Wide Vector3Wide::operator+(const Vector3Wide& u) const
+        {
+            return Vector3Wide(MMWideAdd(x, u.x), MMWideAdd(y, u.y), MMWideAdd(z, u.z));
+        }
+
+        inline Vector3Wide Vector3Wide::operator-(const Vector3Wide& u) const
+        {
+            return Vector3Wide(MMWideSub(x, u.x), MMWideSub(y, u.y), MMWideSub(z, u.z));
+        }
+
+        inline Vector3Wide Vector3Wide::operator*(const Vector3Wide& u) const
+        {
+            return Vector3Wide(MMWideMul(x, u.x), MMWideMul(y, u.y), MMWideMul(z, u.z));
+        }
+
+        inline Vector3Wide Vector3Wide::operator/(const Vector3Wide& u) const
+        {
+            return Vector3Wide(MMWideDiv(x, u.x, MMPrecisionDefault()),
+                               MMWideDiv(y, u.y, MMPrecisionDefault()),
+                               MMWideDiv(z, u.z, MMPrecisionDefault()));
+        }
+
+        //Scales every vector by the scalar in its lane
+        inline Vector3Wide Vector3Wide::operator*(MMFloatW s) const
+        {
+            return Vector3Wide(MMWideMul(x, s), MMWideMul(y, s), MMWideMul(z, s));
+        }
+
+        //Divides every vector by the scalar in its lane
+        inline Vector3Wide Vector3Wide::operator/(MMFloatW s) const
+        {
+            MMFloatW inv = MMWideReciprocal(s, MMPrecisionDefault());
+            return Vector3Wide(MMWideMul(x, inv), MMWideMul(y, inv), MMWideMul(z, inv));
+        }
+
+        inline Vector3Wide Vector3Wide::operator*(float s) const
+        {
+            return *this * MMWideSplat(s);
+        }
+
+        inline Vector3Wide& Vector3Wide::operator+=(const Vector3Wide& u)
+        {
+            return *this = *this + u;
+        }
+
+        inline Vector3Wide& Vector3Wide::operator-=(const Vector3Wide& u)
+        {
+            return *this = *this - u;
+        }
+
+        inline Vector3Wide& Vector3Wide::operator*=(const Vector3Wide& u)
+        {
+            return *this = *this * u;
+        }
+
+        inline Vector3Wide& Vector3Wide::operator*=(MMFloatW s)
+        {
+            return *this = *this * s;
+        }
+
+        //Extracts the vector held in one lane
+        inline Vector3 Vector3Wide::Get(size_t lane) const
+        {
+            return Vector3(MMWideGetLane(x, lane), MMWideGetLane(y, lane), MMWideGetLane(z, lane));
+        }
+
+        //Replaces the vector held in one lane
+        inline void Vector3Wide::Set(size_t lane, const Vector3& v)
+        {
+            x = MMWideSetLane(x, lane, v.x);
+            y = MMWideSetLane(y, lane, v.y);
+            z = MMWideSetLane(z, lane, v.z);
+        }
+
+        /////////////////////////////////////////////////////////
+        // Vector4Wide
+        /////////////////////////////////////////////////////////
+
+        //Creates wideLaneCount zero vectors
+        inline Vector4Wide::Vector4Wide() : x(MMWideZero()), y(MMWideZero()), z(MMWideZero()), w(MMWideZero()) {}
+
+        //Creates the vectors from component registers
+        inline Vector4Wide::Vector4Wide(MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w) : x(x), y(y), z(z), w(w) {}
+
+        //Extends wide Vector3s with a w register
+        inline Vector4Wide::Vector4Wide(const Vector3Wide& xyz, MMFloatW w) : x(xyz.x), y(xyz.y), z(xyz.z), w(w) {}
+
+        //Broadcasts v to every lane
+        inline Vector4Wide::Vector4Wide(const Vector4& v)
+            : x(MMWideSplat(v.x)), y(MMWideSplat(v.y)), z(MMWideSplat(v.z)), w(MMWideSplat(v.w)) {}
+
+        inline void* Vector4Wide::operator new(size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void Vector4Wide::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* Vector4Wide::operator new[](size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void Vector4Wide::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline Vector4Wide Vector4Wide::operator-() const
+        {
+            MMFloatW sign = MMWideSplat(-0.0f);
+            return Vector4Wide(MMWideXor(x, sign), MMWideXor(y, sign), MMWideXor(z, sign), MMWideXor(w, sign));
+        }
+
+        inline Vector4Wide Vector4Wide::operator+(const Vector4Wide& u) const
+        {
+            return Vector4Wide(MMWideAdd(x, u.x), MMWideAdd(y, u.y), MMWideAdd(z, u.z), MMWideAdd(w, u.w));
+        }
+
+        inline Vector4Wide Vector4Wide::operator-(const Vector4Wide& u) const
+        {
+            return Vector4Wide(MMWideSub(x, u.x), MMWideSub(y, u.y), MMWideSub(z, u.z), MMWideSub(w, u.w));
+        }
+
+        inline Vector4Wide Vector4Wide::operator*(const Vector4Wide& u) const
+        {
+            return Vector4Wide(MMWideMul(x, u.x), MMWideMul(y, u.y), MMWideMul(z, u.z), MMWideMul(w, u.w));
+        }
+
+        inline Vector4Wide Vector4Wide::operator/(const Vector4Wide& u) const
+        {
+            return Vector4Wide(MMWideDiv(x, u.x, MMPrecisionDefault()),
+                               MMWideDiv(y, u.y, MMPrecisionDefault()),
+                               MMWideDiv(z, u.z, MMPrecisionDefault()),
+                               MMWideDiv(w, u.w, MMPrecisionDefault()));
+        }
+
+        //Scales every vector by the scalar in its lane
+        inline Vector4Wide Vector4Wide::operator*(MMFloatW s) const
+        {
+            return Vector4Wide(MMWideMul(x, s), MMWideMul(y, s), MMWideMul(z, s), MMWideMul(w, s));
+        }
+
+        //Divides every vector by the scalar in its lane
+        inline Vector4Wide Vector4Wide::operator/(MMFloatW s) const
+        {
+            MMFloatW inv = MMWideReciprocal(s, MMPrecisionDefault());
+            return Vector4Wide(MMWideMul(x, inv), MMWideMul(y, inv), MMWideMul(z, inv), MMWideMul(w, inv));
+        }
+
+        inline Vector4Wide Vector4Wide::operator*(float s) const
+        {
+            return *this * MMWideSplat(s);
+        }
+
+        inline Vector4Wide& Vector4Wide::operator+=(const Vector4Wide& u)
+        {
+            return *this = *this + u;
+        }
+
+        inline Vector4Wide& Vector4Wide::operator-=(const Vector4Wide& u)
+        {
+            return *this = *this - u;
+        }
+
+        inline Vector4Wide& Vector4Wide::operator*=(const Vector4Wide& u)
+        {
+            return *this = *this * u;
+        }
+
+        inline Vector4Wide& Vector4Wide::operator*=(MMFloatW s)
+        {
+            return *this = *this * s;
+        }
+
+        //Drops the w register
+        inline Vector4Wide::operator Vector3Wide() const
+        {
+            return Vector3Wide(x, y, z);
+        }
+
+        //Extracts the vector held in one lane
+        inline Vector4 Vector4Wide::Get(size_t lane) const
+        {
+            return Vector4(MMWideGetLane(x, lane), MMWideGetLane(y, lane), MMWideGetLane(z, lane), MMWideGetLane(w, lane));
+        }
+
+        //Replaces the vector held in one lane
+        inline void Vector4Wide::Set(size_t lane, const Vector4& v)
+        {
+            x = MMWideSetLane(x, lane, v.x);
+            y = MMWideSetLane(y, lane, v.y);
+            z = MMWideSetLane(z, lane, v.z);
+            w = MMWideSetLane(w, lane, v.w);
+        }
+
+        /////////////////////////////////////////////////////////
+        // QuaternionWide
+        /////////////////////////////////////////////////////////
+
+        //Creates wideLaneCount identity quaternions
+        inline QuaternionWide::QuaternionWide() : x(MMWideZero()), y(MMWideZero()), z(MMWideZero()), w(MMWideSplat(1.0f)) {}
+
+        //Creates the quaternions from component registers
+        inline QuaternionWide::QuaternionWide(MMFloatW x, MMFloatW y, MMFloatW z, MMFloatW w) : x(x), y(y), z(z), w(w) {}
+
+        //Broadcasts q to every lane
+        inline QuaternionWide::QuaternionWide(const Quaternion& q)
+            : x(MMWideSplat(q.x)), y(MMWideSplat(q.y)), z(MMWideSplat(q.z)), w(MMWideSplat(q.w)) {}
+
+        inline void* QuaternionWide::operator new(size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void QuaternionWide::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* QuaternionWide::operator new[](size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void QuaternionWide::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline QuaternionWide QuaternionWide::operator+(const QuaternionWide& p_rhs) const
+        {
+            return QuaternionWide(MMWideAdd(x, p_rhs.x), MMWideAdd(y, p_rhs.y), MMWideAdd(z, p_rhs.z), MMWideAdd(w, p_rhs.w));
+        }
+
+        inline QuaternionWide QuaternionWide::operator-(const QuaternionWide& p_rhs) const
+        {
+            return QuaternionWide(MMWideSub(x, p_rhs.x), MMWideSub(y, p_rhs.y), MMWideSub(z, p_rhs.z), MMWideSub(w, p_rhs.w));
+        }
+
+        /** Hamilton product of every lane pair, matches Quaternion::operator*
+        * \param p_rhs The other quaternions
+        * \return The products
+        */
+        inline QuaternionWide QuaternionWide::operator*(const QuaternionWide& p_rhs) const
+        {
+            //x = ax * bw + ay * bz - az * by + aw * bx
+            MMFloatW rx = MMWideMul(x, p_rhs.w);
+            rx = MMWideAdd(rx, MMWideMul(y, p_rhs.z));
+            rx = MMWideSub(rx, MMWideMul(z, p_rhs.y));
+            rx = MMWideAdd(rx, MMWideMul(w, p_rhs.x));
+
+            //y = -ax * bz + ay * bw + az * bx + aw * by
+            MMFloatW ry = MMWideMul(y, p_rhs.w);
+            ry = MMWideSub(ry, MMWideMul(x, p_rhs.z));
+            ry = MMWideAdd(ry, MMWideMul(z, p_rhs.x));
+            ry = MMWideAdd(ry, MMWideMul(w, p_rhs.y));
+
+            //z = ax * by - ay * bx + az * bw + aw * bz
+            MMFloatW rz = MMWideMul(x, p_rhs.y);
+            rz = MMWideSub(rz, MMWideMul(y, p_rhs.x));
+            rz = MMWideAdd(rz, MMWideMul(z, p_rhs.w));
+            rz = MMWideAdd(rz, MMWideMul(w, p_rhs.z));
+
+            //w = aw * bw - ax * bx - ay * by - az * bz
+            MMFloatW rw = MMWideMul(w, p_rhs.w);
+            rw = MMWideSub(rw, MMWideMul(x, p_rhs.x));
+            rw = MMWideSub(rw, MMWideMul(y, p_rhs.y));
+            rw = MMWideSub(rw, MMWideMul(z, p_rhs.z));
+
+            return QuaternionWide(rx, ry, rz, rw);
+        }
+
+        inline QuaternionWide& QuaternionWide::operator+=(const QuaternionWide& p_rhs)
+        {
+            return *this = *this + p_rhs;
+        }
+
+        inline QuaternionWide& QuaternionWide::operator-=(const QuaternionWide& p_rhs)
+        {
+            return *this = *this - p_rhs;
+        }
+
+        inline QuaternionWide& QuaternionWide::operator*=(const QuaternionWide& p_rhs)
+        {
+            return *this = *this * p_rhs;
+        }
+
+        //Extracts the quaternion held in one lane
+        inline Quaternion QuaternionWide::Get(size_t lane) const
+        {
+            return Quaternion(MMWideGetLane(x, lane), MMWideGetLane(y, lane), MMWideGetLane(z, lane), MMWideGetLane(w, lane));
+        }
+
+        //Replaces the quaternion held in one lane
+        inline void QuaternionWide::Set(size_t lane, const Quaternion& q)
+        {
+            x = MMWideSetLane(x, lane, q.x);
+            y = MMWideSetLane(y, lane, q.y);
+            z = MMWideSetLane(z, lane, q.z);
+            w = MMWideSetLane(w, lane, q.w);
+        }
+
+        /////////////////////////////////////////////////////////
+        // Matrix4Wide
+        /////////////////////////////////////////////////////////
+
+        //Creates wideLaneCount identity matrices
+        inline Matrix4Wide::Matrix4Wide()
+        {
+            MMFloatW zero = MMWideZero();
+            MMFloatW one = MMWideSplat(1.0f);
+            m_rows[0] = Vector4Wide(one, zero, zero, zero);
+            m_rows[1] = Vector4Wide(zero, one, zero, zero);
+            m_rows[2] = Vector4Wide(zero, zero, one, zero);
+            m_rows[3] = Vector4Wide(zero, zero, zero, one);
+        }
+
+        //Creates the matrices from four wide rows
+        inline Matrix4Wide::Matrix4Wide(const Vector4Wide& a, const Vector4Wide& b, const Vector4Wide& c, const Vector4Wide& d)
+        {
+            m_rows[0] = a;
+            m_rows[1] = b;
+            m_rows[2] = c;
+            m_rows[3] = d;
+        }
+
+        //Broadcasts m to every lane
+        inline Matrix4Wide::Matrix4Wide(const Matrix4& m)
+        {
+            m_rows[0] = Vector4Wide(Vector4(m.m_rows[0]));
+            m_rows[1] = Vector4Wide(Vector4(m.m_rows[1]));
+            m_rows[2] = Vector4Wide(Vector4(m.m_rows[2]));
+            m_rows[3] = Vector4Wide(Vector4(m.m_rows[3]));
+        }
+
+        inline void* Matrix4Wide::operator new(size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void Matrix4Wide::operator delete(void* p)
+        {
+            aligned_free(p);
+        }
+
+        inline void* Matrix4Wide::operator new[](size_t size)
+        {
+            return aligned_malloc(size, wideAlignment);
+        }
+
+        inline void Matrix4Wide::operator delete[](void* p)
+        {
+            aligned_free(p);
+        }
+
+        /** Multiplies every lane pair, matches Matrix4::operator*
+        * \param mat The right hand matrices
+        * \return The products
+        */
+        inline Matrix4Wide Matrix4Wide::operator*(const Matrix4Wide& mat) const
+        {
+            Matrix4Wide result;
+            for (int i = 0; i < 4; i++)
+            {
+                //row i of the product is the rows of mat weighted by row i of this matrix
+                const Vector4Wide& row = m_rows[i];
+                result.m_rows[i] = mat.m_rows[0] * row.x + mat.m_rows[1] * row.y
+                                 + mat.m_rows[2] * row.z + mat.m_rows[3] * row.w;
+            }
+            return result;
+        }
+
+        /** Transforms every lane's vector by the same lane's matrix
+        * \param vec The column vectors to transform
+        * \return The transformed vectors
+        */
+        inline Vector4Wide Matrix4Wide::operator*(const Vector4Wide& vec) const
+        {
+            return Vector4Wide(MMVector4WideDot(m_rows[0], vec), MMVector4WideDot(m_rows[1], vec),
+                               MMVector4WideDot(m_rows[2], vec), MMVector4WideDot(m_rows[3], vec));
+        }
+
+        //Extracts the matrix held in one lane
+        inline Matrix4 Matrix4Wide::Get(size_t lane) const
+        {
+            return Matrix4(m_rows[0].Get(lane), m_rows[1].Get(lane), m_rows[2].Get(lane), m_rows[3].Get(lane));
+        }
+
+        //Replaces the matrix held in one lane
+        inline void Matrix4Wide::Set(size_t lane, const Matrix4& m)
+        {
+            for (int i = 0; i < 4; i++)
+                m_rows[i].Set(lane, Vector4(m.m_rows[i]));
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM Vector3Wide Operations
+        /////////////////////////////////////////////////////////
+
+        //Dot product of every lane pair
+        inline MMFloatW _MM_CALLCONV MMVector3WideDot(const Vector3Wide& v, const Vector3Wide& u)
+        {
+            MMFloatW result = MMWideMul(v.x, u.x);
+            result = MMWideAdd(result, MMWideMul(v.y, u.y));
+            return MMWideAdd(result, MMWideMul(v.z, u.z));
+        }
+
+        //Cross product of every lane pair
+        inline Vector3Wide _MM_CALLCONV MMVector3WideCross(const Vector3Wide& v, const Vector3Wide& u)
+        {
+            return Vector3Wide(MMWideSub(MMWideMul(v.y, u.z), MMWideMul(v.z, u.y)),
+                               MMWideSub(MMWideMul(v.z, u.x), MMWideMul(v.x, u.z)),
+                               MMWideSub(MMWideMul(v.x, u.y), MMWideMul(v.y, u.x)));
+        }
+
+        inline MMFloatW _MM_CALLCONV MMVector3WideMagnitudeSqr(const Vector3Wide& v)
+        {
+            return MMVector3WideDot(v, v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMVector3WideMagnitude(const Vector3Wide& v)
+        {
+            return MMWideSqrt(MMVector3WideDot(v, v), MMPrecisionDefault());
+        }
+
+        /** Normalizes every lane
+        * NOTE: zero length lanes produce NaN, the same as MMVector3Normalized
+        */
+        template <typename Precision>
+        inline Vector3Wide _MM_CALLCONV MMVector3WideNormalized(const Vector3Wide& v, Precision)
+        {
+            return v * Internal::MMWideInvSqrt(MMVector3WideDot(v, v), Precision());
+        }
+
+        inline Vector3Wide _MM_CALLCONV MMVector3WideNormalized(const Vector3Wide& v)
+        {
+            return MMVector3WideNormalized(v, MMPrecisionDefault());
+        }
+
+        //Takes the vectors of v in the lanes where mask is set and those of u elsewhere
+        inline Vector3Wide _MM_CALLCONV MMVector3WideSelect(MMMaskW mask, const Vector3Wide& v, const Vector3Wide& u)
+        {
+            return Vector3Wide(MMWideSelect(mask, v.x, u.x), MMWideSelect(mask, v.y, u.y), MMWideSelect(mask, v.z, u.z));
+        }
+
+        /** Loads wideLaneCount vectors from SoA streams
+        * \param x, y, z Component streams, each read for wideLaneCount floats
+        */
+        inline Vector3Wide _MM_CALLCONV MMVector3WideLoad(const float* x, const float* y, const float* z)
+        {
+            return Vector3Wide(MMWideLoadUnaligned(x), MMWideLoadUnaligned(y), MMWideLoadUnaligned(z));
+        }
+
+        /** Stores wideLaneCount vectors to SoA streams
+        * \param x, y, z Component streams, each written for wideLaneCount floats
+        */
+        inline void _MM_CALLCONV MMVector3WideStore(float* x, float* y, float* z, const Vector3Wide& v)
+        {
+            MMWideStoreUnaligned(x, v.x);
+            MMWideStoreUnaligned(y, v.y);
+            MMWideStoreUnaligned(z, v.z);
+        }
+
+        //Gathers wideLaneCount consecutive Vector3s into one wide vector
+        inline Vector3Wide _MM_CALLCONV MMVector3WideLoadAoS(const Vector3* src)
+        {
+            MMFloat4 rows[wideLaneCount];
+            for (size_t i = 0; i < wideLaneCount; i++)
+                rows[i] = src[i].m_vector;
+
+            Vector3Wide result;
+            MMFloatW w;
+            MMWideFromRows(rows, result.x, result.y, result.z, w);
+            return result;
+        }
+
+        //Scatters a wide vector into wideLaneCount consecutive Vector3s, w lanes are zeroed
+        inline void _MM_CALLCONV MMVector3WideStoreAoS(Vector3* dst, const Vector3Wide& v)
+        {
+            MMFloat4 rows[wideLaneCount];
+            MMWideToRows(rows, v.x, v.y, v.z, MMWideZero());
+            for (size_t i = 0; i < wideLaneCount; i++)
+                dst[i].m_vector = rows[i];
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM Vector4Wide Operations
+        /////////////////////////////////////////////////////////
+
+        //Dot product of every lane pair
+        inline MMFloatW _MM_CALLCONV MMVector4WideDot(const Vector4Wide& v, const Vector4Wide& u)
+        {
+            MMFloatW result = MMWideMul(v.x, u.x);
+            result = MMWideAdd(result, MMWideMul(v.y, u.y));
+            result = MMWideAdd(result, MMWideMul(v.z, u.z));
+            return MMWideAdd(result, MMWideMul(v.w, u.w));
+        }
+
+        inline MMFloatW _MM_CALLCONV MMVector4WideMagnitudeSqr(const Vector4Wide& v)
+        {
+            return MMVector4WideDot(v, v);
+        }
+
+        inline MMFloatW _MM_CALLCONV MMVector4WideMagnitude(const Vector4Wide& v)
+        {
+            return MMWideSqrt(MMVector4WideDot(v, v), MMPrecisionDefault());
+        }
+
+        /** Normalizes every lane
+        * NOTE: zero length lanes produce NaN, the same as MMVector4Normalize
+        */
+        template <typename Precision>
+        inline Vector4Wide _MM_CALLCONV MMVector4WideNormalize(const Vector4Wide& v, Precision)
+        {
+            return v * Internal::MMWideInvSqrt(MMVector4WideDot(v, v), Precision());
+        }
+
+        inline Vector4Wide _MM_CALLCONV MMVector4WideNormalize(const Vector4Wide& v)
+        {
+            return MMVector4WideNormalize(v, MMPrecisionDefault());
+        }
+
+        //Takes the vectors of v in the lanes where mask is set and those of u elsewhere
+        inline Vector4Wide _MM_CALLCONV MMVector4WideSelect(MMMaskW mask, const Vector4Wide& v, const Vector4Wide& u)
+        {
+            return Vector4Wide(MMWideSelect(mask, v.x, u.x), MMWideSelect(mask, v.y, u.y),
+                               MMWideSelect(mask, v.z, u.z), MMWideSelect(mask, v.w, u.w));
+        }
+
+        /** Loads wideLaneCount vectors from SoA streams
+        * \param x, y, z, w Component streams, each read for wideLaneCount floats
+        */
+        inline Vector4Wide _MM_CALLCONV MMVector4WideLoad(const float* x, const float* y, const float* z, const float* w)
+        {
+            return Vector4Wide(MMWideLoadUnaligned(x), MMWideLoadUnaligned(y), MMWideLoadUnaligned(z), MMWideLoadUnaligned(w));
+        }
+
+        /** Stores wideLaneCount vectors to SoA streams
+        * \param x, y, z, w Component streams, each written for wideLaneCount floats
+        */
+        inline void _MM_CALLCONV MMVector4WideStore(float* x, float* y, float* z, float* w, const Vector4Wide& v)
+        {
+            MMWideStoreUnaligned(x, v.x);
+            MMWideStoreUnaligned(y, v.y);
+            MMWideStoreUnaligned(z, v.z);
+            MMWideStoreUnaligned(w, v.w);
+        }
+
+        //Gathers wideLaneCount consecutive Vector4s into one wide vector
+        inline Vector4Wide _MM_CALLCONV MMVector4WideLoadAoS(const Vector4* src)
+        {
+            MMFloat4 rows[wideLaneCount];
+            for (size_t i = 0; i < wideLaneCount; i++)
+                rows[i] = src[i].m_vector;
+
+            Vector4Wide result;
+            MMWideFromRows(rows, result.x, result.y, result.z, result.w);
+            return result;
+        }
+
+        //Scatters a wide vector into wideLaneCount consecutive Vector4s
+        inline void _MM_CALLCONV MMVector4WideStoreAoS(Vector4* dst, const Vector4Wide& v)
+        {
+            MMFloat4 rows[wideLaneCount];
+            MMWideToRows(rows, v.x, v.y, v.z, v.w);
+            for (size_t i = 0; i < wideLaneCount; i++)
+                dst[i].m_vector = rows[i];
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM QuaternionWide Operations
+        /////////////////////////////////////////////////////////
+
+        //Dot product of every lane pair
+        inline MMFloatW _MM_CALLCONV MMQuaternionWideDot(const QuaternionWide& q, const QuaternionWide& r)
+        {
+            MMFloatW result = MMWideMul(q.x, r.x);
+            result = MMWideAdd(result, MMWideMul(q.y, r.y));
+            result = MMWideAdd(result, MMWideMul(q.z, r.z));
+            return MMWideAdd(result, MMWideMul(q.w, r.w));
+        }
+
+        template <typename Precision>
+        inline QuaternionWide _MM_CALLCONV MMQuaternionWideNormalize(const QuaternionWide& q, Precision)
+        {
+            MMFloatW scale = Internal::MMWideInvSqrt(MMQuaternionWideDot(q, q), Precision());
+            return QuaternionWide(MMWideMul(q.x, scale), MMWideMul(q.y, scale), MMWideMul(q.z, scale), MMWideMul(q.w, scale));
+        }
+
+        inline QuaternionWide _MM_CALLCONV MMQuaternionWideNormalize(const QuaternionWide& q)
+        {
+            return MMQuaternionWideNormalize(q, MMPrecisionDefault());
+        }
+
+        inline QuaternionWide _MM_CALLCONV MMQuaternionWideConjugate(const QuaternionWide& q)
+        {
+            MMFloatW sign = MMWideSplat(-0.0f);
+            return QuaternionWide(MMWideXor(q.x, sign), MMWideXor(q.y, sign), MMWideXor(q.z, sign), q.w);
+        }
+
+        /** Rotates every lane's vector by the same lane's unit quaternion, q * v * q^-1
+        * \param q Unit quaternions
+        * \param v Vectors to rotate
+        * \return The rotated vectors
+        */
+        inline Vector3Wide _MM_CALLCONV MMQuaternionWideRotate(const QuaternionWide& q, const Vector3Wide& v)
+        {
+            //t = 2 * cross(q.xyz, v), v' = v + q.w * t + cross(q.xyz, t)
+            Vector3Wide axis(q.x, q.y, q.z);
+            Vector3Wide t = MMVector3WideCross(axis, v) * 2.0f;
+            return v + t * q.w + MMVector3WideCross(axis, t);
+        }
+
+        //Takes the quaternions of q in the lanes where mask is set and those of r elsewhere
+        inline QuaternionWide _MM_CALLCONV MMQuaternionWideSelect(MMMaskW mask, const QuaternionWide& q, const QuaternionWide& r)
+        {
+            return QuaternionWide(MMWideSelect(mask, q.x, r.x), MMWideSelect(mask, q.y, r.y),
+                                  MMWideSelect(mask, q.z, r.z), MMWideSelect(mask, q.w, r.w));
+        }
+
+        /** Loads wideLaneCount quaternions from SoA streams
+        * \param x, y, z, w Component streams, each read for wideLaneCount floats
+        */
+        inline QuaternionWide _MM_CALLCONV MMQuaternionWideLoad(const float* x, const float* y, const float* z, const float* w)
+        {
+            return QuaternionWide(MMWideLoadUnaligned(x), MMWideLoadUnaligned(y), MMWideLoadUnaligned(z), MMWideLoadUnaligned(w));
+        }
+
+        /** Stores wideLaneCount quaternions to SoA streams
+        * \param x, y, z, w Component streams, each written for wideLaneCount floats
+        */
+        inline void _MM_CALLCONV MMQuaternionWideStore(float* x, float* y, float* z, float* w, const QuaternionWide& q)
+        {
+            MMWideStoreUnaligned(x, q.x);
+            MMWideStoreUnaligned(y, q.y);
+            MMWideStoreUnaligned(z, q.z);
+            MMWideStoreUnaligned(w, q.w);
+        }
+
+        //Gathers wideLaneCount consecutive Quaternions into one wide quaternion
+        inline QuaternionWide _MM_CALLCONV MMQuaternionWideLoadAoS(const Quaternion* src)
+        {
+            MMFloat4 rows[wideLaneCount];
+            for (size_t i = 0; i < wideLaneCount; i++)
+                rows[i] = src[i].m_quaternion;
+
+            QuaternionWide result;
+            MMWideFromRows(rows, result.x, result.y, result.z, result.w);
+            return result;
+        }
+
+        //Scatters a wide quaternion into wideLaneCount consecutive Quaternions
+        inline void _MM_CALLCONV MMQuaternionWideStoreAoS(Quaternion* dst, const QuaternionWide& q)
+        {
+            MMFloat4 rows[wideLaneCount];
+            MMWideToRows(rows, q.x, q.y, q.z, q.w);
+            for (size_t i = 0; i < wideLaneCount; i++)
+                dst[i].m_quaternion = rows[i];
+        }
+
+        /////////////////////////////////////////////////////////
+        // MM Matrix4Wide Operations
+        /////////////////////////////////////////////////////////
+
+        /** Transforms wideLaneCount column vectors by one matrix
+        * \param m Matrix shared by every lane
+        * \param v Vectors to transform
+        * \return m * v for every lane
+        */
+        inline Vector4Wide _MM_CALLCONV MMMatrixTransformWide(FMatrix4 m, const Vector4Wide& v)
+        {
+            return Vector4Wide(Internal::MMWideDotSplat(m.xx, m.xy, m.xz, m.xw, v.x, v.y, v.z, v.w),
+                               Internal::MMWideDotSplat(m.yx, m.yy, m.yz, m.yw, v.x, v.y, v.z, v.w),
+                               Internal::MMWideDotSplat(m.zx, m.zy, m.zz, m.zw, v.x, v.y, v.z, v.w),
+                               Internal::MMWideDotSplat(m.wx, m.wy, m.wz, m.ww, v.x, v.y, v.z, v.w));
+        }
+
+        /** Transforms wideLaneCount points (w = 1) by one affine matrix
+        * The bottom row of m is ignored, no perspective divide is done.
+        */
+        inline Vector3Wide _MM_CALLCONV MMMatrixTransformPointWide(FMatrix4 m, const Vector3Wide& p)
+        {
+            MMFloatW one = MMWideSplat(1.0f);
+            return Vector3Wide(Internal::MMWideDotSplat(m.xx, m.xy, m.xz, m.xw, p.x, p.y, p.z, one),
+                               Internal::MMWideDotSplat(m.yx, m.yy, m.yz, m.yw, p.x, p.y, p.z, one),
+                               Internal::MMWideDotSplat(m.zx, m.zy, m.zz, m.zw, p.x, p.y, p.z, one));
+        }
+
+        //Transforms wideLaneCount directions (w = 0) by the upper 3x3 of one matrix
+        inline Vector3Wide _MM_CALLCONV MMMatrixTransformDirectionWide(FMatrix4 m, const Vector3Wide& d)
+        {
+            MMFloatW zero = MMWideZero();
+            return Vector3Wide(Internal::MMWideDotSplat(m.xx, m.xy, m.xz, 0.0f, d.x, d.y, d.z, zero),
+                               Internal::MMWideDotSplat(m.yx, m.yy, m.yz, 0.0f, d.x, d.y, d.z, zero),
+                               Internal::MMWideDotSplat(m.zx, m.zy, m.zz, 0.0f, d.x, d.y, d.z, zero));
+        }
+
+        inline Matrix4Wide _MM_CALLCONV MMMatrix4WideTranspose(const Matrix4Wide& m)
+        {
+            return Matrix4Wide(Vector4Wide(m.m_rows[0].x, m.m_rows[1].x, m.m_rows[2].x, m.m_rows[3].x),
+                               Vector4Wide(m.m_rows[0].y, m.m_rows[1].y, m.m_rows[2].y, m.m_rows[3].y),
+                               Vector4Wide(m.m_rows[0].z, m.m_rows[1].z, m.m_rows[2].z, m.m_rows[3].z),
+                               Vector4Wide(m.m_rows[0].w, m.m_rows[1].w, m.m_rows[2].w, m.m_rows[3].w));
+        }
+
+        //Gathers wideLaneCount consecutive Matrix4s into one wide matrix
+        inline Matrix4Wide _MM_CALLCONV MMMatrix4WideLoadAoS(const Matrix4* src)
+        {
+            Matrix4Wide result;
+            MMFloat4 rows[wideLaneCount];
+            for (int r = 0; r < 4; r++)
+            {
+                for (size_t i = 0; i < wideLaneCount; i++)
+                    rows[i] = src[i].m_rows[r];
+                Vector4Wide& row = result.m_rows[r];
+                MMWideFromRows(rows, row.x, row.y, row.z, row.w);
+            }
+            return result;
+        }
+
+        //Scatters a wide matrix into wideLaneCount consecutive Matrix4s
+        inline void _MM_CALLCONV MMMatrix4WideStoreAoS(Matrix4* dst, const Matrix4Wide& m)
+        {
+            MMFloat4 rows[wideLaneCount];
+            for (int r = 0; r < 4; r++)
+            {
+                const Vector4Wide& row = m.m_rows[r];
+                MMWideToRows(rows, row.x, row.y, row.z, row.w);
+                for (size_t i = 0; i < wideLaneCount; i++)
+                    dst[i].m_rows[r] = rows[i];
+            }
+        }
+
+        //Determinant of every lane's matrix, the same first row expansion as MMMatrixDeterminantV
+        inline MMFloatW _MM_CALLCONV MMMatrix4WideDeterminant(const Matrix4Wide& m)
+        {
+            const Vector4Wide& r0 = m.m_rows[0];
+            const Vector4Wide& r1 = m.m_rows[1];
+            const Vector4Wide& r2 = m.m_rows[2];
+            const Vector4Wide& r3 = m.m_rows[3];
+
+            //2x2 minors of the bottom two rows
+            MMFloatW xy = MMWideSub(MMWideMul(r2.x, r3.y), MMWideMul(r2.y, r3.x));
+            MMFloatW xz = MMWideSub(MMWideMul(r2.x, r3.z), MMWideMul(r2.z, r3.x));
+            MMFloatW xw = MMWideSub(MMWideMul(r2.x, r3.w), MMWideMul(r2.w, r3.x));
+            MMFloatW yz = MMWideSub(MMWideMul(r2.y, r3.z), MMWideMul(r2.z, r3.y));
+            MMFloatW yw = MMWideSub(MMWideMul(r2.y, r3.w), MMWideMul(r2.w, r3.y));
+            MMFloatW zw = MMWideSub(MMWideMul(r2.z, r3.w), MMWideMul(r2.w, r3.z));
+
+            //3x3 minors of the bottom three rows, each leaving out one column
+            MMFloatW mx = MMWideAdd(MMWideSub(MMWideMul(r1.y, zw), MMWideMul(r1.z, yw)), MMWideMul(r1.w, yz));
+            MMFloatW my = MMWideAdd(MMWideSub(MMWideMul(r1.x, zw), MMWideMul(r1.z, xw)), MMWideMul(r1.w, xz));
+            MMFloatW mz = MMWideAdd(MMWideSub(MMWideMul(r1.x, yw), MMWideMul(r1.y, xw)), MMWideMul(r1.w, xy));
+            MMFloatW mw = MMWideAdd(MMWideSub(MMWideMul(r1.x, yz), MMWideMul(r1.y, xz)), MMWideMul(r1.z, xy));
+
+            MMFloatW det = MMWideSub(MMWideMul(r0.x, mx), MMWideMul(r0.y, my));
+            det = MMWideAdd(det, MMWideMul(r0.z, mz));
+            return MMWideSub(det, MMWideMul(r0.w, mw));
+        }
+
+        //Determinant of the upper 3x3 block of every lane's matrix
+        inline MMFloatW _MM_CALLCONV MMMatrix4WideDeterminant3x3(const Matrix4Wide& m)
+        {
+            const Vector4Wide& r0 = m.m_rows[0];
+            const Vector4Wide& r1 = m.m_rows[1];
+            const Vector4Wide& r2 = m.m_rows[2];
+
+            MMFloatW det = MMWideMul(r0.x, MMWideSub(MMWideMul(r1.y, r2.z), MMWideMul(r1.z, r2.y)));
+            det = MMWideAdd(det, MMWideMul(r0.y, MMWideSub(MMWideMul(r1.z, r2.x), MMWideMul(r1.x, r2.z))));
+            return MMWideAdd(det, MMWideMul(r0.z, MMWideSub(MMWideMul(r1.x, r2.y), MMWideMul(r1.y, r2.x))));
+        }
+    }
+}
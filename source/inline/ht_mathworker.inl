@@ -0,0 +1,176 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015-2016 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#pragma once
+
+#include <chrono>
+
+namespace Hatchit {
+
+    namespace Math {
+
+        namespace Internal
+        {
+            /** Blocks until predicate holds
+            * Built on wait_for, untimed condition_variable::wait needs a newer libstdc++
+            * symbol version than some deployed runtimes provide.
+            */
+            template <typename Predicate>
+            inline void MMConditionWait(std::condition_variable& condition, std::unique_lock<std::mutex>& lock, Predicate predicate)
+            {
+                while (!condition.wait_for(lock, std::chrono::milliseconds(100), predicate))
+                {
+                }
+            }
+        }
+
+        /////////////////////////////////////////////////////////
+        // MMWorkerPool
+        /////////////////////////////////////////////////////////
+
+        /** Starts workerCount threads that sleep until ParallelFor hands them work
+        * \param workerCount Threads besides the caller, zero runs every job on the caller
+        */
+        inline MMWorkerPool::MMWorkerPool(size_t workerCount)
+            : m_invoke(nullptr),
+              m_context(nullptr),
+              m_taskCount(0),
+              m_nextTask(0),
+              m_pending(0),
+              m_generation(0),
+              m_busy(0),
+              m_controlStatus(0),
+              m_stop(false)
+        {
+            m_workers.reserve(workerCount);
+            for (size_t i = 0; i < workerCount; i++)
+                m_workers.emplace_back(&MMWorkerPool::WorkerMain, this);
+        }
+
+        inline MMWorkerPool::~MMWorkerPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_wake.notify_all();
+            for (std::thread& worker : m_workers)
+                worker.join();
+        }
+
+        inline size_t MMWorkerPool::ThreadCount() const
+        {
+            return m_workers.size() + 1;
+        }
+
+        //One worker per hardware thread besides the caller
+        inline size_t MMWorkerPool::DefaultWorkerCount()
+        {
+            unsigned int threads = std::thread::hardware_concurrency();
+            return threads > 1 ? threads - 1 : 0;
+        }
+
+        /** Calls function(task) once for every task in [0, taskCount)
+        * Tasks may run in any order and on any thread, including the caller.
+        */
+        template <typename Function>
+        inline void MMWorkerPool::ParallelFor(size_t taskCount, Function function)
+        {
+            struct Thunk
+            {
+                static void Invoke(void* context, size_t task)
+                {
+                    (*static_cast<Function*>(context))(task);
+                }
+            };
+
+            Run(taskCount, &Thunk::Invoke, &function);
+        }
+
+        inline void MMWorkerPool::Run(size_t taskCount, Invoke invoke, void* context)
+        {
+            if (taskCount == 0)
+                return;
+            if (m_workers.empty() || taskCount == 1)
+            {
+                for (size_t task = 0; task < taskCount; task++)
+                    invoke(context, task);
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_invoke = invoke;
+                m_context = context;
+                m_taskCount = taskCount;
+                m_nextTask.store(0);
+                m_pending.store(taskCount);
+                //exception flags are sticky per thread and are not passed on
+                m_controlStatus = MMGetControlStatus() & ~0x3Fu;
+                m_generation++;
+            }
+            m_wake.notify_all();
+
+            Drain();
+
+            //workers that picked up this job may still be leaving Drain
+            std::unique_lock<std::mutex> lock(m_mutex);
+            Internal::MMConditionWait(m_done, lock, [this] { return m_pending.load() == 0 && m_busy == 0; });
+        }
+
+        inline void MMWorkerPool::Drain()
+        {
+            for (size_t task = m_nextTask.fetch_add(1); task < m_taskCount; task = m_nextTask.fetch_add(1))
+            {
+                m_invoke(m_context, task);
+                if (m_pending.fetch_sub(1) == 1)
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_done.notify_all();
+                }
+            }
+        }
+
+        inline void MMWorkerPool::WorkerMain()
+        {
+            uint64_t seen = 0;
+            for (;;)
+            {
+                uint32_t controlStatus;
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    Internal::MMConditionWait(m_wake, lock, [&] { return m_stop || m_generation != seen; });
+                    if (m_stop)
+                        return;
+                    seen = m_generation;
+                    //woke too late, the caller and the other workers already finished this job
+                    if (m_pending.load() == 0)
+                        continue;
+                    controlStatus = m_controlStatus;
+                    m_busy++;
+                }
+
+                uint32_t previous = MMGetControlStatus();
+                MMSetControlStatus(controlStatus | (previous & 0x3Fu));
+                Drain();
+                MMSetControlStatus(previous);
+
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_busy == 0 && m_pending.load() == 0)
+                    m_done.notify_all();
+            }
+        }
+    }
+}
@@ -0,0 +1,135 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+namespace
+{
+    Matrix4 TestMatrix(float seed)
+    {
+        Quaternion q = MMQuaternionNormalize(Quaternion(0.2f * seed, -0.4f, 0.3f + seed, 0.8f));
+        return MMMatrixTranslation(Vector3(seed, -2.0f, 3.0f * seed)) * MMMatrixRotationQuaternion(q) *
+               MMMatrixScale(Vector3(1.0f + seed, 2.0f, 0.5f));
+    }
+
+    void ExpectMatrixNear(const Matrix4& a, const Matrix4& b, float epsilon)
+    {
+        for (int i = 0; i < 16; i++)
+          EXPECT_NEAR(a.m_data[i], b.m_data[i], epsilon) << "element " << i;
+    }
+}
+
+TEST(AffineTransform, IsThreeQuartersOfAMatrix4)
+{
+  EXPECT_EQ(sizeof(AffineTransform), 48u);
+
+  AffineTransform identity;
+  ExpectMatrixNear(identity.ToMatrix4(), Matrix4(), 0.0f);
+}
+
+TEST(AffineTransform, RoundTripsThroughMatrix4)
+{
+  Matrix4 m = TestMatrix(1.0f);
+  AffineTransform a(m);
+  ExpectMatrixNear(a.ToMatrix4(), m, 0.0f);
+}
+
+TEST(AffineTransform, ComposeMatchesMatrix4Multiply)
+{
+  Matrix4 m = TestMatrix(1.0f);
+  Matrix4 n = TestMatrix(-0.5f);
+
+  AffineTransform composed = AffineTransform(m) * AffineTransform(n);
+  ExpectMatrixNear(composed.ToMatrix4(), m * n, 1e-5f);
+}
+
+TEST(AffineTransform, TransformsPointsAndVectors)
+{
+  Matrix4 m = TestMatrix(0.5f);
+  AffineTransform a(m);
+  Vector3 p(1.0f, -2.0f, 4.0f);
+
+  Vector4 expectedPoint = m * Vector4(p, 1.0f);
+  Vector4 expectedVector = m * Vector4(p, 0.0f);
+  EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(MMAffineTransformPoint(a, p), Vector3(expectedPoint), 1e-5f)));
+  EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(MMAffineTransformVector(a, p), Vector3(expectedVector), 1e-5f)));
+}
+
+TEST(AffineTransform, InverseMatchesMatrixInverse)
+{
+  Matrix4 m = TestMatrix(2.0f);
+  AffineTransform inverse = MMAffineInverse(AffineTransform(m));
+
+  ExpectMatrixNear(inverse.ToMatrix4(), MMMatrixInverse(m), 1e-5f);
+  ExpectMatrixNear((inverse * AffineTransform(m)).ToMatrix4(), Matrix4(), 1e-5f);
+}
+
+TEST(AffineTransformStatic, StreamsMatchSingleCalls)
+{
+  const size_t count = 5;
+  AffineTransform a[count], b[count], product[count], inverse[count];
+  Vector3 points[count], transformed[count], directions[count];
+  Matrix4 expanded[count];
+  AffineTransform packed[count];
+
+  for (size_t i = 0; i < count; i++)
+  {
+    a[i] = AffineTransform(TestMatrix(float(i)));
+    b[i] = AffineTransform(TestMatrix(-float(i)));
+    points[i] = Vector3(float(i), 1.0f, -float(i));
+  }
+
+  MMAffineMultiplyStream(product, a, b, count);
+  MMAffineInverseStream(inverse, a, count);
+  MMAffineTransformPointStream(transformed, a[2], points, count);
+  MMAffineTransformVectorStream(directions, a[2], points, count);
+  MMAffineToMatrix4Stream(expanded, a, count);
+  MMAffineFromMatrix4Stream(packed, expanded, count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    ExpectMatrixNear(product[i].ToMatrix4(), (a[i] * b[i]).ToMatrix4(), 0.0f);
+    ExpectMatrixNear(inverse[i].ToMatrix4(), MMAffineInverse(a[i]).ToMatrix4(), 0.0f);
+    EXPECT_TRUE(transformed[i] == MMAffineTransformPoint(a[2], points[i]));
+    EXPECT_TRUE(directions[i] == MMAffineTransformVector(a[2], points[i]));
+    ExpectMatrixNear(expanded[i], a[i].ToMatrix4(), 0.0f);
+    ExpectMatrixNear(packed[i].ToMatrix4(), a[i].ToMatrix4(), 0.0f);
+  }
+}
+
+TEST(AffineTransformStatic, OrthonormalizeKeepsTranslation)
+{
+  const size_t count = 10;
+  AffineTransform transforms[count];
+  AffineTransform expected[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    transforms[i] = AffineTransform(TestMatrix(0.2f * i));
+    expected[i] = MMAffineOrthonormalize(transforms[i]);
+    ExpectMatrixNear(expected[i].ToMatrix4(), MMMatrixOrthonormalize(TestMatrix(0.2f * i)), 1e-6f);
+    EXPECT_NEAR(MMMatrixDeterminant3x3(expected[i].ToMatrix4()), 1.0f, 1e-5f);
+  }
+
+  MMAffineOrthonormalizeStream(transforms, transforms, count);
+  for (size_t i = 0; i < count; i++)
+  {
+    ExpectMatrixNear(transforms[i].ToMatrix4(), expected[i].ToMatrix4(), 1e-6f);
+    EXPECT_NEAR(transforms[i].ToMatrix4()[2][3], 3.0f * 0.2f * i, 1e-6f);
+  }
+}
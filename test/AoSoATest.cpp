@@ -0,0 +1,89 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+#include <vector>
+
+using namespace Hatchit;
+using namespace Math;
+
+TEST(AoSoAArray, BlocksAreCacheLineAligned)
+{
+  AoSoAArray<Vector3, 8> array(20);
+  EXPECT_EQ(array.Size(), 20u);
+  EXPECT_EQ(array.BlockCount(), 3u);
+  EXPECT_EQ(sizeof(AoSoAArray<Vector3, 8>::Block), 3 * 8 * sizeof(float));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(array.Blocks()) % cacheLineAlignment, 0u);
+}
+
+TEST(AoSoAArray, RoundTripsVector3Array)
+{
+  //an odd count leaves a tail that is not a whole lane group
+  std::vector<Vector3> source;
+  for (int i = 0; i < 19; i++)
+    source.push_back(Vector3(float(i), float(i) * 2.0f, float(-i)));
+
+  AoSoAArray<Vector3, 8> array(source.data(), source.size());
+  for (size_t i = 0; i < source.size(); i++)
+    EXPECT_TRUE(array.Get(i) == source[i]);
+
+  //element i lives at lane i % 8 of block i / 8
+  EXPECT_EQ(array.Blocks()[1].m_data[1][2], source[10].y);
+
+  std::vector<Vector3> out(source.size());
+  array.Store(out.data());
+  for (size_t i = 0; i < source.size(); i++)
+    EXPECT_TRUE(out[i] == source[i]);
+}
+
+TEST(AoSoAArray, ForEachWideUpdatesEveryElement)
+{
+  std::vector<Quaternion> source;
+  for (int i = 0; i < 13; i++)
+    source.push_back(Quaternion(0.0f, 0.0f, float(i), 1.0f));
+
+  AoSoAArray<Quaternion, 16> array(source.data(), source.size());
+  QuaternionWide spin(Quaternion(1.0f, 0.0f, 0.0f, 0.0f));
+  array.ForEachWide([&](QuaternionWide& q) { q = q * spin; });
+
+  for (size_t i = 0; i < source.size(); i++)
+  {
+    Quaternion expected = source[i] * Quaternion(1.0f, 0.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(array.Get(i), expected, 1e-6f)));
+  }
+
+  size_t visited = 0;
+  array.ForEachWide([&](const QuaternionWide&) { visited++; });
+  EXPECT_EQ(visited, array.WideCount());
+}
+
+TEST(AoSoAArray, ShrinkingClearsPaddingLanes)
+{
+  AoSoAArray<Vector4> array(wideLaneCount);
+  for (size_t i = 0; i < wideLaneCount; i++)
+    array.Set(i, Vector4(1.0f));
+
+  array.Resize(1);
+  array.Resize(wideLaneCount);
+  EXPECT_TRUE(array.Get(0) == Vector4(1.0f));
+  for (size_t i = 1; i < wideLaneCount; i++)
+    EXPECT_TRUE(array.Get(i) == Vector4(0.0f));
+
+  AoSoAArray<Vector4> copy(array);
+  AoSoAArray<Vector4> moved(std::move(copy));
+  EXPECT_EQ(copy.Size(), 0u);
+  EXPECT_TRUE(moved.Get(0) == Vector4(1.0f));
+}
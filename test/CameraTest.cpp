@@ -0,0 +1,124 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+namespace
+{
+    void ExpectMatrixNear(const Matrix4& a, const Matrix4& b, float epsilon)
+    {
+        for (int i = 0; i < 16; i++)
+          EXPECT_NEAR(a.m_data[i], b.m_data[i], epsilon) << "element " << i;
+    }
+
+    float PlaneDistance(const Vector4& plane, const Vector3& p)
+    {
+        return plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w;
+    }
+}
+
+TEST(Camera, LookAtFacesTheTarget)
+{
+  Vector3 eye(3.0f, 2.0f, 5.0f);
+  Vector3 target(0.0f, 1.0f, -2.0f);
+  Vector3 up(0.0f, 1.0f, 0.0f);
+
+  Camera camera;
+  camera.LookAt(eye, target, up);
+
+  //the target lands on the -z axis, up stays up and the view is a proper rotation
+  Vector4 viewTarget = camera.View() * Vector4(target.x, target.y, target.z, 1.0f);
+  EXPECT_NEAR(viewTarget.x, 0.0f, 1e-5f);
+  EXPECT_NEAR(viewTarget.y, 0.0f, 1e-5f);
+  EXPECT_NEAR(viewTarget.z, -MMVector3Magnitude(target - eye), 1e-5f);
+  EXPECT_GT(camera.View().yy, 0.0f);
+  EXPECT_NEAR(MMMatrix3Determinant(Matrix3(camera.View())), 1.0f, 1e-5f);
+
+  ExpectMatrixNear(camera.View() * camera.InverseView(), Matrix4(), 1e-5f);
+}
+
+TEST(Camera, InversesMatchGeneralInverse)
+{
+  Camera camera;
+  camera.LookAt(Vector3(-1.0f, 4.0f, 2.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+  camera.SetPerspective(1.1f, 1280.0f, 720.0f, 0.1f, 500.0f, MM_DEPTH_REVERSED);
+
+  ExpectMatrixNear(camera.ViewProjection(), camera.Projection() * camera.View(), 0);
+  ExpectMatrixNear(camera.ViewProjection() * camera.InverseViewProjection(), Matrix4(), 1e-4f);
+  ExpectMatrixNear(camera.InverseProjection(), MMMatrixInverse(camera.Projection()), 1e-4f);
+}
+
+TEST(Camera, VersionsOnlyMoveOnChange)
+{
+  Camera camera;
+  uint32_t view = camera.ViewVersion();
+  uint32_t projection = camera.ProjectionVersion();
+  uint32_t version = camera.Version();
+
+  camera.SetPosition(Vector3());
+  camera.SetOrientation(Quaternion());
+  camera.SetPerspective(Pi / 3.0f, 1.0f, 1.0f, 0.1f, 1000.0f);
+  EXPECT_EQ(camera.ViewVersion(), view);
+  EXPECT_EQ(camera.ProjectionVersion(), projection);
+  EXPECT_EQ(camera.Version(), version);
+
+  camera.SetPosition(Vector3(1.0f, 0.0f, 0.0f));
+  EXPECT_NE(camera.ViewVersion(), view);
+  EXPECT_EQ(camera.ProjectionVersion(), projection);
+  EXPECT_NE(camera.Version(), version);
+
+  version = camera.Version();
+  camera.SetOrthographic(-1.0f, 1.0f, -1.0f, 1.0f, 0.1f, 10.0f);
+  EXPECT_NE(camera.ProjectionVersion(), projection);
+  EXPECT_NE(camera.Version(), version);
+  EXPECT_FALSE(camera.IsPerspective());
+}
+
+TEST(Camera, CachedMatricesFollowChanges)
+{
+  Camera camera;
+  Matrix4 before = camera.ViewProjection();
+
+  camera.SetPosition(Vector3(0.0f, 0.0f, 5.0f));
+  Matrix4 after = camera.ViewProjection();
+  ExpectMatrixNear(after, camera.Projection() * MMMatrixTranslation(Vector3(0.0f, 0.0f, -5.0f)), 1e-5f);
+  EXPECT_NE(before.zw, after.zw);
+}
+
+TEST(Camera, FrustumPlanesBoundTheView)
+{
+  const MMDepthRange ranges[] = { MM_DEPTH_NEGATIVE_ONE_TO_ONE, MM_DEPTH_ZERO_TO_ONE, MM_DEPTH_REVERSED };
+  for (MMDepthRange depth : ranges)
+  {
+    Camera camera;
+    camera.LookAt(Vector3(0.0f, 0.0f, 10.0f), Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+    camera.SetPerspective(HalfPi, 1.0f, 1.0f, 1.0f, 100.0f, depth);
+
+    const Vector4* planes = camera.FrustumPlanes();
+    for (uint32_t i = 0; i < Camera::FRUSTUM_PLANE_COUNT; i++)
+      EXPECT_GT(PlaneDistance(planes[i], Vector3(0.0f, 0.0f, 0.0f)), 0.0f) << "plane " << i;
+
+    //a 90 degree fov puts the side planes at 45 degrees, the origin is 10 units away
+    EXPECT_NEAR(PlaneDistance(planes[Camera::FRUSTUM_LEFT], Vector3(0.0f, 0.0f, 0.0f)), 10.0f / sqrtf(2.0f), 1e-4f);
+    EXPECT_NEAR(PlaneDistance(planes[Camera::FRUSTUM_NEAR], Vector3(0.0f, 0.0f, 0.0f)), 9.0f, 1e-3f);
+    EXPECT_NEAR(PlaneDistance(planes[Camera::FRUSTUM_FAR], Vector3(0.0f, 0.0f, 0.0f)), 90.0f, 1e-2f);
+    EXPECT_LT(PlaneDistance(planes[Camera::FRUSTUM_NEAR], Vector3(0.0f, 0.0f, 9.5f)), 0.0f);
+    EXPECT_LT(PlaneDistance(planes[Camera::FRUSTUM_RIGHT], Vector3(20.0f, 0.0f, 0.0f)), 0.0f);
+  }
+}
@@ -0,0 +1,93 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+#ifdef HT_MATH_SSE
+
+namespace
+{
+  //Keeps the compiler from folding the arithmetic at compile time
+  float MultiplyInRegister(float a, float b)
+  {
+    return MMVectorGetX(MMVectorMul(MMVectorSplat(a), MMVectorSplat(b)));
+  }
+
+  const float smallNormal = 1.0e-30f;
+}
+
+TEST(MMDenormal, GuardFlushesAndRestores)
+{
+  uint32_t before = MMGetControlStatus();
+
+  EXPECT_GT(MultiplyInRegister(smallNormal, 1.0e-10f), 0.0f);
+  {
+    MMDenormalGuard guard;
+    EXPECT_TRUE(MMDenormalFlushEnabled());
+    EXPECT_EQ(MultiplyInRegister(smallNormal, 1.0e-10f), 0.0f);
+  }
+
+  uint32_t modeBits = MM_CONTROL_FLUSH_TO_ZERO | MM_CONTROL_DENORMALS_ARE_ZERO;
+  EXPECT_EQ(MMGetControlStatus() & modeBits, before & modeBits);
+}
+
+TEST(MMDenormal, InstallAndRestoreOnThread)
+{
+  uint32_t previous = MMDenormalFlushInstall();
+  EXPECT_TRUE(MMDenormalFlushEnabled());
+
+  MMDenormalFlushRestore(previous);
+  EXPECT_FALSE(MMDenormalFlushEnabled());
+}
+
+TEST(MMDenormal, FlushTaskRunsUnderGuard)
+{
+  auto task = MMMakeDenormalFlushTask([](float a, float b) { return MultiplyInRegister(a, b); });
+
+  EXPECT_EQ(task(smallNormal, 1.0e-10f), 0.0f);
+  EXPECT_FALSE(MMDenormalFlushEnabled());
+}
+
+TEST(MMDenormal, SampleScopeCountsUnderflows)
+{
+  static MMDenormalCounter counter("DenormalTest");
+  counter.Reset();
+
+  {
+    MMDenormalSampleScope scope(counter);
+    MultiplyInRegister(2.0f, 3.0f);
+  }
+  {
+    MMDenormalSampleScope scope(counter);
+    MultiplyInRegister(smallNormal, 1.0e-10f);
+  }
+
+  EXPECT_EQ(counter.Samples(), 2u);
+  EXPECT_EQ(counter.Underflows(), 1u);
+
+  bool registered = false;
+  for (const MMDenormalCounter* c = MMDenormalCounter::First(); c; c = c->Next())
+    registered |= (c == &counter);
+  EXPECT_TRUE(registered);
+
+  std::ostringstream report;
+  MMDenormalReport(report);
+  EXPECT_NE(report.str().find("DenormalTest"), std::string::npos);
+}
+
+#endif
@@ -0,0 +1,191 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+namespace
+{
+    Quaternion RandomRotation(float seed)
+    {
+        Quaternion q(std::sin(seed), std::cos(seed * 1.7f), std::sin(seed * 0.3f + 1.0f), std::cos(seed * 2.3f) + 1.5f);
+        return MMQuaternionNormalize(q);
+    }
+
+    Quaternion Scale(const Quaternion& q, float s)
+    {
+        return Quaternion(MMVectorMul(q.m_quaternion, MMVectorSplat(s)));
+    }
+
+    void ExpectNear(const Quaternion& a, const Quaternion& b, float tolerance)
+    {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+        EXPECT_NEAR(a.w, b.w, tolerance);
+    }
+
+    void ExpectNear(const Vector3& a, const Vector3& b, float tolerance)
+    {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+    }
+}
+
+TEST(DualQuaternion, DefaultConstructorIsIdentity)
+{
+  DualQuaternion dq;
+  Vector3 p(1.0f, -2.0f, 3.0f);
+  ExpectNear(MMDualQuaternionTransformPoint(dq, p), p, 1e-6f);
+  ExpectNear(MMDualQuaternionGetTranslation(dq), Vector3(), 1e-6f);
+}
+
+TEST(DualQuaternion, TransformPointMatchesMatrix)
+{
+  Quaternion rotation = RandomRotation(0.4f);
+  Vector3 translation(3.0f, -1.0f, 0.5f);
+  DualQuaternion dq(rotation, translation);
+  ExpectNear(MMDualQuaternionGetTranslation(dq), translation, 1e-5f);
+
+  Matrix4 m = dq.ToMatrix4();
+  Vector3 p(0.25f, 2.0f, -4.0f);
+  Vector4 expected = m * Vector4(p.x, p.y, p.z, 1.0f);
+  Vector3 actual = MMDualQuaternionTransformPoint(dq, p);
+  ExpectNear(actual, Vector3(expected.x, expected.y, expected.z), 1e-4f);
+
+  Vector3 direction = MMDualQuaternionTransformVector(dq, p);
+  Vector4 expectedDirection = m * Vector4(p.x, p.y, p.z, 0.0f);
+  ExpectNear(direction, Vector3(expectedDirection.x, expectedDirection.y, expectedDirection.z), 1e-4f);
+}
+
+TEST(DualQuaternion, MatrixRoundTrip)
+{
+  DualQuaternion dq(RandomRotation(1.3f), Vector3(-2.0f, 7.0f, 1.0f));
+  DualQuaternion back = MMDualQuaternionFromMatrix(dq.ToMatrix4());
+
+  //q and -q are the same rotation
+  float sign = MMQuaternionDot(dq.m_real, back.m_real) < 0.0f ? -1.0f : 1.0f;
+  ExpectNear(dq.m_real, Scale(back.m_real, sign), 1e-4f);
+  ExpectNear(dq.m_dual, Scale(back.m_dual, sign), 1e-4f);
+}
+
+TEST(DualQuaternion, MultiplyMatchesMatrixProduct)
+{
+  DualQuaternion a(RandomRotation(0.2f), Vector3(1.0f, 2.0f, 3.0f));
+  DualQuaternion b(RandomRotation(2.9f), Vector3(-4.0f, 0.5f, 2.0f));
+
+  Matrix4 expected = a.ToMatrix4() * b.ToMatrix4();
+  Matrix4 actual = (a * b).ToMatrix4();
+  for (int i = 0; i < 16; i++)
+    EXPECT_NEAR(expected.m_data[i], actual.m_data[i], 1e-4f);
+
+  DualQuaternion c = a;
+  c *= b;
+  ExpectNear(c.m_real, (a * b).m_real, 1e-6f);
+  ExpectNear(c.m_dual, (a * b).m_dual, 1e-6f);
+}
+
+TEST(DualQuaternionStatic, ConjugateIsInverse)
+{
+  DualQuaternion dq(RandomRotation(0.8f), Vector3(5.0f, -3.0f, 1.0f));
+  DualQuaternion identity = dq * MMDualQuaternionConjugate(dq);
+  ExpectNear(identity.m_real, Quaternion(), 1e-5f);
+  ExpectNear(identity.m_dual, Quaternion(0.0f, 0.0f, 0.0f, 0.0f), 1e-5f);
+}
+
+TEST(DualQuaternionStatic, NormalizeDividesByRealLength)
+{
+  DualQuaternion dq(RandomRotation(0.6f), Vector3(1.0f, 1.0f, -2.0f));
+  DualQuaternion scaled(Scale(dq.m_real, 3.0f), Scale(dq.m_dual, 3.0f));
+  DualQuaternion normalized = MMDualQuaternionNormalize(scaled);
+  ExpectNear(normalized.m_real, dq.m_real, 1e-3f);
+  ExpectNear(normalized.m_dual, dq.m_dual, 1e-3f);
+}
+
+TEST(DualQuaternionStatic, BlendIgnoresAntipodalSign)
+{
+  DualQuaternion bone(RandomRotation(1.1f), Vector3(2.0f, 0.0f, -1.0f));
+  DualQuaternion palette[2] = { bone, DualQuaternion(Scale(bone.m_real, -1.0f), Scale(bone.m_dual, -1.0f)) };
+  uint32_t indices[2] = { 0, 1 };
+  float weights[2] = { 0.5f, 0.5f };
+
+  DualQuaternion blended = MMDualQuaternionBlend(palette, indices, weights, 2);
+  ExpectNear(blended.m_real, bone.m_real, 1e-3f);
+  ExpectNear(blended.m_dual, bone.m_dual, 1e-3f);
+}
+
+TEST(DualQuaternionStatic, BlendStreamMatchesSingleBlend)
+{
+  const size_t boneCount = 5;
+  const size_t influences = 3;
+  const size_t count = 19;
+
+  DualQuaternion palette[boneCount];
+  for (size_t b = 0; b < boneCount; b++)
+    palette[b] = DualQuaternion(RandomRotation(0.7f * b), Vector3(float(b), -float(b), 0.5f));
+  //an antipodal copy of bone 0 exercises the wide sign flip
+  palette[4] = DualQuaternion(Scale(palette[0].m_real, -1.0f), Scale(palette[0].m_dual, -1.0f));
+
+  std::vector<uint32_t> indices(influences * count);
+  std::vector<float> weights(influences * count);
+  for (size_t i = 0; i < count; i++)
+  {
+    float total = 0.0f;
+    for (size_t k = 0; k < influences; k++)
+    {
+      indices[k * count + i] = uint32_t((i + k * 2) % boneCount);
+      weights[k * count + i] = 1.0f + float((i * 7 + k * 3) % 5);
+      total += weights[k * count + i];
+    }
+    for (size_t k = 0; k < influences; k++)
+      weights[k * count + i] /= total;
+  }
+
+  std::vector<DualQuaternion> out(count);
+  MMDualQuaternionBlendStream(out.data(), palette, indices.data(), weights.data(), influences, count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    uint32_t vertexIndices[influences];
+    float vertexWeights[influences];
+    for (size_t k = 0; k < influences; k++)
+    {
+      vertexIndices[k] = indices[k * count + i];
+      vertexWeights[k] = weights[k * count + i];
+    }
+    DualQuaternion expected = MMDualQuaternionBlend(palette, vertexIndices, vertexWeights, influences);
+    ExpectNear(out[i].m_real, expected.m_real, 1e-3f);
+    ExpectNear(out[i].m_dual, expected.m_dual, 1e-3f);
+  }
+}
+
+TEST(DualQuaternionStatic, TransformPointStreamMatchesSingle)
+{
+  DualQuaternion dq[3] = { DualQuaternion(RandomRotation(0.1f), Vector3(1.0f, 0.0f, 0.0f)),
+                           DualQuaternion(RandomRotation(0.9f), Vector3(0.0f, 2.0f, 0.0f)),
+                           DualQuaternion(RandomRotation(1.7f), Vector3(0.0f, 0.0f, 3.0f)) };
+  Vector3 points[3] = { Vector3(1.0f, 2.0f, 3.0f), Vector3(-1.0f, 0.0f, 4.0f), Vector3(0.5f, 0.5f, 0.5f) };
+  Vector3 expected[3];
+  for (int i = 0; i < 3; i++)
+    expected[i] = MMDualQuaternionTransformPoint(dq[i], points[i]);
+
+  MMDualQuaternionTransformPointStream(points, dq, points, 3);
+  for (int i = 0; i < 3; i++)
+    ExpectNear(points[i], expected[i], 1e-6f);
+}
@@ -0,0 +1,258 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+#include <limits>
+#include <type_traits>
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+static void ExpectLanes(MMFloat4 v, float x, float y, float z, float w)
+{
+  _MM_ALIGN16 float lanes[4];
+  MMVectorStore(lanes, v);
+  EXPECT_FLOAT_EQ(lanes[0], x);
+  EXPECT_FLOAT_EQ(lanes[1], y);
+  EXPECT_FLOAT_EQ(lanes[2], z);
+  EXPECT_FLOAT_EQ(lanes[3], w);
+}
+
+TEST(MMVector, SetAndGet)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+
+  EXPECT_FLOAT_EQ(MMVectorGetX(v), 1);
+  EXPECT_FLOAT_EQ(MMVectorGetY(v), 2);
+  EXPECT_FLOAT_EQ(MMVectorGetZ(v), 3);
+  EXPECT_FLOAT_EQ(MMVectorGetW(v), 4);
+}
+
+TEST(MMVector, GetRawStoresRequestedLane)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  float y, z, w;
+
+  MMVectorGetYRaw(&y, v);
+  MMVectorGetZRaw(&z, v);
+  MMVectorGetWRaw(&w, v);
+
+  EXPECT_FLOAT_EQ(y, 2);
+  EXPECT_FLOAT_EQ(z, 3);
+  EXPECT_FLOAT_EQ(w, 4);
+}
+
+TEST(MMVector, SetSingleLane)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+
+  ExpectLanes(MMVectorSetX(v, 9), 9, 2, 3, 4);
+  ExpectLanes(MMVectorSetY(v, 9), 1, 9, 3, 4);
+  ExpectLanes(MMVectorSetZ(v, 9), 1, 2, 9, 4);
+  ExpectLanes(MMVectorSetW(v, 9), 1, 2, 3, 9);
+}
+
+TEST(MMVector, ShuffleTakesLowHalfFromFirstOperand)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(5, 6, 7, 8);
+
+  ExpectLanes(MMVectorShuffle<3, 0, 1, 2>(v, u), 4, 1, 6, 7);
+  ExpectLanes(MMVectorSplatZ(v), 3, 3, 3, 3);
+}
+
+TEST(MMVector, MergeAndMove)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(5, 6, 7, 8);
+
+  ExpectLanes(MMVectorMergeXY(v, u), 1, 5, 2, 6);
+  ExpectLanes(MMVectorMergeZW(v, u), 3, 7, 4, 8);
+  ExpectLanes(MMVectorMoveLH(v, u), 1, 2, 5, 6);
+  ExpectLanes(MMVectorMoveHL(v, u), 7, 8, 3, 4);
+  ExpectLanes(MMVectorMoveX(v, u), 5, 2, 3, 4);
+}
+
+TEST(MMVector, Transpose4)
+{
+  MMFloat4 r0 = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 r1 = MMVectorSet(5, 6, 7, 8);
+  MMFloat4 r2 = MMVectorSet(9, 10, 11, 12);
+  MMFloat4 r3 = MMVectorSet(13, 14, 15, 16);
+
+  MMVectorTranspose4(r0, r1, r2, r3);
+
+  ExpectLanes(r0, 1, 5, 9, 13);
+  ExpectLanes(r1, 2, 6, 10, 14);
+  ExpectLanes(r2, 3, 7, 11, 15);
+  ExpectLanes(r3, 4, 8, 12, 16);
+}
+
+TEST(MMVector, CompareEqualMaskBits)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(1, 0, 3, 0);
+
+  EXPECT_EQ(MMMaskToBits(MMVectorCompareEqual(v, u)), 5);
+  EXPECT_TRUE(MMVectorEqual(v, v));
+  EXPECT_FALSE(MMVectorEqual(v, u));
+}
+
+TEST(MMVector, SwizzleReordersLanes)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+
+  ExpectLanes(MMVectorSwizzle<0, 1, 2, 3>(v), 1, 2, 3, 4);
+  ExpectLanes(MMVectorSwizzle<3, 2, 1, 0>(v), 4, 3, 2, 1);
+  ExpectLanes(MMVectorSwizzle<0, 0, 1, 1>(v), 1, 1, 2, 2);
+  ExpectLanes(MMVectorSwizzle<2, 2, 3, 3>(v), 3, 3, 4, 4);
+  ExpectLanes(MMVectorSwizzle<MM_SWIZZLE_Z, MM_SWIZZLE_W, MM_SWIZZLE_Z, MM_SWIZZLE_W>(v), 3, 4, 3, 4);
+}
+
+TEST(MMVector, PermuteSelectsFromBothOperands)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(5, 6, 7, 8);
+
+  ExpectLanes(MMVectorPermute<3, 2, 1, 0>(v, u), 4, 3, 2, 1);
+  ExpectLanes(MMVectorPermute<7, 6, 5, 4>(v, u), 8, 7, 6, 5);
+  ExpectLanes(MMVectorPermute<1, 0, 7, 4>(v, u), 2, 1, 8, 5);
+  ExpectLanes(MMVectorPermute<5, 4, 2, 3>(v, u), 6, 5, 3, 4);
+  ExpectLanes(MMVectorPermute<0, 5, 2, 7>(v, u), 1, 6, 3, 8);
+  ExpectLanes(MMVectorPermute<0, 1, 4, 5>(v, u), 1, 2, 5, 6);
+  ExpectLanes(MMVectorPermute<6, 7, 2, 3>(v, u), 7, 8, 3, 4);
+  ExpectLanes(MMVectorPermute<0, 4, 1, 5>(v, u), 1, 5, 2, 6);
+  ExpectLanes(MMVectorPermute<2, 6, 3, 7>(v, u), 3, 7, 4, 8);
+  ExpectLanes(MMVectorPermute<MM_PERMUTE_1W, MM_PERMUTE_0X, MM_PERMUTE_1Y, MM_PERMUTE_0Z>(v, u), 8, 1, 6, 3);
+}
+
+TEST(MMVector, BlendPicksPerLane)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(5, 6, 7, 8);
+
+  ExpectLanes(MMVectorBlend<0, 1, 0, 1>(v, u), 1, 6, 3, 8);
+  ExpectLanes(MMVectorBlend<1, 1, 1, 0>(v, u), 5, 6, 7, 4);
+}
+
+TEST(MMVector, OrderedComparisonMasks)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(2, 2, 2, 2);
+
+  EXPECT_EQ(MMMaskToBits(MMVectorCompareLess(v, u)), 1);
+  EXPECT_EQ(MMMaskToBits(MMVectorCompareLessEqual(v, u)), 3);
+  EXPECT_EQ(MMMaskToBits(MMVectorCompareGreater(v, u)), 12);
+  EXPECT_EQ(MMMaskToBits(MMVectorCompareGreaterEqual(v, u)), 14);
+  EXPECT_EQ(MMMaskToBits(MMVectorCompareNotEqual(v, u)), 13);
+}
+
+TEST(MMVector, NearEqualUsesEpsilon)
+{
+  MMFloat4 v = MMVectorSet(1.0f, 2.0f, 3.0f, 4.0f);
+  MMFloat4 u = MMVectorSet(1.05f, 1.95f, 3.5f, 4.0f);
+
+  EXPECT_EQ(MMMaskToBits(MMVectorNearEqual(v, u, MMVectorSplat(0.1f))), 11);
+}
+
+TEST(MMVector, DetectsNaNAndInfinity)
+{
+  float inf = std::numeric_limits<float>::infinity();
+  MMFloat4 v = MMVectorSet(std::numeric_limits<float>::quiet_NaN(), inf, -inf, 1.0f);
+
+  EXPECT_EQ(MMMaskToBits(MMVectorIsNaN(v)), 1);
+  EXPECT_EQ(MMMaskToBits(MMVectorIsInf(v)), 6);
+}
+
+TEST(MMVector, SelectAndReductions)
+{
+  MMFloat4 v = MMVectorSet(1, 2, 3, 4);
+  MMFloat4 u = MMVectorSet(5, 6, 7, 8);
+  MMMask4 mask = MMVectorCompareLess(v, MMVectorSet(2, 0, 4, 0));
+
+  ExpectLanes(MMVectorSelect(mask, v, u), 1, 6, 3, 8);
+  EXPECT_TRUE(MMMaskAnyTrue(mask));
+  EXPECT_FALSE(MMMaskAllTrue(mask));
+  EXPECT_TRUE(MMMaskAllTrue(mask, 5));
+}
+
+TEST(MMVector, AbsAndClamp)
+{
+  MMFloat4 v = MMVectorSet(-1.5f, 2.0f, -0.0f, 9.0f);
+
+  ExpectLanes(MMVectorAbs(v), 1.5f, 2.0f, 0.0f, 9.0f);
+  ExpectLanes(MMVectorClamp(v, MMVectorSplat(-1.0f), MMVectorSplat(3.0f)), -1.0f, 2.0f, 0.0f, 3.0f);
+}
+
+TEST(MMVector, FloorCeilRound)
+{
+  MMFloat4 v = MMVectorSet(-1.5f, 2.5f, -0.25f, 3.75f);
+
+  ExpectLanes(MMVectorFloor(v), -2.0f, 2.0f, -1.0f, 3.0f);
+  ExpectLanes(MMVectorCeil(v), -1.0f, 3.0f, 0.0f, 4.0f);
+  ExpectLanes(MMVectorRound(v), -2.0f, 2.0f, 0.0f, 4.0f);
+}
+
+TEST(MMVector, RoundingHandlesValuesOutsideInt32)
+{
+  //Every float this large is already integral, the int32 based Floorf would overflow
+  MMFloat4 v = MMVectorSet(3.0e9f, -3.0e9f, 1.0e20f, 16777215.0f);
+
+  ExpectLanes(MMVectorFloor(v), 3.0e9f, -3.0e9f, 1.0e20f, 16777215.0f);
+  ExpectLanes(MMVectorCeil(v), 3.0e9f, -3.0e9f, 1.0e20f, 16777215.0f);
+  ExpectLanes(MMVectorRound(v), 3.0e9f, -3.0e9f, 1.0e20f, 16777215.0f);
+}
+
+TEST(MMVector, RegisterTypesAreTriviallyCopyable)
+{
+  //Required for by-value FVector* parameters to travel in XMM registers
+  EXPECT_TRUE(std::is_trivially_copyable<Vector2>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<Vector3>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<Vector4>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<Quaternion>::value);
+  EXPECT_TRUE(std::is_trivially_copyable<Matrix4>::value);
+}
+
+TEST(MMVector, FastReciprocalsStayWithinDocumentedBounds)
+{
+  MMFloat4 v = MMVectorSet(0.001f, 1.0f, 3.0f, 123456.0f);
+  _MM_ALIGN16 float input[4];
+  _MM_ALIGN16 float rcp[4];
+  _MM_ALIGN16 float rsqrt[4];
+  _MM_ALIGN16 float root[4];
+
+  MMVectorStore(input, v);
+  MMVectorStore(rcp, MMVectorReciprocal(v, MMPrecisionFast()));
+  MMVectorStore(rsqrt, MMVectorReciprocalSqrt(v, MMPrecisionFast()));
+  MMVectorStore(root, MMVectorSqrt(v, MMPrecisionFast()));
+
+  for (int i = 0; i < 4; i++)
+  {
+    EXPECT_NEAR(rcp[i] * input[i], 1.0f, 2.4e-7f);
+    EXPECT_NEAR(rsqrt[i] * sqrtf(input[i]), 1.0f, 4.8e-7f);
+    EXPECT_NEAR(root[i] / sqrtf(input[i]), 1.0f, 4.8e-7f);
+  }
+
+  EXPECT_FLOAT_EQ(MMVectorGetX(MMVectorSqrt(MMVectorZero(), MMPrecisionFast())), 0.0f);
+}
+
+TEST(MMVector, ExactPrecisionMatchesPlainOperations)
+{
+  MMFloat4 v = MMVectorSet(1.0f, 2.0f, 3.0f, 7.0f);
+  MMFloat4 u = MMVectorSet(3.0f, 7.0f, 11.0f, 13.0f);
+
+  EXPECT_TRUE(MMVectorEqual(MMVectorDiv(v, u, MMPrecisionExact()), MMVectorDiv(v, u)));
+  EXPECT_TRUE(MMVectorEqual(MMVectorSqrt(u, MMPrecisionExact()), MMVectorSqrt(u)));
+}
@@ -0,0 +1,241 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+namespace
+{
+    void ExpectMatrixNear(const Matrix3& a, const Matrix3& b, float epsilon)
+    {
+        for (int i = 0; i < 3; i++)
+          for (int j = 0; j < 3; j++)
+            EXPECT_NEAR(a[i][j], b[i][j], epsilon) << "element " << i << "," << j;
+    }
+
+    Matrix4 TestMatrix(float seed)
+    {
+        Quaternion q = MMQuaternionNormalize(Quaternion(0.2f * seed, -0.4f, 0.3f + seed, 0.8f));
+        return MMMatrixTranslation(Vector3(seed, -2.0f, 3.0f * seed)) * MMMatrixRotationQuaternion(q) *
+               MMMatrixScale(Vector3(1.0f + seed, 2.0f, 0.5f));
+    }
+}
+
+TEST(Matrix3, DefaultConstructor)
+{
+  //Should be an identity matrix
+  Matrix3 matrix;
+
+  for(int i = 0; i < 3; i++)
+  {
+    for(int j = 0; j < 3; j++)
+    {
+      if(i == j)
+        ASSERT_EQ(matrix[i][j], 1);
+      else
+        ASSERT_EQ(matrix[i][j], 0);
+    }
+  }
+}
+
+TEST(Matrix3, ArrayConstructor)
+{
+  float array[] = {1,2,3,4,5,6,7,8,9};
+
+  Matrix3 matrix(array);
+
+  int index = 0;
+  for(int i = 0; i < 3; i++)
+  {
+    for(int j = 0; j < 3; j++)
+    {
+      ASSERT_EQ(matrix[i][j], array[index]);
+      index++;
+    }
+  }
+}
+
+TEST(Matrix3, FloatAndVectorConstructorsAgree)
+{
+  Matrix3 floats(1,2,3,4,5,6,7,8,9);
+  Matrix3 vectors(Vector3(1,2,3), Vector3(4,5,6), Vector3(7,8,9));
+
+  for(int i = 0; i < 3; i++)
+  {
+    for(int j = 0; j < 3; j++)
+    {
+      ASSERT_EQ(floats[i][j], i * 3 + j + 1);
+      ASSERT_EQ(vectors[i][j], floats[i][j]);
+    }
+  }
+}
+
+TEST(Matrix3, IsThreePaddedRows)
+{
+  EXPECT_EQ(sizeof(Matrix3), 48u);
+
+  Matrix3 matrix(1,2,3,4,5,6,7,8,9);
+  EXPECT_EQ(matrix.xPad, 0);
+  EXPECT_EQ(matrix.yPad, 0);
+  EXPECT_EQ(matrix.zPad, 0);
+}
+
+TEST(Matrix3, Transposition)
+{
+  Matrix3 matrix(1,2,3,4,5,6,7,8,9);
+  Matrix3 transpose = MMMatrix3Transpose(matrix);
+
+  for(int i = 0; i < 3; i++)
+    for(int j = 0; j < 3; j++)
+      ASSERT_EQ(transpose[i][j], matrix[j][i]);
+  EXPECT_EQ(transpose.xPad, 0);
+}
+
+TEST(Matrix3, Inversion)
+{
+  Matrix3 matrix(4,7,2,3,6,1,2,5,3);
+  float det = 0;
+  Matrix3 inverse = MMMatrix3Inverse(matrix, &det);
+
+  EXPECT_NEAR(det, 9.0f, 1e-5f);
+  EXPECT_NEAR(MMMatrix3Determinant(matrix), 9.0f, 1e-5f);
+  ExpectMatrixNear(inverse * matrix, Matrix3(), 1e-5f);
+  ExpectMatrixNear(matrix * inverse, Matrix3(), 1e-5f);
+}
+
+TEST(Matrix3, Multiplication)
+{
+  Matrix3 a(1,2,3,3,2,1,2,1,3);
+  Matrix3 b(4,5,6,6,5,4,4,6,5);
+
+  Matrix3 expected(28,33,29,28,31,31,26,33,31);
+  ExpectMatrixNear(a * b, expected, 0);
+}
+
+TEST(Matrix3, VectorMultiplication)
+{
+  Matrix3 matrix(1,2,3,3,2,1,2,1,3);
+  Vector3 result = matrix * Vector3(1,2,3);
+
+  EXPECT_EQ(result.x, 14);
+  EXPECT_EQ(result.y, 10);
+  EXPECT_EQ(result.z, 13);
+}
+
+TEST(Matrix3, Matrix4Conversion)
+{
+  Matrix4 m = TestMatrix(0.5f);
+  Matrix3 upper(m);
+  Matrix4 back = upper.ToMatrix4();
+
+  for(int i = 0; i < 3; i++)
+    for(int j = 0; j < 3; j++)
+      ASSERT_EQ(upper[i][j], m.m_data[i * 4 + j]);
+
+  Matrix4 expected = m;
+  expected.xw = expected.yw = expected.zw = 0;
+  for(int i = 0; i < 16; i++)
+    ASSERT_EQ(back.m_data[i], expected.m_data[i]);
+}
+
+TEST(Matrix3, NormalMatrixIsInverseTranspose)
+{
+  Matrix4 m = TestMatrix(1.5f);
+  Matrix3 expected = MMMatrix3Transpose(MMMatrix3Inverse(Matrix3(m)));
+
+  ExpectMatrixNear(MMMatrix3NormalMatrix(m), expected, 1e-5f);
+}
+
+TEST(Matrix3, QuaternionRoundTrip)
+{
+  Quaternion rotations[] = {
+    MMQuaternionNormalize(Quaternion(0.1f, 0.2f, 0.3f, 0.9f)),
+    MMQuaternionNormalize(Quaternion(0.9f, 0.1f, -0.2f, 0.05f)),
+    MMQuaternionNormalize(Quaternion(-0.1f, 0.8f, 0.3f, 0.1f)),
+    MMQuaternionNormalize(Quaternion(0.2f, -0.1f, 0.95f, -0.1f)),
+  };
+
+  for (const Quaternion& q : rotations)
+  {
+    Quaternion result = MMQuaternionFromMatrix3(MMMatrix3RotationQuaternion(q));
+    //q and -q are the same rotation
+    float sign = MMQuaternionDot(q, result) < 0 ? -1.0f : 1.0f;
+    EXPECT_NEAR(result.x * sign, q.x, 1e-5f);
+    EXPECT_NEAR(result.y * sign, q.y, 1e-5f);
+    EXPECT_NEAR(result.z * sign, q.z, 1e-5f);
+    EXPECT_NEAR(result.w * sign, q.w, 1e-5f);
+  }
+}
+
+TEST(Matrix3Static, StreamsMatchSingleCalls)
+{
+  const size_t count = 5;
+  Matrix4 sources[count];
+  Matrix3 a[count], b[count], out[count];
+  Vector3 vectors[count], transformed[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    sources[i] = TestMatrix(0.25f * i);
+    a[i] = Matrix3(sources[i]);
+    b[i] = Matrix3(TestMatrix(1.0f + i));
+    vectors[i] = Vector3(1.0f * i, -2.0f, 0.5f);
+  }
+
+  MMMatrix3MultiplyStream(out, a, b, count);
+  for (size_t i = 0; i < count; i++)
+    ExpectMatrixNear(out[i], a[i] * b[i], 0);
+
+  MMMatrix3InverseStream(out, a, count);
+  for (size_t i = 0; i < count; i++)
+    ExpectMatrixNear(out[i], MMMatrix3Inverse(a[i]), 0);
+
+  MMMatrix3NormalMatrixStream(out, sources, count);
+  for (size_t i = 0; i < count; i++)
+    ExpectMatrixNear(out[i], MMMatrix3NormalMatrix(sources[i]), 0);
+
+  MMMatrix3TransformStream(transformed, a[2], vectors, count);
+  for (size_t i = 0; i < count; i++)
+  {
+    Vector3 expected = a[2] * vectors[i];
+    EXPECT_EQ(transformed[i].x, expected.x);
+    EXPECT_EQ(transformed[i].y, expected.y);
+    EXPECT_EQ(transformed[i].z, expected.z);
+  }
+}
+
+TEST(Matrix3Static, OrthonormalizeMatchesMatrix4AndStream)
+{
+  const size_t count = 9;
+  Matrix3 matrices[count];
+  Matrix3 expected[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    Matrix4 m = TestMatrix(0.1f * i);
+    matrices[i] = Matrix3(m);
+    expected[i] = MMMatrix3Orthonormalize(matrices[i]);
+    ExpectMatrixNear(expected[i], Matrix3(MMMatrixOrthonormalize(m)), 1e-6f);
+    ExpectMatrixNear(MMMatrix3Transpose(expected[i]) * expected[i], Matrix3(), 1e-5f);
+  }
+
+  MMMatrix3OrthonormalizeStream(matrices, matrices, count);
+  for (size_t i = 0; i < count; i++)
+  {
+    ExpectMatrixNear(matrices[i], expected[i], 1e-6f);
+    EXPECT_EQ(MMVectorGetW(matrices[i].m_rows[2]), 0.0f);
+  }
+}
@@ -316,3 +316,359 @@ TEST(Matrix4Static, GetLookAtView)
   EXPECT_FLOAT_EQ(lookAt[3][2], 0.f);
   EXPECT_FLOAT_EQ(lookAt[3][3], 1.0f);
 }
+
+TEST(Matrix4Static, FastPrecisionProjectionsMatchExact)
+{
+  Matrix4 exactOrtho = MMMatrixOrthoProj(-50, 50, -25, 25, 0.1f, 100, MMPrecisionExact());
+  Matrix4 fastOrtho = MMMatrixOrthoProj(-50, 50, -25, 25, 0.1f, 100, MMPrecisionFast());
+  Matrix4 exactPersp = MMMatrixPerspProj(1.0f, 1280, 720, 0.1f, 1000, MMPrecisionExact());
+  Matrix4 fastPersp = MMMatrixPerspProj(1.0f, 1280, 720, 0.1f, 1000, MMPrecisionFast());
+
+  for (int i = 0; i < 4; i++)
+  {
+    for (int j = 0; j < 4; j++)
+    {
+      EXPECT_NEAR(fastOrtho[i][j], exactOrtho[i][j], fabsf(exactOrtho[i][j]) * 1e-6f);
+      EXPECT_NEAR(fastPersp[i][j], exactPersp[i][j], fabsf(exactPersp[i][j]) * 1e-6f);
+    }
+  }
+}
+
+TEST(Matrix4Static, AffineInverseMatchesGeneralInverse)
+{
+  Matrix4 affine = MMMatrixTranslation(Vector3(3, -1, 2)) * MMMatrixRotationXYZ(Vector3(0.3f, -0.7f, 1.1f)) *
+                   MMMatrixScale(Vector3(2, 0.5f, 4));
+
+  float generalDet = 0.0f;
+  float affineDet = 0.0f;
+  Matrix4 general = MMMatrixInverse(affine, &generalDet);
+  Matrix4 fast = MMMatrixInverseAffine(affine, &affineDet);
+
+  EXPECT_NEAR(generalDet, 4.0f, 1e-5f);
+  EXPECT_NEAR(affineDet, generalDet, 1e-5f);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      EXPECT_NEAR(fast[i][j], general[i][j], 1e-5f);
+}
+
+TEST(Matrix4Static, OrthonormalInverseMatchesGeneralInverse)
+{
+  Matrix4 rigid = MMMatrixTranslation(Vector3(-4, 5, 0.5f)) * MMMatrixRotationXYZ(Vector3(1.2f, 0.4f, -0.9f));
+
+  Matrix4 general = MMMatrixInverse(rigid);
+  Matrix4 fast = MMMatrixInverseOrthonormal(rigid);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      EXPECT_NEAR(fast[i][j], general[i][j], 1e-5f);
+}
+
+TEST(Matrix4Static, AutoInverseDetectsProjections)
+{
+  //a perspective projection has a non affine bottom row and must take the general path
+  Matrix4 proj = MMMatrixPerspProj(1.0f, 1280, 720, 0.1f, 1000);
+  Matrix4 view = MMMatrixTranslation(Vector3(1, 2, 3));
+
+  float det = 0.0f;
+  Matrix4 projInverse = MMMatrixInverseAuto(proj, &det);
+  Matrix4 expected = MMMatrixInverse(proj);
+  EXPECT_NE(det, 0.0f);
+  for (int i = 0; i < 4; i++)
+    for (int j = 0; j < 4; j++)
+      EXPECT_FLOAT_EQ(projInverse[i][j], expected[i][j]);
+
+  Matrix4 viewInverse = MMMatrixInverseAuto(view, &det);
+  EXPECT_FLOAT_EQ(det, 1.0f);
+  EXPECT_FLOAT_EQ(viewInverse[0][3], -1.0f);
+  EXPECT_FLOAT_EQ(viewInverse[1][3], -2.0f);
+  EXPECT_FLOAT_EQ(viewInverse[2][3], -3.0f);
+
+  //singular matrices report a zero determinant
+  MMMatrixInverseAuto(MMMatrixScale(Vector3(1, 0, 1)), &det);
+  EXPECT_EQ(det, 0.0f);
+}
+
+TEST(Matrix4Static, DecomposeRecoversTranslationRotationScale)
+{
+  Quaternion q = MMQuaternionNormalize(Quaternion(0.3f, -0.5f, 0.2f, 0.7f));
+  Vector3 t(1.0f, -2.0f, 3.5f);
+  Vector3 s(2.0f, 0.5f, 3.0f);
+  Matrix4 m = MMMatrixTranslation(t) * MMMatrixRotationQuaternion(q) * MMMatrixScale(s);
+
+  Vector3 outT, outS;
+  Quaternion outR;
+  ASSERT_TRUE(MMMatrixDecompose(m, outT, outR, outS));
+
+  EXPECT_TRUE(MMMaskAllTrue(MMVector3NearEqual(outT, t, 1e-5f), 7));
+  EXPECT_TRUE(MMMaskAllTrue(MMVector3NearEqual(outS, s, 1e-5f), 7));
+  float sign = MMQuaternionDot(outR, q) < 0 ? -1.0f : 1.0f;
+  EXPECT_NEAR(MMQuaternionDot(outR, q) * sign, 1.0f, 1e-5f);
+}
+
+TEST(Matrix4Static, DecomposeHandlesMirrorAndZeroScale)
+{
+  Quaternion q = MMQuaternionNormalize(Quaternion(0.1f, 0.6f, -0.3f, 0.5f));
+  Matrix4 mirrored = MMMatrixRotationQuaternion(q) * MMMatrixScale(Vector3(-1.5f, 2.0f, 1.0f));
+
+  Vector3 t, s;
+  Quaternion r;
+  ASSERT_TRUE(MMMatrixDecompose(mirrored, t, r, s));
+  EXPECT_NEAR(s.x, -1.5f, 1e-5f);
+  EXPECT_NEAR(s.y, 2.0f, 1e-5f);
+  EXPECT_NEAR(s.z, 1.0f, 1e-5f);
+
+  //rebuilding from the parts gives back the mirrored matrix
+  Matrix4 rebuilt = MMMatrixRotationQuaternion(r) * MMMatrixScale(s);
+  for (int i = 0; i < 16; i++)
+    EXPECT_NEAR(rebuilt.m_data[i], mirrored.m_data[i], 1e-5f) << "element " << i;
+
+  EXPECT_FALSE(MMMatrixDecompose(MMMatrixScale(Vector3(1.0f, 0.0f, 1.0f)), t, r, s));
+  EXPECT_TRUE(MMVectorEqual(r.m_quaternion, Quaternion().m_quaternion));
+}
+
+TEST(Matrix4Static, DecomposeStreamMatchesSingleCalls)
+{
+  const size_t count = 4;
+  Matrix4 in[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    Quaternion q = MMQuaternionNormalize(Quaternion(0.2f * i, 0.4f, -0.1f, 0.9f));
+    in[i] = MMMatrixTranslation(Vector3(1.0f * i, 2.0f, 0.0f)) * MMMatrixRotationQuaternion(q) *
+            MMMatrixScale(Vector3(1.0f + i, 1.0f, 0.5f));
+  }
+
+  Vector3 t[count], s[count];
+  Quaternion r[count];
+  MMMatrixDecomposeStream(t, r, s, in, count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    Vector3 expectedT, expectedS;
+    Quaternion expectedR;
+    MMMatrixDecompose(in[i], expectedT, expectedR, expectedS);
+    EXPECT_TRUE(MMVectorEqual(t[i].m_vector, expectedT.m_vector));
+    EXPECT_TRUE(MMVectorEqual(s[i].m_vector, expectedS.m_vector));
+    EXPECT_TRUE(MMVectorEqual(r[i].m_quaternion, expectedR.m_quaternion));
+  }
+}
+
+namespace
+{
+    void ExpectIdentity(const Matrix4& m, float epsilon)
+    {
+        for (int i = 0; i < 4; i++)
+          for (int j = 0; j < 4; j++)
+            EXPECT_NEAR(m.m_data[i * 4 + j], i == j ? 1.0f : 0.0f, epsilon) << "element " << i << "," << j;
+    }
+
+    float ProjectedDepth(const Matrix4& proj, float distance)
+    {
+        Vector4 clip = proj * Vector4(0.0f, 0.0f, -distance, 1.0f);
+        return clip.z / clip.w;
+    }
+}
+
+TEST(Matrix4Static, DepthRangeProjectionsCarryTheirInverse)
+{
+  const MMDepthRange ranges[] = { MM_DEPTH_NEGATIVE_ONE_TO_ONE, MM_DEPTH_ZERO_TO_ONE, MM_DEPTH_REVERSED };
+  const float nearDepth[] = { -1.0f, 0.0f, 1.0f };
+  const float farDepth[] = { 1.0f, 1.0f, 0.0f };
+
+  for (int i = 0; i < 3; i++)
+  {
+    Matrix4 inverse;
+    Matrix4 persp = MMMatrixPerspProj(1.2f, 1920.0f, 1080.0f, 0.5f, 200.0f, ranges[i], &inverse);
+    ExpectIdentity(persp * inverse, 1e-5f);
+    ExpectIdentity(inverse * persp, 1e-5f);
+    EXPECT_NEAR(ProjectedDepth(persp, 0.5f), nearDepth[i], 1e-5f);
+    EXPECT_NEAR(ProjectedDepth(persp, 200.0f), farDepth[i], 1e-5f);
+
+    Matrix4 ortho = MMMatrixOrthoProj(-4.0f, 6.0f, -3.0f, 2.0f, 0.5f, 50.0f, ranges[i], &inverse);
+    ExpectIdentity(ortho * inverse, 1e-5f);
+    EXPECT_NEAR(ProjectedDepth(ortho, 0.5f), nearDepth[i], 1e-5f);
+    EXPECT_NEAR(ProjectedDepth(ortho, 50.0f), farDepth[i], 1e-5f);
+
+    Matrix4 infinite = MMMatrixPerspProjInfinite(1.2f, 1920.0f, 1080.0f, 0.5f, ranges[i], &inverse);
+    ExpectIdentity(infinite * inverse, 1e-5f);
+    EXPECT_NEAR(ProjectedDepth(infinite, 0.5f), nearDepth[i], 1e-5f);
+    EXPECT_NEAR(ProjectedDepth(infinite, 1e7f), farDepth[i], 1e-5f);
+  }
+
+  //the default convention matches the legacy builder
+  Matrix4 legacy = MMMatrixPerspProj(1.2f, 1920.0f, 1080.0f, 0.5f, 200.0f);
+  Matrix4 ranged = MMMatrixPerspProj(1.2f, 1920.0f, 1080.0f, 0.5f, 200.0f, MM_DEPTH_NEGATIVE_ONE_TO_ONE);
+  for (int i = 0; i < 16; i++)
+    EXPECT_NEAR(ranged.m_data[i], legacy.m_data[i], 1e-6f) << "element " << i;
+}
+
+TEST(Matrix4Static, UnprojectRecoversViewPositions)
+{
+  Matrix4 inverse;
+  Matrix4 proj = MMMatrixPerspProj(1.0f, 800.0f, 600.0f, 0.1f, 100.0f, MM_DEPTH_REVERSED, &inverse);
+
+  const size_t count = 3;
+  Vector3 positions[count] = { Vector3(1.0f, -2.0f, -5.0f), Vector3(0.0f, 0.0f, -0.1f), Vector3(-20.0f, 10.0f, -90.0f) };
+  Vector3 ndc[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    Vector4 clip = proj * Vector4(positions[i].x, positions[i].y, positions[i].z, 1.0f);
+    ndc[i] = Vector3(clip.x / clip.w, clip.y / clip.w, clip.z / clip.w);
+    EXPECT_TRUE(MMMaskAllTrue(MMVector3NearEqual(MMMatrixUnproject(inverse, ndc[i]), positions[i], 1e-3f), 7));
+  }
+
+  Vector3 out[count];
+  MMMatrixUnprojectStream(out, inverse, ndc, count);
+  for (size_t i = 0; i < count; i++)
+    EXPECT_TRUE(MMMaskAllTrue(MMVector3NearEqual(out[i], MMMatrixUnproject(inverse, ndc[i]), 1e-6f), 7));
+}
+
+TEST(Matrix4Static, UnprojectRayWorksWithInfiniteFar)
+{
+  Matrix4 inverse;
+  MMMatrixPerspProjInfinite(1.0f, 800.0f, 600.0f, 0.1f, MM_DEPTH_REVERSED, &inverse);
+
+  Vector3 origin, direction;
+  MMMatrixUnprojectRay(inverse, 0.0f, 0.0f, MM_DEPTH_REVERSED, origin, direction);
+  EXPECT_TRUE(MMMaskAllTrue(MMVector3NearEqual(origin, Vector3(0.0f, 0.0f, -0.1f), 1e-5f), 7));
+  EXPECT_TRUE(MMMaskAllTrue(MMVector3NearEqual(direction, Vector3(0.0f, 0.0f, -1.0f), 1e-5f), 7));
+
+  MMMatrixUnprojectRay(inverse, 1.0f, 0.0f, MM_DEPTH_REVERSED, origin, direction);
+  EXPECT_GT(direction.x, 0.0f);
+  EXPECT_LT(direction.z, 0.0f);
+  EXPECT_NEAR(MMVector3Magnitude(direction), 1.0f, 1e-5f);
+}
+
+TEST(Matrix4Static, DeterminantMatchesInverseDeterminant)
+{
+  Matrix4 lower(2, 0, 0, 0,
+                1, 3, 0, 0,
+                7, -2, 4, 0,
+                1, 2, 3, 5);
+  EXPECT_FLOAT_EQ(MMMatrixDeterminant(lower), 120.0f);
+  EXPECT_FLOAT_EQ(MMMatrixDeterminant3x3(lower), 24.0f);
+  EXPECT_TRUE(MMVectorEqual(MMMatrixDeterminantV(lower), MMVectorSplat(120.0f)));
+
+  Matrix4 general(1, 2, -1, 3,
+                  0.5f, -4, 2, 1,
+                  3, 1, 1, -2,
+                  -1, 0.25f, 2, 6);
+  float inverseDet = 0.0f;
+  MMMatrixInverse(general, &inverseDet);
+  EXPECT_NEAR(MMMatrixDeterminant(general), inverseDet, 1e-3f);
+
+  Matrix4 proj = MMMatrixPerspProj(1.0f, 1280, 720, 0.1f, 1000);
+  MMMatrixInverse(proj, &inverseDet);
+  EXPECT_NEAR(MMMatrixDeterminant(proj), inverseDet, std::fabs(inverseDet) * 1e-5f);
+}
+
+TEST(Matrix4Static, Determinant3x3DetectsMirroring)
+{
+  Matrix4 rotation = MMMatrixTranslation(Vector3(5, 0, -2)) * MMMatrixRotationXYZ(Vector3(0.4f, 1.0f, -0.3f));
+  EXPECT_NEAR(MMMatrixDeterminant3x3(rotation), 1.0f, 1e-5f);
+
+  Matrix4 mirrored = rotation * MMMatrixScale(Vector3(1, -2, 1));
+  EXPECT_NEAR(MMMatrixDeterminant3x3(mirrored), -2.0f, 1e-5f);
+  EXPECT_NEAR(MMMatrixDeterminant(mirrored), -2.0f, 1e-5f);
+}
+
+TEST(Matrix4Static, IsAffineChecksBottomRow)
+{
+  EXPECT_TRUE(MMMatrixIsAffine(Matrix4()));
+  EXPECT_TRUE(MMMatrixIsAffine(MMMatrixTranslation(Vector3(1, 2, 3)) * MMMatrixScale(Vector3(2, 2, 2))));
+  EXPECT_FALSE(MMMatrixIsAffine(MMMatrixPerspProj(1.0f, 1280, 720, 0.1f, 1000)));
+}
+
+TEST(Matrix4Static, DeterminantAndMaskStreamsMatchSingleCalls)
+{
+  const size_t count = 45;
+  std::vector<Matrix4> matrices(count);
+  for (size_t i = 0; i < count; i++)
+  {
+    float f = float(i);
+    Vector3 scale(1.0f + 0.1f * f, (i % 3 == 0) ? -1.0f : 0.5f, (i % 7 == 0) ? 0.0f : 2.0f);
+    matrices[i] = MMMatrixTranslation(Vector3(f, -f, 1)) * MMMatrixRotationXYZ(Vector3(0.1f * f, 0.3f, -0.2f * f)) *
+                  MMMatrixScale(scale);
+    if (i % 5 == 0)
+      matrices[i] = MMMatrixPerspProj(1.0f, 1280, 720, 0.1f, 100) * matrices[i];
+  }
+
+  std::vector<float> dets(count);
+  MMMatrixDeterminantStream(dets.data(), matrices.data(), count);
+
+  const size_t words = (count + 31) / 32;
+  std::vector<uint32_t> singular(words, 0xFFFFFFFF), mirror(words, 0xFFFFFFFF), affine(words, 0xFFFFFFFF);
+  MMMatrixSingularMaskStream(singular.data(), matrices.data(), count, 1e-6f);
+  MMMatrixMirrorMaskStream(mirror.data(), matrices.data(), count);
+  MMMatrixAffineMaskStream(affine.data(), matrices.data(), count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    float det = MMMatrixDeterminant(matrices[i]);
+    EXPECT_NEAR(dets[i], det, std::fabs(det) * 1e-5f + 1e-6f);
+    EXPECT_EQ(((singular[i / 32] >> (i % 32)) & 1) != 0, std::fabs(det) <= 1e-6f) << i;
+    //the sign of a zero determinant depends on rounding, only compare clear cases
+    float det3x3 = MMMatrixDeterminant3x3(matrices[i]);
+    if (std::fabs(det3x3) > 1e-6f)
+    {
+      EXPECT_EQ(((mirror[i / 32] >> (i % 32)) & 1) != 0, det3x3 < 0.0f) << i;
+    }
+    EXPECT_EQ(((affine[i / 32] >> (i % 32)) & 1) != 0, MMMatrixIsAffine(matrices[i])) << i;
+  }
+  //bits past count are cleared
+  EXPECT_EQ(singular[words - 1] >> (count % 32), 0u);
+  EXPECT_EQ(affine[words - 1] >> (count % 32), 0u);
+}
+
+TEST(Matrix4Static, OrthonormalizeRepairsDriftedRotation)
+{
+  Matrix4 rotation = MMMatrixRotationXYZ(Vector3(0.7f, -0.2f, 1.4f));
+  Matrix4 shear(1, 0.01f, 0, 0,
+                -0.02f, 1, 0.015f, 0,
+                0, 0.01f, 1, 0,
+                0, 0, 0, 1);
+  Matrix4 drifted = MMMatrixTranslation(Vector3(4, -3, 2)) * rotation * shear * MMMatrixScale(Vector3(1.01f, 0.99f, 1.02f));
+  drifted.m_rows[3] = MMVectorSet(0.1f, 0.2f, 0.3f, 1.0f);
+
+  Matrix4 repaired = MMMatrixOrthonormalize(drifted);
+  Matrix4 transpose = MMMatrixTranspose(repaired);
+  for (int i = 0; i < 3; i++)
+    for (int j = 0; j < 3; j++)
+      EXPECT_NEAR(MMVector3Dot(Vector3(transpose[i][0], transpose[i][1], transpose[i][2]),
+                               Vector3(transpose[j][0], transpose[j][1], transpose[j][2])), i == j ? 1.0f : 0.0f, 1e-6f);
+
+  //x keeps its direction and the result stays close to the undrifted rotation
+  float xLength = std::sqrt(drifted[0][0] * drifted[0][0] + drifted[1][0] * drifted[1][0] + drifted[2][0] * drifted[2][0]);
+  for (int i = 0; i < 3; i++)
+  {
+    EXPECT_NEAR(repaired[i][0], drifted[i][0] / xLength, 1e-6f);
+    for (int j = 0; j < 3; j++)
+      EXPECT_NEAR(repaired[i][j], rotation[i][j], 0.05f);
+  }
+  for (int i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(repaired[i][3], drifted[i][3]);
+    EXPECT_EQ(repaired[3][i], drifted[3][i]);
+  }
+
+  Matrix4 mirrored = MMMatrixOrthonormalize(drifted * MMMatrixScale(Vector3(1, 1, -1)));
+  EXPECT_NEAR(MMMatrixDeterminant3x3(mirrored), -1.0f, 1e-5f);
+}
+
+TEST(Matrix4Static, OrthonormalizeStreamMatchesSingleCalls)
+{
+  const size_t count = 11;
+  Matrix4 matrices[count];
+  Matrix4 expected[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    float f = float(i);
+    matrices[i] = MMMatrixTranslation(Vector3(f, 1, -f)) * MMMatrixRotationXYZ(Vector3(0.3f * f, -0.1f, 0.2f)) *
+                  MMMatrixScale(Vector3(1.0f + 0.01f * f, 0.98f, 1.03f));
+    expected[i] = MMMatrixOrthonormalize(matrices[i]);
+  }
+
+  MMMatrixOrthonormalizeStream(matrices, matrices, count);
+  for (size_t i = 0; i < count; i++)
+    for (int r = 0; r < 4; r++)
+      for (int c = 0; c < 4; c++)
+        EXPECT_NEAR(matrices[i][r][c], expected[i][r][c], 1e-6f);
+}
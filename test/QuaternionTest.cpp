@@ -78,7 +78,7 @@ TEST(Quaternion, EulerAnglesConstructorCreatesAppropriateQuaternion)
 
 TEST(Quaternion, ExistingM128ConstructorCreatesAppropriateQuaternion)
 {
-	__m128 data = MMVectorSet(1.f, 2.f, 3.f, 4.f);
+	MMFloat4 data = MMVectorSet(1.f, 2.f, 3.f, 4.f);
 	
 	Quaternion quat(data);
 
@@ -269,10 +269,10 @@ TEST(Quaternion, ConversionOperatorReturnsInternalM128InExpectedOrder)
 	}
 	Quaternion quatA = Quaternion(valueArray[0], valueArray[1], valueArray[2], valueArray[3]);
 
-	__m128 result = static_cast<__m128>(quatA);
+	MMFloat4 result = static_cast<MMFloat4>(quatA);
 
 	_MM_ALIGN16 float actualArray[4];
-	_mm_store_ps(actualArray, result);
+	MMVectorStore(actualArray, result);
 	for (size_t i = 0; i < 4; ++i)
 	{
 		EXPECT_FLOAT_EQ(valueArray[i], actualArray[i]);
@@ -438,3 +438,104 @@ TEST(Quaternion, ConjugateReturnsAppropriateQuaternion)
 	EXPECT_FLOAT_EQ(actualQuat.y, expectedArray[1]);
 	EXPECT_FLOAT_EQ(actualQuat.z, expectedArray[2]);
 }
+
+TEST(QuaternionStatic, NearEqualAndSelect)
+{
+  Quaternion q(0.0f, 0.0f, 0.0f, 1.0f);
+  Quaternion r(0.0f, 0.0f, 0.0001f, 1.0f);
+
+  EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(q, r, 0.001f)));
+  EXPECT_FALSE(MMQuaternionAllTrue(MMQuaternionNearEqual(q, r, 0.00001f)));
+
+  Quaternion selected = MMQuaternionSelect(MMQuaternionIsInf(q), r, q);
+  EXPECT_TRUE(selected == q);
+}
+
+TEST(QuaternionStatic, DotVMatchesScalarDot)
+{
+  Quaternion q(1.0f, 2.0f, 3.0f, 4.0f);
+  Quaternion r(0.5f, -1.0f, 2.0f, 1.0f);
+
+  MMFloat4 dot = MMQuaternionDotV(q, r);
+
+  EXPECT_FLOAT_EQ(MMVectorGetX(dot), MMQuaternionDot(q, r));
+  EXPECT_FLOAT_EQ(MMVectorGetW(dot), 8.5f);
+  EXPECT_FLOAT_EQ(MMVectorGetX(MMQuaternionMagnitudeV(q)), sqrtf(30.0f));
+}
+
+TEST(QuaternionStatic, FromMatrixPicksStableCandidate)
+{
+  //one rotation per Shepperd branch, plus 180 degree turns that zero w
+  Quaternion rotations[] = {
+    MMQuaternionNormalize(Quaternion(0.1f, 0.2f, 0.3f, 0.9f)),
+    MMQuaternionNormalize(Quaternion(0.9f, 0.1f, -0.2f, 0.05f)),
+    MMQuaternionNormalize(Quaternion(-0.1f, 0.8f, 0.3f, 0.1f)),
+    MMQuaternionNormalize(Quaternion(0.2f, -0.1f, 0.95f, -0.1f)),
+    Quaternion(1.0f, 0.0f, 0.0f, 0.0f),
+    Quaternion(0.0f, 0.0f, 1.0f, 0.0f),
+    Quaternion(),
+  };
+
+  for (const Quaternion& q : rotations)
+  {
+    Matrix4 m = MMMatrixRotationQuaternion(q);
+    Quaternion fromMatrix = MMQuaternionFromMatrix(m);
+    Quaternion fromAffine = MMQuaternionFromAffine(AffineTransform(m));
+    Quaternion fromMatrix3 = MMQuaternionFromMatrix3(Matrix3(m));
+
+    //q and -q are the same rotation
+    EXPECT_NEAR(fabsf(MMQuaternionDot(fromMatrix, q)), 1.0f, 1e-5f);
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(fromAffine, fromMatrix, 0)));
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(fromMatrix3, fromMatrix, 0)));
+  }
+}
+
+TEST(QuaternionStatic, FromMatrixStreamsMatchSingleCalls)
+{
+  const size_t count = 6;
+  Matrix4 matrices[count];
+  AffineTransform affines[count];
+  Matrix3 matrix3s[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    matrices[i] = MMMatrixRotationQuaternion(MMQuaternionNormalize(Quaternion(0.3f * i - 0.5f, 0.2f, -0.4f * i, 0.1f * i)));
+    affines[i] = AffineTransform(matrices[i]);
+    matrix3s[i] = Matrix3(matrices[i]);
+  }
+
+  Quaternion out[count];
+  MMQuaternionFromMatrixStream(out, matrices, count);
+  for (size_t i = 0; i < count; i++)
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(out[i], MMQuaternionFromMatrix(matrices[i]), 0)));
+
+  MMQuaternionFromAffineStream(out, affines, count);
+  for (size_t i = 0; i < count; i++)
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(out[i], MMQuaternionFromAffine(affines[i]), 0)));
+
+  MMQuaternionFromMatrix3Stream(out, matrix3s, count);
+  for (size_t i = 0; i < count; i++)
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(out[i], MMQuaternionFromMatrix3(matrix3s[i]), 0)));
+}
+
+TEST(QuaternionStatic, RenormalizeStreamOnlyRewritesDriftedElements)
+{
+  const size_t count = 13;
+  Quaternion quats[count];
+  for (size_t i = 0; i < count; i++)
+  {
+    quats[i] = MMQuaternionNormalize(Quaternion(0.3f * i - 0.5f, 0.2f, -0.4f * i, 0.1f * i + 0.5f), MMPrecisionExact());
+    if (i % 4 == 1 || i == count - 1)
+      quats[i] = Quaternion(MMVectorMul(quats[i].m_quaternion, MMVectorSplat(1.01f)));
+  }
+
+  //an unnormalized element inside the tolerance is left bit for bit alone
+  quats[2] = Quaternion(MMVectorMul(quats[2].m_quaternion, MMVectorSplat(1.00001f)));
+  Quaternion untouched = quats[2];
+
+  size_t rewritten = MMQuaternionRenormalizeStream(quats, count, 1e-3f);
+  EXPECT_EQ(rewritten, 4u);
+  for (size_t i = 0; i < count; i++)
+    EXPECT_NEAR(MMQuaternionDot(quats[i], quats[i]), 1.0f, 1e-3f);
+  EXPECT_TRUE(quats[2] == untouched);
+  EXPECT_EQ(MMQuaternionRenormalizeStream(quats, count, 1e-3f), 0u);
+}
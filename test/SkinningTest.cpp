@@ -0,0 +1,162 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    const size_t boneCount = 6;
+
+    void MakePalette(AffineTransform* palette)
+    {
+        for (size_t b = 0; b < boneCount; b++)
+        {
+            float angle = 0.4f * float(b) + 0.1f;
+            Quaternion q = MMQuaternionNormalize(Quaternion(std::sin(angle), 0.3f, std::cos(angle), 1.0f));
+            palette[b] = MMAffineTranslation(Vector3(float(b), -0.5f * float(b), 2.0f)) * MMAffineRotationQuaternion(q);
+        }
+    }
+
+    struct SkinData
+    {
+        std::vector<Vector3>  positions;
+        std::vector<Vector3>  normals;
+        std::vector<uint32_t> indices;
+        std::vector<float>    weights;
+    };
+
+    SkinData MakeVertices(size_t count)
+    {
+        SkinData data;
+        for (size_t i = 0; i < count; i++)
+        {
+            float f = float(i);
+            data.positions.push_back(Vector3(std::sin(f), std::cos(f * 0.7f), f * 0.01f));
+            data.normals.push_back(MMVector3Normalized(Vector3(std::cos(f), 1.0f, std::sin(f * 0.3f))));
+
+            float total = 0.0f;
+            float w[4];
+            for (size_t k = 0; k < 4; k++)
+            {
+                w[k] = float((i + k * 3) % 4);
+                total += w[k];
+            }
+            for (size_t k = 0; k < 4; k++)
+            {
+                data.indices.push_back(uint32_t((i + k * 5) % boneCount));
+                data.weights.push_back(w[k] / total);
+            }
+        }
+        return data;
+    }
+
+    //Per influence Matrix4 transforms summed by weight, the loop the kernel replaces
+    Vector3 ReferenceSkin(const AffineTransform* palette, const SkinData& data, size_t i, const Vector3& v, float w)
+    {
+        Vector4 sum(0.0f, 0.0f, 0.0f, 0.0f);
+        for (size_t k = 0; k < 4; k++)
+        {
+            Matrix4 bone = palette[data.indices[i * 4 + k]].ToMatrix4();
+            sum = sum + bone * Vector4(v.x, v.y, v.z, w) * data.weights[i * 4 + k];
+        }
+        return Vector3(sum.x, sum.y, sum.z);
+    }
+}
+
+TEST(SkinningStatic, SkinStreamMatchesPerInfluenceTransforms)
+{
+  AffineTransform palette[boneCount];
+  MakePalette(palette);
+  const size_t count = 37;
+  SkinData data = MakeVertices(count);
+
+  std::vector<Vector3> positions(count), normals(count);
+  MMSkinStream(positions.data(), normals.data(), palette, data.positions.data(), data.normals.data(),
+               data.indices.data(), data.weights.data(), count, false);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    Vector3 p = ReferenceSkin(palette, data, i, data.positions[i], 1.0f);
+    Vector3 n = ReferenceSkin(palette, data, i, data.normals[i], 0.0f);
+    EXPECT_NEAR(positions[i].x, p.x, 1e-4f);
+    EXPECT_NEAR(positions[i].y, p.y, 1e-4f);
+    EXPECT_NEAR(positions[i].z, p.z, 1e-4f);
+    EXPECT_NEAR(normals[i].x, n.x, 1e-4f);
+    EXPECT_NEAR(normals[i].y, n.y, 1e-4f);
+    EXPECT_NEAR(normals[i].z, n.z, 1e-4f);
+  }
+}
+
+TEST(SkinningStatic, SkinStreamRenormalizesNormals)
+{
+  AffineTransform palette[boneCount];
+  MakePalette(palette);
+  const size_t count = 16;
+  SkinData data = MakeVertices(count);
+
+  std::vector<Vector3> positions(count), normals(count);
+  MMSkinStream(positions.data(), normals.data(), palette, data.positions.data(), data.normals.data(),
+               data.indices.data(), data.weights.data(), count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    Vector3 n = ReferenceSkin(palette, data, i, data.normals[i], 0.0f);
+    EXPECT_NEAR(MMVector3Magnitude(normals[i]), 1.0f, 1e-3f);
+    EXPECT_NEAR(MMVector3Dot(normals[i], n) / MMVector3Magnitude(n), 1.0f, 1e-3f);
+  }
+}
+
+TEST(SkinningStatic, SkinStreamSkipsMissingNormalsAndAllowsAliasing)
+{
+  AffineTransform palette[boneCount];
+  MakePalette(palette);
+  const size_t count = 9;
+  SkinData data = MakeVertices(count);
+
+  std::vector<Vector3> expected(count);
+  MMSkinStream(expected.data(), nullptr, palette, data.positions.data(), nullptr,
+               data.indices.data(), data.weights.data(), count);
+
+  MMSkinStream(data.positions.data(), nullptr, palette, data.positions.data(), nullptr,
+               data.indices.data(), data.weights.data(), count);
+  EXPECT_EQ(0, std::memcmp(expected.data(), data.positions.data(), count * sizeof(Vector3)));
+}
+
+TEST(SkinningStatic, ParallelSkinStreamMatchesSingleThreaded)
+{
+  AffineTransform palette[boneCount];
+  MakePalette(palette);
+  const size_t count = 10007;
+  SkinData data = MakeVertices(count);
+
+  std::vector<Vector3> positions(count), normals(count);
+  MMSkinStream(positions.data(), normals.data(), palette, data.positions.data(), data.normals.data(),
+               data.indices.data(), data.weights.data(), count);
+
+  MMWorkerPool pool(3);
+  std::vector<Vector3> parallelPositions(count), parallelNormals(count);
+  MMSkinStream(pool, parallelPositions.data(), parallelNormals.data(), palette, data.positions.data(), data.normals.data(),
+               data.indices.data(), data.weights.data(), count, true, 256);
+
+  EXPECT_EQ(0, std::memcmp(positions.data(), parallelPositions.data(), count * sizeof(Vector3)));
+  EXPECT_EQ(0, std::memcmp(normals.data(), parallelNormals.data(), count * sizeof(Vector3)));
+}
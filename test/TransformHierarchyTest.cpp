@@ -0,0 +1,226 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+namespace
+{
+    Matrix4 LocalMatrix(const TransformHierarchy& h, TransformNode node)
+    {
+        return MMMatrixTranslation(h.Translation(node)) * MMMatrixRotationQuaternion(h.Rotation(node)) *
+               MMMatrixScale(h.Scale(node));
+    }
+
+    //Reference world matrix by walking the parent chain
+    Matrix4 ExpectedWorld(const TransformHierarchy& h, TransformNode node)
+    {
+        Matrix4 world = LocalMatrix(h, node);
+        for (TransformNode p = h.Parent(node); p != invalidTransformNode; p = h.Parent(p))
+            world = LocalMatrix(h, p) * world;
+        return world;
+    }
+
+    void ExpectWorldsMatch(const TransformHierarchy& h, float epsilon)
+    {
+        for (TransformNode node = 0; node < h.Size(); node++)
+        {
+            Matrix4 expected = ExpectedWorld(h, node);
+            for (int i = 0; i < 16; i++)
+              ASSERT_NEAR(h.World(node).m_data[i], expected.m_data[i], epsilon) << "node " << node << " element " << i;
+        }
+    }
+
+    void ExpectBreadthFirst(const TransformHierarchy& h)
+    {
+        const uint32_t* parents = h.ParentIndices();
+        for (uint32_t level = 0; level < h.LevelCount(); level++)
+        {
+            for (uint32_t i = h.LevelBegin(level); i < h.LevelBegin(level + 1); i++)
+            {
+                if (level == 0)
+                    ASSERT_EQ(parents[i], invalidTransformNode);
+                else
+                {
+                    ASSERT_GE(parents[i], h.LevelBegin(level - 1));
+                    ASSERT_LT(parents[i], h.LevelBegin(level));
+                }
+            }
+        }
+        EXPECT_EQ(h.LevelBegin(h.LevelCount()), h.Size());
+    }
+
+    Quaternion TestRotation(float seed)
+    {
+        return MMQuaternionNormalize(Quaternion(0.3f * seed, -0.2f, 0.1f + seed, 0.9f));
+    }
+}
+
+TEST(TransformHierarchy, WorldIsParentTimesLocal)
+{
+  TransformHierarchy h;
+  TransformNode root = h.Add(invalidTransformNode, Vector3(1.0f, 2.0f, 3.0f), TestRotation(0.5f), Vector3(2.0f, 2.0f, 2.0f));
+  TransformNode child = h.Add(root, Vector3(0.0f, 1.0f, 0.0f), TestRotation(1.0f), Vector3(1.0f, 0.5f, 1.0f));
+  TransformNode grandChild = h.Add(child, Vector3(-1.0f, 0.0f, 2.0f), TestRotation(-0.5f), Vector3(1.0f, 1.0f, 3.0f));
+  h.Add(root);
+
+  h.Update();
+  ExpectWorldsMatch(h, 1e-5f);
+  EXPECT_EQ(h.Parent(grandChild), child);
+  EXPECT_EQ(h.World(grandChild).wx, 0.0f);
+  EXPECT_EQ(h.World(grandChild).ww, 1.0f);
+}
+
+TEST(TransformHierarchy, OnlyDirtySubtreesChange)
+{
+  TransformHierarchy h;
+  TransformNode a = h.Add();
+  TransformNode b = h.Add();
+  TransformNode aChild = h.Add(a, Vector3(1.0f, 0.0f, 0.0f), Quaternion(), Vector3(1.0f, 1.0f, 1.0f));
+  TransformNode bChild = h.Add(b, Vector3(0.0f, 1.0f, 0.0f), Quaternion(), Vector3(1.0f, 1.0f, 1.0f));
+  h.Update();
+
+  Matrix4 bChildWorld = h.World(bChild);
+  h.SetTranslation(a, Vector3(0.0f, 0.0f, 5.0f));
+  h.Update();
+
+  EXPECT_EQ(h.World(aChild).zw, 5.0f);
+  EXPECT_EQ(h.World(aChild).xw, 1.0f);
+  for (int i = 0; i < 16; i++)
+    EXPECT_EQ(h.World(bChild).m_data[i], bChildWorld.m_data[i]);
+  ExpectWorldsMatch(h, 1e-6f);
+}
+
+TEST(TransformHierarchy, StaysBreadthFirstThroughAddAndReparent)
+{
+  TransformHierarchy h;
+  TransformNode root = h.Add();
+  TransformNode chain[5] = { root };
+  for (int i = 1; i < 5; i++)
+    chain[i] = h.Add(chain[i - 1], Vector3(1.0f, 0.0f, 0.0f), TestRotation(0.1f * i), Vector3(1.0f, 1.0f, 1.0f));
+
+  //a shallow node added after deep ones forces a re-sort
+  TransformNode shallow = h.Add(root, Vector3(0.0f, 2.0f, 0.0f), TestRotation(2.0f), Vector3(1.0f, 1.0f, 1.0f));
+  h.Update();
+  ExpectBreadthFirst(h);
+  EXPECT_EQ(h.LevelCount(), 5u);
+  ExpectWorldsMatch(h, 1e-4f);
+
+  //moving the deepest node under the shallow one and the shallow one under a deep one
+  h.Reparent(chain[4], shallow);
+  h.Reparent(shallow, chain[2]);
+  h.Update();
+  ExpectBreadthFirst(h);
+  EXPECT_EQ(h.Parent(chain[4]), shallow);
+  EXPECT_EQ(h.LevelCount(), 5u);
+  ExpectWorldsMatch(h, 1e-4f);
+
+  h.Reparent(shallow, invalidTransformNode);
+  h.Update();
+  ExpectBreadthFirst(h);
+  EXPECT_EQ(h.Parent(shallow), invalidTransformNode);
+  ExpectWorldsMatch(h, 1e-4f);
+}
+
+TEST(TransformHierarchy, HandlesSurviveReordering)
+{
+  TransformHierarchy h;
+  TransformNode root = h.Add();
+  TransformNode deep = h.Add(h.Add(root));
+  TransformNode late = h.Add(invalidTransformNode, Vector3(7.0f, 0.0f, 0.0f), Quaternion(), Vector3(1.0f, 1.0f, 1.0f));
+  h.Update();
+
+  EXPECT_LT(h.IndexOf(late), h.IndexOf(deep));
+  EXPECT_EQ(h.World(late).xw, 7.0f);
+  EXPECT_EQ(h.Translation(late).x, 7.0f);
+  EXPECT_EQ(h.Parent(h.Parent(deep)), root);
+}
+
+namespace
+{
+    //Wide random tree with a few deep chains, built so later nodes hang off earlier ones
+    void BuildRandomTree(TransformHierarchy& h, uint32_t count, uint32_t seed)
+    {
+        uint32_t state = seed;
+        auto next = [&state]() { state = state * 1664525u + 1013904223u; return state >> 8; };
+        auto unit = [&next]() { return (next() % 2001) / 1000.0f - 1.0f; };
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            TransformNode parent = i < 4 ? invalidTransformNode : (i % 97 == 0 ? i - 1 : next() % i);
+            Quaternion r = MMQuaternionNormalize(Quaternion(unit(), unit(), unit(), 1.5f));
+            h.Add(parent, Vector3(unit(), unit(), unit()), r, Vector3(1.0f + 0.1f * unit(), 1.0f, 1.0f));
+        }
+    }
+
+    void ExpectBitIdentical(const TransformHierarchy& a, const TransformHierarchy& b)
+    {
+        ASSERT_EQ(a.Size(), b.Size());
+        for (size_t i = 0; i < a.Size(); i++)
+          ASSERT_EQ(memcmp(&a.WorldMatrices()[i], &b.WorldMatrices()[i], sizeof(Matrix4)), 0) << "index " << i;
+    }
+}
+
+TEST(MMWorkerPool, ParallelForRunsEveryTaskOnce)
+{
+  MMWorkerPool pool(3);
+  EXPECT_EQ(pool.ThreadCount(), 4u);
+
+  for (int round = 0; round < 20; round++)
+  {
+    const size_t count = 1000 + round;
+    std::vector<std::atomic<int>> hits(count);
+    for (auto& hit : hits)
+      hit.store(0);
+
+    pool.ParallelFor(count, [&hits](size_t task) { hits[task]++; });
+    for (size_t i = 0; i < count; i++)
+      ASSERT_EQ(hits[i].load(), 1) << "task " << i;
+  }
+
+  MMWorkerPool inlinePool(0);
+  size_t sum = 0;
+  inlinePool.ParallelFor(10, [&sum](size_t task) { sum += task; });
+  EXPECT_EQ(sum, 45u);
+}
+
+TEST(TransformHierarchy, ParallelUpdateIsBitIdentical)
+{
+  TransformHierarchy serial, parallel;
+  BuildRandomTree(serial, 20000, 7);
+  BuildRandomTree(parallel, 20000, 7);
+
+  MMWorkerPool pool(3);
+  serial.Update();
+  parallel.Update(pool, 64);
+  ExpectBitIdentical(serial, parallel);
+
+  //partial updates only touch the dirty subtrees on both paths
+  for (TransformNode node = 0; node < serial.Size(); node += 37)
+  {
+    Vector3 t(0.001f * node, 1.0f, -2.0f);
+    serial.SetTranslation(node, t);
+    parallel.SetTranslation(node, t);
+  }
+  serial.Reparent(5000, 12);
+  parallel.Reparent(5000, 12);
+  serial.Update();
+  parallel.Update(pool, 64);
+  ExpectBitIdentical(serial, parallel);
+  ExpectWorldsMatch(parallel, 1e-3f);
+}
@@ -0,0 +1,125 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+TEST(Vector2x2, DefaultConstructorFillsZeros)
+{
+  Vector2x2 vector;
+  EXPECT_FLOAT_EQ(vector.x0, 0);
+  EXPECT_FLOAT_EQ(vector.y0, 0);
+  EXPECT_FLOAT_EQ(vector.x1, 0);
+  EXPECT_FLOAT_EQ(vector.y1, 0);
+}
+
+TEST(Vector2x2, Vector2PairConstructor)
+{
+  Vector2x2 vector(Vector2(1, 2), Vector2(3, 4));
+
+  EXPECT_FLOAT_EQ(vector.x0, 1);
+  EXPECT_FLOAT_EQ(vector.y0, 2);
+  EXPECT_FLOAT_EQ(vector.x1, 3);
+  EXPECT_FLOAT_EQ(vector.y1, 4);
+
+  EXPECT_TRUE(vector.First() == Vector2(1, 2));
+  EXPECT_TRUE(vector.Second() == Vector2(3, 4));
+}
+
+TEST(Vector2x2, FloatOperators)
+{
+  Vector2x2 vector(1, 2, 3, 4);
+
+  EXPECT_TRUE(vector + 1 == Vector2x2(2, 3, 4, 5));
+  EXPECT_TRUE(vector - 1 == Vector2x2(0, 1, 2, 3));
+  EXPECT_TRUE(vector * 2 == Vector2x2(2, 4, 6, 8));
+  EXPECT_TRUE(vector / 2 == Vector2x2(0.5f, 1, 1.5f, 2));
+
+  vector *= 3;
+  EXPECT_TRUE(vector == Vector2x2(3, 6, 9, 12));
+}
+
+TEST(Vector2x2, VectorOperators)
+{
+  Vector2x2 vector1(1, 2, 3, 4);
+  Vector2x2 vector2(4, 3, 2, 1);
+
+  EXPECT_TRUE(vector1 + vector2 == Vector2x2(5, 5, 5, 5));
+  EXPECT_TRUE(vector1 - vector2 == Vector2x2(-3, -1, 1, 3));
+  EXPECT_TRUE(vector1 * vector2 == Vector2x2(4, 6, 6, 4));
+  EXPECT_TRUE(vector1 != vector2);
+
+  vector1 += vector2;
+  EXPECT_TRUE(vector1 == Vector2x2(5, 5, 5, 5));
+}
+
+TEST(Vector2x2Static, DotProductReturnsBothResults)
+{
+  Vector2x2 vector1(1, 2, 3, 4);
+  Vector2x2 vector2(5, 6, 7, 8);
+
+  Vector2 dot = Vector2x2::Dot(vector1, vector2);
+
+  EXPECT_FLOAT_EQ(dot.x, 17);
+  EXPECT_FLOAT_EQ(dot.y, 53);
+  EXPECT_FLOAT_EQ(dot.x, Vector2::Dot(vector1.First(), vector2.First()));
+}
+
+TEST(Vector2x2, Magnitude)
+{
+  Vector2x2 vector(3, 4, 6, 8);
+
+  Vector2 magnitude = vector.Magnitude();
+  Vector2 magnitudeSqr = vector.MagnitudeSquared();
+
+  ASSERT_NEAR(magnitude.x, 5, 0.00001f);
+  ASSERT_NEAR(magnitude.y, 10, 0.00001f);
+  ASSERT_NEAR(magnitudeSqr.x, 25, 0.00001f);
+  ASSERT_NEAR(magnitudeSqr.y, 100, 0.00001f);
+}
+
+TEST(Vector2x2Static, Normalize)
+{
+  Vector2x2 vector(3, 4, 0, 2);
+
+  vector.Normalize();
+
+  ASSERT_NEAR(vector.x0, 0.6f, 0.00001f);
+  ASSERT_NEAR(vector.y0, 0.8f, 0.00001f);
+  ASSERT_NEAR(vector.x1, 0.0f, 0.00001f);
+  ASSERT_NEAR(vector.y1, 1.0f, 0.00001f);
+}
+
+TEST(Vector2x2Static, LoadAndStorePackedArrays)
+{
+  Float2 source[5] = { Float2(1, 2), Float2(3, 4), Float2(5, 6), Float2(7, 8), Float2(9, 10) };
+  Vector2x2 packed[3];
+
+  MMVector2x2LoadArray(packed, source, 5);
+
+  EXPECT_TRUE(packed[1] == Vector2x2(5, 6, 7, 8));
+  EXPECT_TRUE(packed[2] == Vector2x2(9, 10, 0, 0));
+
+  Float2 destination[5];
+  MMVector2x2StoreArray(destination, packed, 5);
+
+  for (int i = 0; i < 5; i++)
+  {
+    EXPECT_FLOAT_EQ(destination[i].x, source[i].x);
+    EXPECT_FLOAT_EQ(destination[i].y, source[i].y);
+  }
+}
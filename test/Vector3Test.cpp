@@ -319,3 +319,161 @@ TEST(Vector3Static, Normalize)
     ASSERT_NEAR(4.0f * inv, 0.00001f, resultVector.y);
     ASSERT_NEAR(5.0f * inv, 0.00001f, resultVector.z);
 }
+
+TEST(Vector3, NamedSwizzles)
+{
+  Vector3 vector(1, 2, 3);
+
+  Vector3 zxy = vector.zxy();
+  EXPECT_FLOAT_EQ(zxy.x, 3);
+  EXPECT_FLOAT_EQ(zxy.y, 1);
+  EXPECT_FLOAT_EQ(zxy.z, 2);
+
+  Vector3 zyx = vector.zyx();
+  EXPECT_FLOAT_EQ(zyx.x, 3);
+  EXPECT_FLOAT_EQ(zyx.y, 2);
+  EXPECT_FLOAT_EQ(zyx.z, 1);
+}
+
+TEST(Vector3Static, PermuteMixesTwoVectors)
+{
+  Vector3 v(1, 2, 3);
+  Vector3 u(4, 5, 6);
+
+  Vector3 result = Permute<MM_PERMUTE_0Y, MM_PERMUTE_1X, MM_PERMUTE_0Z>(v, u);
+  EXPECT_FLOAT_EQ(result.x, 2);
+  EXPECT_FLOAT_EQ(result.y, 4);
+  EXPECT_FLOAT_EQ(result.z, 3);
+}
+
+TEST(Vector3Static, SelectAndMaskReductionsIgnoreW)
+{
+  Vector3 v(1, 5, 3);
+  Vector3 u(2, 4, 6);
+
+  MMMask4 less = MMVector3Less(v, u);
+  EXPECT_TRUE(MMVector3AnyTrue(less));
+  EXPECT_FALSE(MMVector3AllTrue(less));
+
+  Vector3 lower = MMVector3Select(less, v, u);
+  EXPECT_FLOAT_EQ(lower.x, 1);
+  EXPECT_FLOAT_EQ(lower.y, 4);
+  EXPECT_FLOAT_EQ(lower.z, 3);
+
+  EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(v, Vector3(1.001f, 5, 3), 0.01f)));
+  EXPECT_FALSE(MMVector3AnyTrue(MMVector3IsNaN(v)));
+}
+
+TEST(Vector3Static, FloorStreamSnapsToGrid)
+{
+  Vector3 points[3] = { Vector3(0.5f, -0.5f, 1.0f), Vector3(2.9f, 3.1f, -7.2f), Vector3(-0.1f, 0.0f, 10.5f) };
+  Vector3 cells[3];
+
+  MMVector3FloorStream(cells, points, 3);
+
+  EXPECT_FLOAT_EQ(cells[0].x, 0.0f);
+  EXPECT_FLOAT_EQ(cells[0].y, -1.0f);
+  EXPECT_FLOAT_EQ(cells[1].z, -8.0f);
+  EXPECT_FLOAT_EQ(cells[2].x, -1.0f);
+  EXPECT_FLOAT_EQ(cells[2].z, 10.0f);
+}
+
+TEST(Vector3Static, ClampStreamInPlace)
+{
+  Vector3 points[2] = { Vector3(-5, 0.5f, 5), Vector3(0.25f, 2, -2) };
+
+  MMVector3ClampStream(points, points, 2, Vector3(0, 0, 0), Vector3(1, 1, 1));
+
+  EXPECT_FLOAT_EQ(points[0].x, 0.0f);
+  EXPECT_FLOAT_EQ(points[0].y, 0.5f);
+  EXPECT_FLOAT_EQ(points[0].z, 1.0f);
+  EXPECT_FLOAT_EQ(points[1].x, 0.25f);
+  EXPECT_FLOAT_EQ(points[1].y, 1.0f);
+  EXPECT_FLOAT_EQ(points[1].z, 0.0f);
+}
+
+TEST(Vector3Static, RegisterReductionsAreSplatted)
+{
+  Vector3 v(1, 2, 3);
+  Vector3 u(4, -5, 6);
+
+  MMFloat4 dot = MMVector3DotV(v, u);
+  MMFloat4 lengthSq = MMVector3MagnitudeSqrV(v);
+  MMFloat4 distance = MMVector3DistanceV(v, u);
+
+  for (int i = 0; i < 4; i++)
+  {
+    _MM_ALIGN16 float lanes[4];
+    MMVectorStore(lanes, dot);
+    EXPECT_FLOAT_EQ(lanes[i], 12.0f);
+    MMVectorStore(lanes, lengthSq);
+    EXPECT_FLOAT_EQ(lanes[i], 14.0f);
+    MMVectorStore(lanes, distance);
+    EXPECT_FLOAT_EQ(lanes[i], sqrtf(67.0f));
+  }
+
+  EXPECT_FLOAT_EQ(MMVectorGetX(MMVector3MagnitudeV(v)), MMVector3Magnitude(v));
+}
+
+TEST(Vector3Static, FastNormalizeIsNearUnitLength)
+{
+  Vector3 vector(3, 4, 5);
+
+  Vector3 fast = MMVector3Normalized(vector, MMPrecisionFast());
+  Vector3 exact = MMVector3Normalized(vector, MMPrecisionExact());
+
+  EXPECT_NEAR(fast.Magnitude(), 1.0f, 1e-6f);
+  EXPECT_NEAR(fast.x, exact.x, 1e-6f);
+  EXPECT_NEAR(fast.y, exact.y, 1e-6f);
+  EXPECT_NEAR(fast.z, exact.z, 1e-6f);
+}
+
+TEST(Vector3, PackedLoadAndStore)
+{
+  Float3 packed(1, 2, 3);
+  Float3A aligned(4, 5, 6);
+
+  Vector3 fromPacked(packed);
+  Vector3 fromAligned(aligned);
+
+  EXPECT_FLOAT_EQ(fromPacked.x, 1);
+  EXPECT_FLOAT_EQ(fromPacked.y, 2);
+  EXPECT_FLOAT_EQ(fromPacked.z, 3);
+  EXPECT_FLOAT_EQ(MMVectorGetW(static_cast<MMFloat4>(fromPacked)), 0);
+  EXPECT_FLOAT_EQ(fromAligned.z, 6);
+  EXPECT_FLOAT_EQ(MMVectorGetW(static_cast<MMFloat4>(fromAligned)), 0);
+
+  //The store must not write past the twelve bytes of its Float3
+  Float3 out[2] = { Float3(0, 0, 0), Float3(7, 8, 9) };
+  fromPacked.Store(&out[0]);
+  EXPECT_FLOAT_EQ(out[0].z, 3);
+  EXPECT_FLOAT_EQ(out[1].x, 7);
+}
+
+TEST(Vector3Static, PackedArrayRoundTrip)
+{
+  const size_t count = 11;
+  Float3 packed[count + 1];
+  Vector3 expanded[count];
+  Float3 repacked[count + 1];
+
+  for (size_t i = 0; i < count; i++)
+    packed[i] = Float3(i * 3.0f, i * 3.0f + 1, i * 3.0f + 2);
+  packed[count] = Float3(-1, -1, -1);
+  repacked[count] = Float3(-1, -1, -1);
+
+  MMVector3LoadArray(expanded, packed, count);
+  MMVector3StoreArray(repacked, expanded, count);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    EXPECT_FLOAT_EQ(expanded[i].x, i * 3.0f);
+    EXPECT_FLOAT_EQ(expanded[i].y, i * 3.0f + 1);
+    EXPECT_FLOAT_EQ(expanded[i].z, i * 3.0f + 2);
+    EXPECT_FLOAT_EQ(MMVectorGetW(static_cast<MMFloat4>(expanded[i])), 0);
+    EXPECT_FLOAT_EQ(repacked[i].x, packed[i].x);
+    EXPECT_FLOAT_EQ(repacked[i].y, packed[i].y);
+    EXPECT_FLOAT_EQ(repacked[i].z, packed[i].z);
+  }
+  EXPECT_FLOAT_EQ(repacked[count].x, -1);
+}
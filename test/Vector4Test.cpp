@@ -371,3 +371,45 @@ TEST(Vector4, Vector3ConversionOperator)
   EXPECT_FLOAT_EQ(result[1], vector[1]);
   EXPECT_FLOAT_EQ(result[2], vector[2]);
 }
+
+TEST(Vector4, NamedSwizzles)
+{
+  Vector4 vector(1, 2, 3, 4);
+
+  Vector4 wzyx = vector.wzyx();
+  EXPECT_FLOAT_EQ(wzyx.x, 4);
+  EXPECT_FLOAT_EQ(wzyx.y, 3);
+  EXPECT_FLOAT_EQ(wzyx.z, 2);
+  EXPECT_FLOAT_EQ(wzyx.w, 1);
+
+  Vector4 yyyy = vector.yyyy();
+  EXPECT_FLOAT_EQ(yyyy.x, 2);
+  EXPECT_FLOAT_EQ(yyyy.w, 2);
+}
+
+TEST(Vector4Static, SwizzleMatchesComponents)
+{
+  Vector4 vector(1, 2, 3, 4);
+
+  Vector4 result = Swizzle<MM_SWIZZLE_Y, MM_SWIZZLE_Z, MM_SWIZZLE_X, MM_SWIZZLE_W>(vector);
+  EXPECT_FLOAT_EQ(result.x, 2);
+  EXPECT_FLOAT_EQ(result.y, 3);
+  EXPECT_FLOAT_EQ(result.z, 1);
+  EXPECT_FLOAT_EQ(result.w, 4);
+}
+
+TEST(Vector4Static, MinMaxAreComponentWise)
+{
+  Vector4 v(1, 5, -3, 0);
+  Vector4 u(2, 4, -4, 0);
+
+  Vector4 lo = MMVector4Min(v, u);
+  Vector4 hi = MMVector4Max(v, u);
+
+  EXPECT_FLOAT_EQ(lo.x, 1);
+  EXPECT_FLOAT_EQ(lo.y, 4);
+  EXPECT_FLOAT_EQ(lo.z, -4);
+  EXPECT_FLOAT_EQ(hi.x, 2);
+  EXPECT_FLOAT_EQ(hi.y, 5);
+  EXPECT_FLOAT_EQ(hi.z, -3);
+}
@@ -0,0 +1,210 @@
+/**
+**    Hatchit Engine
+**    Copyright(c) 2015 Third-Degree
+**
+**    GNU Lesser General Public License
+**    This file may be used under the terms of the GNU Lesser
+**    General Public License version 3 as published by the Free
+**    Software Foundation and appearing in the file LICENSE.LGPLv3 included
+**    in the packaging of this file. Please review the following information
+**    to ensure the GNU Lesser General Public License requirements
+**    will be met: https://www.gnu.org/licenses/lgpl.html
+**
+**/
+
+#include <gtest/gtest.h>
+#include "ht_math.h"
+
+using namespace Hatchit;
+using namespace Math;
+
+namespace
+{
+    //Deterministic per-lane test values so every lane holds something different
+    Vector3 LaneVector3(size_t i)
+    {
+        return Vector3(1.0f + i, -2.0f + 0.5f * i, 0.25f * i - 1.0f);
+    }
+
+    Quaternion LaneQuaternion(size_t i)
+    {
+        return MMQuaternionNormalize(Quaternion(0.1f * i, 0.5f - 0.1f * i, 0.3f, 1.0f + 0.2f * i));
+    }
+}
+
+TEST(MMWide, LaneCountMatchesBuild)
+{
+#ifdef HT_MATH_AVX
+  EXPECT_EQ(wideLaneCount, 8u);
+#else
+  EXPECT_EQ(wideLaneCount, 4u);
+#endif
+  EXPECT_EQ(sizeof(MMFloatW), wideLaneCount * sizeof(float));
+  EXPECT_EQ(alignof(Vector3Wide), wideAlignment);
+}
+
+TEST(MMWide, RowsRoundTrip)
+{
+  Vector4 rows[wideLaneCount];
+  for (size_t i = 0; i < wideLaneCount; i++)
+    rows[i] = Vector4(LaneVector3(i), 10.0f + i);
+
+  Vector4Wide wide = MMVector4WideLoadAoS(rows);
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    EXPECT_EQ(MMWideGetLane(wide.x, i), rows[i].x);
+    EXPECT_EQ(MMWideGetLane(wide.y, i), rows[i].y);
+    EXPECT_EQ(MMWideGetLane(wide.z, i), rows[i].z);
+    EXPECT_EQ(MMWideGetLane(wide.w, i), rows[i].w);
+  }
+
+  Vector4 out[wideLaneCount];
+  MMVector4WideStoreAoS(out, wide);
+  for (size_t i = 0; i < wideLaneCount; i++)
+    EXPECT_TRUE(out[i] == rows[i]);
+}
+
+TEST(MMWide, SoAStreamsRoundTrip)
+{
+  float xs[wideLaneCount + 1], ys[wideLaneCount + 1], zs[wideLaneCount + 1];
+  for (size_t i = 0; i < wideLaneCount + 1; i++)
+  {
+    xs[i] = float(i);
+    ys[i] = float(i) * 2.0f;
+    zs[i] = float(i) * -3.0f;
+  }
+
+  //offset by one element to exercise the unaligned path
+  Vector3Wide wide = MMVector3WideLoad(xs + 1, ys + 1, zs + 1);
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    Vector3 v = wide.Get(i);
+    EXPECT_EQ(v.x, xs[i + 1]);
+    EXPECT_EQ(v.y, ys[i + 1]);
+    EXPECT_EQ(v.z, zs[i + 1]);
+  }
+
+  float outX[wideLaneCount], outY[wideLaneCount], outZ[wideLaneCount];
+  MMVector3WideStore(outX, outY, outZ, wide * 2.0f);
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    EXPECT_EQ(outX[i], xs[i + 1] * 2.0f);
+    EXPECT_EQ(outY[i], ys[i + 1] * 2.0f);
+    EXPECT_EQ(outZ[i], zs[i + 1] * 2.0f);
+  }
+}
+
+TEST(MMWide, SelectAndMasks)
+{
+  Vector3Wide a, b(Vector3(1.0f, 2.0f, 3.0f));
+  a.Set(1, Vector3(5.0f, 5.0f, 5.0f));
+
+  MMMaskW mask = MMWideCompareGreater(a.x, b.x);
+  EXPECT_EQ(MMWideMaskToBits(mask), 1 << 1);
+  EXPECT_TRUE(MMWideMaskAnyTrue(mask));
+  EXPECT_FALSE(MMWideMaskAllTrue(mask));
+  EXPECT_TRUE(MMWideMaskAllTrue(MMWideCompareEqual(b.y, MMWideSplat(2.0f))));
+
+  Vector3Wide picked = MMVector3WideSelect(mask, a, b);
+  for (size_t i = 0; i < wideLaneCount; i++)
+    EXPECT_TRUE(picked.Get(i) == (i == 1 ? a.Get(i) : b.Get(i)));
+}
+
+TEST(Vector3Wide, MatchesScalarVector3)
+{
+  Vector3Wide v, u;
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    v.Set(i, LaneVector3(i));
+    u.Set(i, LaneVector3(wideLaneCount - i) * 0.5f);
+  }
+
+  MMFloatW dot = MMVector3WideDot(v, u);
+  MMFloatW length = MMVector3WideMagnitude(v);
+  Vector3Wide cross = MMVector3WideCross(v, u);
+  Vector3Wide normalized = MMVector3WideNormalized(v);
+  Vector3Wide sum = v + u;
+  Vector3Wide diff = v - u;
+  Vector3Wide negated = -v;
+
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    Vector3 sv = v.Get(i);
+    Vector3 su = u.Get(i);
+    EXPECT_FLOAT_EQ(MMWideGetLane(dot, i), MMVector3Dot(sv, su));
+    EXPECT_FLOAT_EQ(MMWideGetLane(length, i), MMVector3Magnitude(sv));
+    EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(cross.Get(i), MMVector3Cross(sv, su), 1e-5f)));
+    EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(normalized.Get(i), MMVector3Normalized(sv), 1e-6f)));
+    EXPECT_TRUE(sum.Get(i) == sv + su);
+    EXPECT_TRUE(diff.Get(i) == sv - su);
+    EXPECT_TRUE(negated.Get(i) == sv * -1.0f);
+  }
+}
+
+TEST(QuaternionWide, ProductMatchesQuaternion)
+{
+  QuaternionWide q, r;
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    q.Set(i, LaneQuaternion(i));
+    r.Set(i, LaneQuaternion(i + 3));
+  }
+
+  QuaternionWide product = q * r;
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    Quaternion expected = LaneQuaternion(i) * LaneQuaternion(i + 3);
+    EXPECT_TRUE(MMQuaternionAllTrue(MMQuaternionNearEqual(product.Get(i), expected, 1e-6f)));
+  }
+}
+
+TEST(QuaternionWide, RotateMatchesRotationMatrix)
+{
+  QuaternionWide q;
+  Vector3Wide v;
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    q.Set(i, LaneQuaternion(i));
+    v.Set(i, LaneVector3(i));
+  }
+
+  Vector3Wide rotated = MMQuaternionWideRotate(q, v);
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    Vector4 expected = MMMatrixRotationQuaternion(LaneQuaternion(i)) * Vector4(LaneVector3(i), 0.0f);
+    EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(rotated.Get(i), Vector3(expected), 1e-5f)));
+  }
+}
+
+TEST(Matrix4Wide, TransformMatchesMatrix4)
+{
+  Matrix4 shared = MMMatrixTranslation(Vector3(1.0f, 2.0f, 3.0f)) * MMMatrixRotationQuaternion(LaneQuaternion(2));
+  Matrix4 perLane[wideLaneCount];
+  Vector4Wide v;
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    perLane[i] = MMMatrixRotationQuaternion(LaneQuaternion(i)) * MMMatrixScale(Vector3(1.0f + i));
+    v.Set(i, Vector4(LaneVector3(i), 1.0f));
+  }
+
+  Matrix4Wide wide = MMMatrix4WideLoadAoS(perLane);
+  Vector4Wide perLaneResult = wide * v;
+  Vector4Wide sharedResult = MMMatrixTransformWide(shared, v);
+  Vector3Wide point = MMMatrixTransformPointWide(shared, Vector3Wide(v));
+  Matrix4Wide product = wide * Matrix4Wide(shared);
+
+  Matrix4 stored[wideLaneCount];
+  MMMatrix4WideStoreAoS(stored, product);
+
+  for (size_t i = 0; i < wideLaneCount; i++)
+  {
+    Vector4 sv = v.Get(i);
+    EXPECT_TRUE(MMVector4AllTrue(MMVector4NearEqual(perLaneResult.Get(i), perLane[i] * sv, 1e-5f)));
+    EXPECT_TRUE(MMVector4AllTrue(MMVector4NearEqual(sharedResult.Get(i), shared * sv, 1e-5f)));
+    EXPECT_TRUE(MMVector3AllTrue(MMVector3NearEqual(point.Get(i), Vector3(shared * sv), 1e-5f)));
+
+    Matrix4 expected = perLane[i] * shared;
+    for (int r = 0; r < 4; r++)
+      EXPECT_TRUE(MMVector4AllTrue(MMVector4NearEqual(Vector4(stored[i].m_rows[r]), Vector4(expected.m_rows[r]), 1e-5f)));
+  }
+}